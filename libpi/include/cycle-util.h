@@ -30,13 +30,9 @@ write_cyc_until(unsigned pin, unsigned v, unsigned start, unsigned ncycles) {
     return delay_ncycles(start,ncycles);
 }   
 
-// We don't seem to need this, so removing for the moment.  can
-// drop in and experiment.
-//
 // we can't do direct loads and stores when faking things out, 
 // so redefine it when running on Unix
-// #ifdef RPI_UNIX
-#if 0
+#ifdef RPI_UNIX
 #   define GPIO_READ_RAW gpio_read
 #else
     // trying to eek out what we can in terms of speed so that we
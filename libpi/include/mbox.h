@@ -0,0 +1,45 @@
+#ifndef __MBOX_H__
+#define __MBOX_H__
+// the VideoCore mailbox property interface (channel 8): lets us ask
+// the GPU for things only it knows, such as the clock rates.
+//
+// see:
+//   https://github.com/raspberrypi/firmware/wiki/Mailbox-property-interface
+#include "rpi.h"
+
+#define MBOX_BASE       0x2000B880
+#define MBOX_READ       (MBOX_BASE + 0x00)
+#define MBOX_STATUS     (MBOX_BASE + 0x18)
+#define MBOX_WRITE      (MBOX_BASE + 0x20)
+
+#define MBOX_FULL       (1u << 31)
+#define MBOX_EMPTY      (1u << 30)
+
+// property tags: arm -> videocore.
+#define MBOX_CH_PROP    8
+
+// clock ids for <mbox_get_clock_rate>.
+enum {
+    MBOX_CLK_EMMC   = 1,
+    MBOX_CLK_UART   = 2,
+    MBOX_CLK_ARM    = 3,
+    // VPU clock: the BSC, SPI and aux peripherals divide this.
+    MBOX_CLK_CORE   = 4,
+};
+
+// send the 16-byte aligned message <msg> on <channel> and wait for
+// the reply (written back into <msg>).  returns 1 if the GPU says
+// the request succeeded, 0 if it did not or did not answer within
+// MBOX_TIMEOUT_USEC.
+int mbox_send(unsigned channel, volatile uint32_t *msg);
+
+// the GPU answers in microseconds: this only stops a wedged mailbox
+// from hanging the caller (e.g., i2c_init).
+#ifndef MBOX_TIMEOUT_USEC
+#define MBOX_TIMEOUT_USEC (100 * 1000)
+#endif
+
+// current rate of clock <clock_id> in hz.  0 on failure.
+uint32_t mbox_get_clock_rate(uint32_t clock_id);
+
+#endif
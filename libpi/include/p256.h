@@ -0,0 +1,80 @@
+#ifndef __P256_H__
+#define __P256_H__
+// ECDSA verification on NIST P-256 (secp256r1) in software, so the
+// ATECC608A is left free to sign.
+//
+// nothing here is secret, so it is written for speed, not constant
+// time: 8 x 32-bit limbs multiplied a row at a time (each step one
+// UMAAL on the arm1176), the NIST fast reduction for p, Jacobian
+// points with the a = -3 doubling, and Shamir's trick for
+// u1*G + u2*Q in one pass of 256 doublings.
+//
+// keys, digests and signatures are the raw big-endian bytes the chip
+// uses: pubkey x || y, signature r || s.
+#include <stdint.h>
+
+// 1 if <sig> is a valid signature of <digest> by <pubkey>, 0 if not
+// (including a pubkey that is not on the curve, or r, s out of range).
+int p256_verify(const uint8_t pubkey[64], const uint8_t digest[32], const uint8_t sig[64]);
+
+// we verify against the same few keys over and over, so p256_verify
+// keeps a comb table for each of the last P256_KEY_CACHE_N keys (4k
+// each, from kmalloc, found by fast_hash32 of the key) and a static
+// one for G.  a cached key costs 43 doublings and ~80 additions
+// instead of 256 and ~190; a new one about the same as not caching,
+// since building its table is ~215 doublings and 60 additions.  0
+// turns the cache off.  the key tables need a kmalloc heap: until
+// kmalloc_init runs, p256_verify does not cache and is
+// p256_verify_uncached.
+#ifndef P256_KEY_CACHE_N
+#define P256_KEY_CACHE_N 8
+#endif
+
+// the same answer, always by Shamir's trick: no cache, no tables.
+int p256_verify_uncached(const uint8_t pubkey[64], const uint8_t digest[32], const uint8_t sig[64]);
+
+typedef struct {
+    unsigned hits, misses, evictions;
+} p256_cache_stats_t;
+p256_cache_stats_t p256_cache_stats(void);
+
+// forget every cached key (their memory is kept for reuse).
+void p256_cache_flush(void);
+
+// for a valid signature, which point R with x(R) mod n == r the
+// signer used: bit 0 is y's parity, bit 1 says x = r + n.  -1 if the
+// signature does not verify.  stored next to the signature, it lets
+// p256_verify_batch check the signature in aggregate.
+int p256_verify_recid(const uint8_t pubkey[64], const uint8_t digest[32], const uint8_t sig[64]);
+
+typedef struct {
+    const uint8_t *pubkey;      // 64 bytes.
+    const uint8_t *digest;      // 32 bytes.
+    const uint8_t *sig;         // 64 bytes.
+    int recid;                  // p256_verify_recid, or -1 if not known.
+} p256_batch_item_t;
+
+// ok[i] = p256_verify(items[i]) for each of the <n> items; returns how
+// many verify.  every P256_BATCH_MAX items share one inversion for all
+// their s.  those with a recovery id check in one randomized equation
+// (a comb pass for G and the keys, Pippenger for the R's), bisected
+// if it fails; the rest verify one at a time, as does everything
+// when there is no heap for key tables.  the answers are the
+// same as p256_verify's, on the pi and in the fake build.
+#ifndef P256_BATCH_MAX
+#define P256_BATCH_MAX 128
+#endif
+unsigned p256_verify_batch(const p256_batch_item_t *items, unsigned n, uint8_t *ok);
+
+typedef struct {
+    unsigned nbatches;          // chunks of up to P256_BATCH_MAX.
+    unsigned naggregate;        // aggregate checks run.
+    unsigned nsplits;           // sets bisected.
+    unsigned nsingle;           // items verified on their own.
+} p256_batch_stats_t;
+p256_batch_stats_t p256_batch_stats(void);
+
+// 1 if <pubkey> is a point on the curve.
+int p256_pubkey_valid(const uint8_t pubkey[64]);
+
+#endif
@@ -3,6 +3,17 @@
 // try to keep most of the inline assembly in this header
 // so it's easy to flip to another arch or fake pi.
 
+#ifdef RPI_UNIX
+// fake-pi has no cpsr: it provides these and tracks the
+// interrupt-enable bit itself.
+uint32_t cpsr_get(void);
+void cpsr_set(uint32_t cpsr);
+int cpsr_int_enabled(void);
+uint32_t cpsr_int_enable(void);
+uint32_t cpsr_int_disable(void);
+uint32_t cpsr_int_reset(uint32_t cpsr);
+#else
+
 // get the status register.
 static inline uint32_t cpsr_get(void) {
     uint32_t cpsr;
@@ -69,4 +80,5 @@ static inline uint32_t cpsr_int_reset(uint32_t cpsr) {
     else
         return cpsr_int_enable();
 }
+#endif /* RPI_UNIX */
 #endif
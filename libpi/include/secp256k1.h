@@ -0,0 +1,55 @@
+#ifndef __SECP256K1_H__
+#define __SECP256K1_H__
+// ECDSA on secp256k1, the Bitcoin / Ethereum curve, which the
+// ATECC608A does not do: signing happens here, with the private key
+// kept sealed (see proj/1-i2c/atecc-seal.h) under a key only the chip
+// can derive.
+//
+// signing is k G from a fixed-base comb table (static, built on first
+// use: no heap needed) with RFC 6979 nonces, and low-S signatures.
+// the comb starts from G rather than infinity (and takes it back off),
+// the field and scalar reductions are masked, and both inversions are
+// fixed exponentiations, so signing takes the same steps whatever the
+// nonce's and key's bits.  verifying splits both scalars with the GLV endomorphism
+// (lambda P = (beta x, y)) into four ~128-bit halves and runs them
+// together as width-5 NAFs: half the doublings of a plain double-scalar
+// multiplication.
+//
+// keys, digests and signatures are big-endian bytes: pubkey x || y,
+// signature r || s.
+#include <stdint.h>
+
+typedef struct {
+    uint8_t priv[32];
+    uint8_t pubkey[64];
+} secp256k1_key_t;
+
+// 1 and <k> ready to sign with, or 0 if <priv> is not in [1, n).
+int secp256k1_key_init(secp256k1_key_t *k, const uint8_t priv[32]);
+void secp256k1_key_wipe(secp256k1_key_t *k);
+
+// sign <digest>: RFC 6979 (HMAC-SHA256) nonce, s <= n/2.  returns the
+// recovery id (bit 0: R's y is odd, bit 1: R's x >= n), as Ethereum's
+// v wants it, or -1 if <k> is not a key.
+int secp256k1_sign(const secp256k1_key_t *k, const uint8_t digest[32], uint8_t sig[64]);
+
+// 1 if <sig> is a valid signature of <digest> by <pubkey> (high S
+// included, as ECDSA has it), 0 if not.
+int secp256k1_verify(const uint8_t pubkey[64], const uint8_t digest[32], const uint8_t sig[64]);
+
+// a private key encrypted and authenticated under a 32-byte <kek>:
+// a keystream and a tag from HMAC-SHA256 keyed off <kek>, over a
+// 16-byte nonce that must not repeat for the same <kek>.
+typedef struct {
+    uint8_t nonce[16];
+    uint8_t ct[32];
+    uint8_t tag[32];
+} secp256k1_sealed_t;
+
+void secp256k1_seal(secp256k1_sealed_t *out, const uint8_t kek[32],
+                    const uint8_t priv[32], const uint8_t nonce[16]);
+// 1 and the key in <priv>, or 0 (and <priv> zeroed) if <in> was not
+// sealed under <kek> or has been changed.
+int secp256k1_unseal(uint8_t priv[32], const uint8_t kek[32], const secp256k1_sealed_t *in);
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef __SHA256_H__
+#define __SHA256_H__
+// SHA-256 (FIPS 180-4) in software, for the arm1176.
+//
+// the compression function is fully unrolled with the 16-word message
+// schedule in locals rather than an array, so the compiler keeps what
+// it can in registers and every round is straight-line code.  input
+// that is word aligned is loaded a word at a time (REV for the byte
+// order); anything else is copied into an aligned block first.
+#include <stdint.h>
+
+typedef struct {
+    uint32_t h[8];
+    uint64_t nbytes;        // hashed so far, incl. buf.
+    uint32_t buf[16];       // partial block (aligned so it loads by word).
+    unsigned nbuf;
+} sha256_ctx_t;
+
+void sha256_init(sha256_ctx_t *c);
+void sha256_update(sha256_ctx_t *c, const void *data, unsigned n);
+void sha256_final(sha256_ctx_t *c, uint8_t digest[32]);
+
+// all at once.
+void sha256(const void *msg, unsigned n, uint8_t digest[32]);
+
+// the compression function over <nblocks> 64-byte blocks at <p>.
+void sha256_blocks(uint32_t h[8], const void *p, unsigned nblocks);
+
+// HMAC-SHA256 (RFC 2104).  keys longer than a block are hashed first.
+typedef struct {
+    sha256_ctx_t inner, outer;
+} hmac_sha256_ctx_t;
+
+void hmac_sha256_init(hmac_sha256_ctx_t *c, const void *key, unsigned keylen);
+void hmac_sha256_update(hmac_sha256_ctx_t *c, const void *data, unsigned n);
+void hmac_sha256_final(hmac_sha256_ctx_t *c, uint8_t mac[32]);
+void hmac_sha256(const void *key, unsigned keylen, const void *msg, unsigned n, uint8_t mac[32]);
+
+// zero <n> bytes at <p> through a volatile pointer: a memset of a key
+// or HMAC state about to go out of scope is a dead store the compiler
+// may drop.
+void sha256_wipe(void *p, unsigned n);
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef __SW_I2C_H__
+#define __SW_I2C_H__
+// a software i2c master that bit-bangs any two GPIO pins, timed with
+// the cycle counter (same approach as sw-uart.c).
+//
+// the pins are open drain: a 0 is driven by making the pin an output
+// (its output latch is kept at 0), a 1 by making it an input and
+// letting the pullup take the line high.  every time we let SCL go
+// high we wait for it to actually get there, so a slave can stretch
+// the clock, up to <stretch_usec>.
+//
+// each pin pair is its own bus: devices with the same address can
+// sit on different buses, and nothing is shared with the BSC.
+
+typedef struct {
+    uint8_t scl, sda;
+    uint32_t hz;
+    // half an scl period: we change SDA in the low half and sample
+    // in the high half.
+    uint32_t cyc_per_half;
+    // longest a slave may hold SCL low.
+    uint32_t stretch_usec;
+} sw_i2c_t;
+
+// errors: same values as the BSC driver's I2C_ERR_* so callers can
+// treat both the same.
+enum {
+    SW_I2C_ERR_NACK = -1,   // no ACK for the address or a byte.
+    SW_I2C_ERR_CLKT = -2,   // slave held SCL low too long.
+    SW_I2C_ERR_BUSY = -5,   // SDA stuck low before the START.
+};
+
+// default clock stretch limit.
+#define SW_I2C_STRETCH_USEC 10000
+
+// bus on <scl>,<sda> at <hz> (the internal pullups are turned on;
+// add external ones for anything past 100kHz).
+sw_i2c_t sw_i2c_init(unsigned scl, unsigned sda, unsigned hz);
+
+// write <nbytes> of <data> to device <addr>: returns <nbytes> or
+// < 0 (SW_I2C_ERR_*).
+int sw_i2c_write(sw_i2c_t *h, unsigned addr, const uint8_t *data, unsigned nbytes);
+
+// read <nbytes> from device <addr> into <data>: returns <nbytes> or < 0.
+int sw_i2c_read(sw_i2c_t *h, unsigned addr, uint8_t *data, unsigned nbytes);
+
+// write <wn> bytes then read <rn> bytes with a repeated START in
+// between: returns <rn> or < 0.
+int sw_i2c_write_read(sw_i2c_t *h, unsigned addr,
+                      const uint8_t *wdata, unsigned wn,
+                      uint8_t *rdata, unsigned rn);
+
+#endif
@@ -0,0 +1,199 @@
+#ifndef __BN256_H__
+#define __BN256_H__
+// 256-bit unsigned integers as 8 little-endian 32-bit limbs: the
+// arithmetic under the elliptic curve code (p256.c, secp256k1.c),
+// which puts each field's own reduction on top.  not constant time,
+// except the add, sub, multiplies and the conditional add/subtract
+// (bn_cadd, bn_csub) that secp256k1.c signs with.
+#include <stdint.h>
+
+typedef uint32_t bn_t[8];
+
+// (*hi:*lo) = a * b + *lo + *hi: never overflows 64 bits.
+#if defined(__arm__) && !defined(RPI_UNIX)
+static inline void umaal(uint32_t *lo, uint32_t *hi, uint32_t a, uint32_t b) {
+    asm("umaal %0, %1, %2, %3" : "+r"(*lo), "+r"(*hi) : "r"(a), "r"(b));
+}
+#else
+static inline void umaal(uint32_t *lo, uint32_t *hi, uint32_t a, uint32_t b) {
+    uint64_t u = (uint64_t)a * b + *lo + *hi;
+    *lo = u;
+    *hi = u >> 32;
+}
+#endif
+
+static inline int bn_is_zero(const bn_t a) {
+    uint32_t x = 0;
+    for(unsigned i = 0; i < 8; i++)
+        x |= a[i];
+    return x == 0;
+}
+
+static inline int bn_cmp(const bn_t a, const bn_t b) {
+    for(int i = 7; i >= 0; i--)
+        if(a[i] != b[i])
+            return a[i] < b[i] ? -1 : 1;
+    return 0;
+}
+
+static inline uint32_t bn_add(bn_t r, const bn_t a, const bn_t b) {
+    uint64_t c = 0;
+    for(unsigned i = 0; i < 8; i++) {
+        c += (uint64_t)a[i] + b[i];
+        r[i] = c;
+        c >>= 32;
+    }
+    return c;
+}
+
+static inline uint32_t bn_sub(bn_t r, const bn_t a, const bn_t b) {
+    int64_t c = 0;
+    for(unsigned i = 0; i < 8; i++) {
+        c += (int64_t)a[i] - b[i];
+        r[i] = c;
+        c >>= 32;
+    }
+    return c & 1;
+}
+
+// r = a + m if <c> (0 or 1), else a, mod 2^256: masked, not branched.
+static inline uint32_t bn_cadd(bn_t r, const bn_t a, uint32_t c, const bn_t m) {
+    bn_t t;
+    for(unsigned i = 0; i < 8; i++)
+        t[i] = m[i] & -c;
+    return bn_add(r, a, t);
+}
+
+// r = a - m if <hi> (a's bit 256, 0 or 1) is set or a >= m, else a:
+// the reduction after an add, masked, not branched.
+static inline void bn_csub(bn_t r, const bn_t a, uint32_t hi, const bn_t m) {
+    bn_t t;
+    uint32_t ge = bn_sub(t, a, m) ^ 1;
+    uint32_t mask = -((hi | ge) & 1);
+    for(unsigned i = 0; i < 8; i++)
+        r[i] = (t[i] & mask) | (a[i] & ~mask);
+}
+
+// a >> 1, with <top> shifted in at bit 255.
+static inline void bn_shr1(bn_t a, uint32_t top) {
+    for(unsigned i = 0; i < 7; i++)
+        a[i] = (a[i] >> 1) | (a[i+1] << 31);
+    a[7] = (a[7] >> 1) | (top << 31);
+}
+
+// big-endian bytes, as keys and signatures are sent.
+static inline void bn_from_bytes(bn_t r, const uint8_t b[32]) {
+    for(unsigned i = 0; i < 8; i++) {
+        const uint8_t *p = b + 28 - 4 * i;
+        r[i] = (uint32_t)p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
+    }
+}
+
+static inline void bn_to_bytes(uint8_t b[32], const bn_t a) {
+    for(unsigned i = 0; i < 8; i++) {
+        uint8_t *p = b + 28 - 4 * i;
+        p[0] = a[i] >> 24;
+        p[1] = a[i] >> 16;
+        p[2] = a[i] >> 8;
+        p[3] = a[i];
+    }
+}
+
+static inline unsigned bn_bit(const bn_t a, unsigned i) {
+    return (a[i / 32] >> (i % 32)) & 1;
+}
+
+// a^-1 mod odd <m>, for 0 < a < m: binary extended Euclid.  not
+// constant time, which is fine for public values.
+static inline void bn_inv_mod(bn_t r, const bn_t a, const bn_t m) {
+    bn_t u, v, x1 = {1}, x2 = {0};
+    memcpy(u, a, sizeof u);
+    memcpy(v, m, sizeof v);
+    static const bn_t one = {1};
+
+    while(bn_cmp(u, one) != 0 && bn_cmp(v, one) != 0) {
+        while(!(u[0] & 1)) {
+            bn_shr1(u, 0);
+            bn_shr1(x1, (x1[0] & 1) ? bn_add(x1, x1, m) : 0);
+        }
+        while(!(v[0] & 1)) {
+            bn_shr1(v, 0);
+            bn_shr1(x2, (x2[0] & 1) ? bn_add(x2, x2, m) : 0);
+        }
+        if(bn_cmp(u, v) >= 0) {
+            bn_sub(u, u, v);
+            if(bn_sub(x1, x1, x2))
+                bn_add(x1, x1, m);
+        } else {
+            bn_sub(v, v, u);
+            if(bn_sub(x2, x2, x1))
+                bn_add(x2, x2, m);
+        }
+    }
+    memcpy(r, bn_cmp(u, one) == 0 ? x1 : x2, sizeof(bn_t));
+}
+
+// t = a * b, 16 limbs: a row of UMAALs per limb of a.
+static inline void bn_mul(uint32_t t[16], const bn_t a, const bn_t b) {
+    for(unsigned i = 0; i < 8; i++)
+        t[i] = 0;
+    for(unsigned i = 0; i < 8; i++) {
+        uint32_t c = 0, ai = a[i];
+        for(unsigned j = 0; j < 8; j++)
+            umaal(&t[i+j], &c, ai, b[j]);
+        t[i+8] = c;
+    }
+}
+
+// t = a^2: the cross products once, doubled, then the squares.
+static inline void bn_sqr(uint32_t t[16], const bn_t a) {
+    for(unsigned i = 0; i < 16; i++)
+        t[i] = 0;
+    for(unsigned i = 0; i < 7; i++) {
+        uint32_t c = 0, ai = a[i];
+        for(unsigned j = i + 1; j < 8; j++)
+            umaal(&t[i+j], &c, ai, a[j]);
+        t[i+8] = c;
+    }
+    for(unsigned i = 15; i > 0; i--)
+        t[i] = (t[i] << 1) | (t[i-1] >> 31);
+    t[0] <<= 1;
+
+    uint32_t c = 0;
+    for(unsigned i = 0; i < 8; i++) {
+        uint64_t u = (uint64_t)a[i] * a[i] + t[2*i] + c;
+        t[2*i] = u;
+        u = (u >> 32) + t[2*i+1];
+        t[2*i+1] = u;
+        c = u >> 32;
+    }
+}
+
+// a * b / 2^256 mod odd <m> (Montgomery, CIOS); m0 = -m^-1 mod 2^32.
+// a, b < m.
+static inline void bn_mont_mul(bn_t r, const bn_t a, const bn_t b, const bn_t m, uint32_t m0) {
+    uint32_t t[10] = {0};
+    for(unsigned i = 0; i < 8; i++) {
+        uint32_t c = 0, bi = b[i];
+        for(unsigned j = 0; j < 8; j++)
+            umaal(&t[j], &c, a[j], bi);
+        uint64_t u = (uint64_t)t[8] + c;
+        t[8] = u;
+        t[9] = u >> 32;
+
+        uint32_t q = t[0] * m0, lo = t[0];
+        c = 0;
+        umaal(&lo, &c, q, m[0]);
+        for(unsigned j = 1; j < 8; j++) {
+            lo = t[j];
+            umaal(&lo, &c, q, m[j]);
+            t[j-1] = lo;
+        }
+        u = (uint64_t)t[8] + c;
+        t[7] = u;
+        t[8] = t[9] + (u >> 32);
+    }
+    bn_csub(r, t, t[8], m);
+}
+
+#endif
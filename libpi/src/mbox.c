@@ -0,0 +1,50 @@
+// simple mailbox property interface: see <mbox.h>.
+#include "rpi.h"
+#include "mbox.h"
+#include "timeout.h"
+
+#define MBOX_REQUEST    0
+#define MBOX_SUCCESS    0x80000000
+#define TAG_GET_CLOCK_RATE  0x00030002
+
+int mbox_send(unsigned channel, volatile uint32_t *msg) {
+    uint32_t addr = (uint32_t)msg;
+    // low 4 bits carry the channel.
+    assert((addr & 0xf) == 0);
+
+    dev_barrier();
+    timeout_t t = timeout_start();
+    while(GET32(MBOX_STATUS) & MBOX_FULL)
+        if(timeout_usec(&t, MBOX_TIMEOUT_USEC))
+            return 0;
+    PUT32(MBOX_WRITE, addr | channel);
+
+    // other channels can answer too: wait for ours.
+    while(1) {
+        while(GET32(MBOX_STATUS) & MBOX_EMPTY)
+            if(timeout_usec(&t, MBOX_TIMEOUT_USEC))
+                return 0;
+        uint32_t v = GET32(MBOX_READ);
+        if((v & 0xf) == channel)
+            break;
+    }
+    dev_barrier();
+    return msg[1] == MBOX_SUCCESS;
+}
+
+uint32_t mbox_get_clock_rate(uint32_t clock_id) {
+    static volatile uint32_t msg[8] __attribute__((aligned(16)));
+
+    msg[0] = sizeof msg;        // total size in bytes
+    msg[1] = MBOX_REQUEST;
+    msg[2] = TAG_GET_CLOCK_RATE;
+    msg[3] = 8;                 // value buffer size
+    msg[4] = 0;                 // request
+    msg[5] = clock_id;
+    msg[6] = 0;                 // rate comes back here
+    msg[7] = 0;                 // end tag
+
+    if(!mbox_send(MBOX_CH_PROP, msg))
+        return 0;
+    return msg[6];
+}
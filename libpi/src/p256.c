@@ -0,0 +1,919 @@
+// P-256 ECDSA verification: see <p256.h>.
+#include "rpi.h"
+#include "p256.h"
+#include "fast-hash32.h"
+#include "sha256.h"
+#include "bn256.h"
+
+// field elements and scalars.
+typedef bn_t fe_t;
+
+// Jacobian (x/z^2, y/z^3); z = 0 is the point at infinity.
+typedef struct { fe_t x, y, z; } jac_t;
+typedef struct { fe_t x, y; } aff_t;
+
+static const fe_t P = {
+    0xffffffff, 0xffffffff, 0xffffffff, 0x00000000,
+    0x00000000, 0x00000000, 0x00000001, 0xffffffff,
+};
+static const fe_t N = {
+    0xfc632551, 0xf3b9cac2, 0xa7179e84, 0xbce6faad,
+    0xffffffff, 0xffffffff, 0x00000000, 0xffffffff,
+};
+static const fe_t B = {
+    0x27d2604b, 0x3bce3c3e, 0xcc53b0f6, 0x651d06b0,
+    0x769886bc, 0xb3ebbd55, 0xaa3a93e7, 0x5ac635d8,
+};
+static const aff_t G = {
+    { 0xd898c296, 0xf4a13945, 0x2deb33a0, 0x77037d81,
+      0x63a440f2, 0xf8bce6e5, 0xe12c4247, 0x6b17d1f2 },
+    { 0x37bf51f5, 0xcbb64068, 0x6b315ece, 0x2bce3357,
+      0x7c0f9e16, 0x8ee7eb4a, 0xfe1a7f9b, 0x4fe342e2 },
+};
+// Montgomery constants for arithmetic mod n: -n^-1 mod 2^32 and
+// 2^512 mod n.
+#define N0 0xee00bc4f
+static const fe_t N_R2 = {
+    0xbe79eea2, 0x83244c95, 0x49bd6fa6, 0x4699799c,
+    0x2b6bec59, 0x2845b239, 0xf3d95620, 0x66e12d94,
+};
+
+/***********************************************************
+ * arithmetic mod p.  everything stays fully reduced, so equal
+ * values have equal limbs.
+ */
+
+static void fe_add(fe_t r, const fe_t a, const fe_t b) {
+    if(bn_add(r, a, b) || bn_cmp(r, P) >= 0)
+        bn_sub(r, r, P);
+}
+
+static void fe_sub(fe_t r, const fe_t a, const fe_t b) {
+    if(bn_sub(r, a, b))
+        bn_add(r, r, P);
+}
+
+// 512 -> 256 bits with p = 2^256 - 2^224 + 2^192 + 2^96 - 1: each
+// high limb folds down as a few adds and subtracts (FIPS 186-4
+// D.2.3), summed per limb here with the carries in 64 bits.
+static void fe_reduce(fe_t r, const uint32_t c[16]) {
+    int64_t c8 = c[8], c9 = c[9], c10 = c[10], c11 = c[11],
+            c12 = c[12], c13 = c[13], c14 = c[14], c15 = c[15];
+    int64_t acc;
+
+    acc  = (int64_t)c[0] + c8 + c9 - c11 - c12 - c13 - c14;
+    r[0] = acc; acc >>= 32;
+    acc += (int64_t)c[1] + c9 + c10 - c12 - c13 - c14 - c15;
+    r[1] = acc; acc >>= 32;
+    acc += (int64_t)c[2] + c10 + c11 - c13 - c14 - c15;
+    r[2] = acc; acc >>= 32;
+    acc += (int64_t)c[3] + 2*c11 + 2*c12 + c13 - c15 - c8 - c9;
+    r[3] = acc; acc >>= 32;
+    acc += (int64_t)c[4] + 2*c12 + 2*c13 + c14 - c9 - c10;
+    r[4] = acc; acc >>= 32;
+    acc += (int64_t)c[5] + 2*c13 + 2*c14 + c15 - c10 - c11;
+    r[5] = acc; acc >>= 32;
+    acc += (int64_t)c[6] + 3*c14 + 2*c15 + c13 - c8 - c9;
+    r[6] = acc; acc >>= 32;
+    acc += (int64_t)c[7] + 3*c15 + c8 - c10 - c11 - c12 - c13;
+    r[7] = acc; acc >>= 32;
+
+    // r + acc * 2^256, with acc a small signed count of 2^256s.
+    while(acc > 0)
+        acc -= bn_sub(r, r, P);
+    while(acc < 0)
+        acc += bn_add(r, r, P);
+    while(bn_cmp(r, P) >= 0)
+        bn_sub(r, r, P);
+}
+
+static void fe_mul(fe_t r, const fe_t a, const fe_t b) {
+    uint32_t t[16];
+    bn_mul(t, a, b);
+    fe_reduce(r, t);
+}
+
+static void fe_sqr(fe_t r, const fe_t a) {
+    uint32_t t[16];
+    bn_sqr(t, a);
+    fe_reduce(r, t);
+}
+
+static void fe_inv(fe_t r, const fe_t a) {
+    bn_inv_mod(r, a, P);
+}
+
+// square root: p = 3 mod 4, so a^((p+1)/4) is one if there is one.
+// returns 0 if <a> is not a square.
+static int fe_sqrt(fe_t r, const fe_t a) {
+    static const fe_t e = {
+        0x00000000, 0x00000000, 0x40000000, 0x00000000,
+        0x00000000, 0x40000000, 0xc0000000, 0x3fffffff,
+    };
+    fe_t x = {1}, t;
+    for(int i = 255; i >= 0; i--) {
+        fe_sqr(x, x);
+        if(bn_bit(e, i))
+            fe_mul(x, x, a);
+    }
+    fe_sqr(t, x);
+    memcpy(r, x, sizeof(fe_t));
+    return bn_cmp(t, a) == 0;
+}
+
+/***********************************************************
+ * arithmetic mod n, for the scalars.
+ */
+
+// a * b / 2^256 mod n.
+static void sc_mont_mul(fe_t r, const fe_t a, const fe_t b) {
+    bn_mont_mul(r, a, b, N, N0);
+}
+
+static void sc_add(fe_t r, const fe_t a, const fe_t b) {
+    if(bn_add(r, a, b) || bn_cmp(r, N) >= 0)
+        bn_sub(r, r, N);
+}
+
+// a * b mod n.
+static void sc_mul(fe_t r, const fe_t a, const fe_t b) {
+    fe_t t;
+    sc_mont_mul(t, a, b);
+    sc_mont_mul(r, t, N_R2);
+}
+
+/***********************************************************
+ * points.
+ */
+
+static int jac_is_inf(const jac_t *p) {
+    return bn_is_zero(p->z);
+}
+
+// a = -3 doubling: 3M + 5S (dbl-2001-b).  <r> may be <p>.
+static void jac_dbl(jac_t *r, const jac_t *p) {
+    if(jac_is_inf(p)) {
+        *r = *p;
+        return;
+    }
+    fe_t delta, gamma, beta, alpha, t1, t2;
+
+    fe_sqr(delta, p->z);
+    fe_sqr(gamma, p->y);
+    fe_mul(beta, p->x, gamma);
+
+    // alpha = 3 (x - delta)(x + delta)
+    fe_sub(t1, p->x, delta);
+    fe_add(t2, p->x, delta);
+    fe_mul(t1, t1, t2);
+    fe_add(alpha, t1, t1);
+    fe_add(alpha, alpha, t1);
+
+    // z3 = (y + z)^2 - gamma - delta, before y and z go.
+    fe_add(t1, p->y, p->z);
+    fe_sqr(t1, t1);
+    fe_sub(t1, t1, gamma);
+    fe_sub(r->z, t1, delta);
+
+    // x3 = alpha^2 - 8 beta
+    fe_add(beta, beta, beta);
+    fe_add(beta, beta, beta);       // 4 beta
+    fe_add(t2, beta, beta);         // 8 beta
+    fe_sqr(t1, alpha);
+    fe_sub(r->x, t1, t2);
+
+    // y3 = alpha (4 beta - x3) - 8 gamma^2
+    fe_sub(t1, beta, r->x);
+    fe_mul(t1, alpha, t1);
+    fe_sqr(t2, gamma);
+    fe_add(t2, t2, t2);
+    fe_add(t2, t2, t2);
+    fe_add(t2, t2, t2);
+    fe_sub(r->y, t1, t2);
+}
+
+// r = p + q, q affine: 8M + 3S.  <r> may be <p>.
+static void jac_madd(jac_t *r, const jac_t *p, const aff_t *q) {
+    if(jac_is_inf(p)) {
+        memcpy(r->x, q->x, sizeof(fe_t));
+        memcpy(r->y, q->y, sizeof(fe_t));
+        memset(r->z, 0, sizeof(fe_t));
+        r->z[0] = 1;
+        return;
+    }
+    fe_t z1z1, u2, s2, h, rr, hh, hhh, v, t;
+
+    fe_sqr(z1z1, p->z);
+    fe_mul(u2, q->x, z1z1);
+    fe_mul(s2, q->y, p->z);
+    fe_mul(s2, s2, z1z1);
+    fe_sub(h, u2, p->x);
+    fe_sub(rr, s2, p->y);
+
+    if(bn_is_zero(h)) {
+        // same x: p == q doubles, p == -q is infinity.
+        if(bn_is_zero(rr)) {
+            jac_t qj;
+            memcpy(qj.x, q->x, sizeof(fe_t));
+            memcpy(qj.y, q->y, sizeof(fe_t));
+            memset(qj.z, 0, sizeof(fe_t));
+            qj.z[0] = 1;
+            jac_dbl(r, &qj);
+        } else
+            memset(r->z, 0, sizeof(fe_t));
+        return;
+    }
+
+    fe_sqr(hh, h);
+    fe_mul(hhh, h, hh);
+    fe_mul(v, p->x, hh);
+    fe_mul(t, p->y, hhh);
+
+    // everything of p is read by now, so <r> can alias it.
+    fe_mul(r->z, p->z, h);
+    // x3 = rr^2 - h^3 - 2v
+    fe_sqr(u2, rr);
+    fe_sub(u2, u2, hhh);
+    fe_sub(u2, u2, v);
+    fe_sub(r->x, u2, v);
+    // y3 = rr (v - x3) - y1 h^3
+    fe_sub(v, v, r->x);
+    fe_mul(v, rr, v);
+    fe_sub(r->y, v, t);
+}
+
+// r = p + q, both Jacobian: 12M + 4S.  <r> may be either.
+static void jac_add(jac_t *r, const jac_t *p, const jac_t *q) {
+    if(jac_is_inf(q)) {
+        *r = *p;
+        return;
+    }
+    if(jac_is_inf(p)) {
+        *r = *q;
+        return;
+    }
+    fe_t z1z1, z2z2, u1, u2, s1, s2, h, rr, hh, hhh, t;
+
+    fe_sqr(z1z1, p->z);
+    fe_sqr(z2z2, q->z);
+    fe_mul(u1, p->x, z2z2);
+    fe_mul(u2, q->x, z1z1);
+    fe_mul(s1, p->y, q->z);
+    fe_mul(s1, s1, z2z2);
+    fe_mul(s2, q->y, p->z);
+    fe_mul(s2, s2, z1z1);
+    fe_sub(h, u2, u1);
+    fe_sub(rr, s2, s1);
+
+    if(bn_is_zero(h)) {
+        if(bn_is_zero(rr))
+            jac_dbl(r, p);
+        else
+            memset(r->z, 0, sizeof(fe_t));
+        return;
+    }
+
+    fe_sqr(hh, h);
+    fe_mul(hhh, h, hh);
+    fe_mul(u1, u1, hh);             // u1 h^2
+    fe_mul(s1, s1, hhh);            // s1 h^3
+    fe_mul(t, p->z, q->z);
+    fe_mul(r->z, t, h);
+    // x3 = rr^2 - h^3 - 2 u1 h^2
+    fe_sqr(t, rr);
+    fe_sub(t, t, hhh);
+    fe_sub(t, t, u1);
+    fe_sub(r->x, t, u1);
+    // y3 = rr (u1 h^2 - x3) - s1 h^3
+    fe_sub(t, u1, r->x);
+    fe_mul(t, rr, t);
+    fe_sub(r->y, t, s1);
+}
+
+// p == q, without normalizing either.
+static int jac_eq(const jac_t *p, const jac_t *q) {
+    int pi = jac_is_inf(p), qi = jac_is_inf(q);
+    if(pi || qi)
+        return pi && qi;
+
+    fe_t z1z1, z2z2, a, b;
+    fe_sqr(z1z1, p->z);
+    fe_sqr(z2z2, q->z);
+    fe_mul(a, p->x, z2z2);
+    fe_mul(b, q->x, z1z1);
+    if(bn_cmp(a, b) != 0)
+        return 0;
+    fe_mul(z1z1, z1z1, p->z);
+    fe_mul(z2z2, z2z2, q->z);
+    fe_mul(a, p->y, z2z2);
+    fe_mul(b, q->y, z1z1);
+    return bn_cmp(a, b) == 0;
+}
+
+static void jac_to_aff(aff_t *r, const jac_t *p) {
+    fe_t zi, zi2;
+    fe_inv(zi, p->z);
+    fe_sqr(zi2, zi);
+    fe_mul(r->x, p->x, zi2);
+    fe_mul(zi2, zi2, zi);
+    fe_mul(r->y, p->y, zi2);
+}
+
+static int on_curve(const aff_t *q) {
+    if(bn_cmp(q->x, P) >= 0 || bn_cmp(q->y, P) >= 0)
+        return 0;
+    // y^2 = x^3 - 3x + b
+    fe_t l, r, t;
+    fe_sqr(l, q->y);
+    fe_sqr(r, q->x);
+    fe_mul(r, r, q->x);
+    fe_add(t, q->x, q->x);
+    fe_add(t, t, q->x);
+    fe_sub(r, r, t);
+    fe_add(r, r, B);
+    return bn_cmp(l, r) == 0;
+}
+
+static void aff_from_bytes(aff_t *q, const uint8_t b[64]) {
+    bn_from_bytes(q->x, b);
+    bn_from_bytes(q->y, b + 32);
+}
+
+int p256_pubkey_valid(const uint8_t pubkey[64]) {
+    aff_t q;
+    aff_from_bytes(&q, pubkey);
+    return on_curve(&q);
+}
+
+// u1 G + u2 Q in one pass: a doubling per bit, and one addition of
+// G, Q or G + Q wherever either scalar has a 1.
+static void shamir(jac_t *r, const fe_t u1, const fe_t u2, const aff_t *q) {
+    aff_t tab[3];
+    int gq_inf;
+
+    tab[0] = G;
+    tab[1] = *q;
+    jac_t t = { .z = {1} };
+    memcpy(t.x, G.x, sizeof(fe_t));
+    memcpy(t.y, G.y, sizeof(fe_t));
+    jac_madd(&t, &t, q);
+    if(!(gq_inf = jac_is_inf(&t)))
+        jac_to_aff(&tab[2], &t);
+
+    memset(r, 0, sizeof *r);
+    int i = 255;
+    while(i >= 0 && !bn_bit(u1, i) && !bn_bit(u2, i))
+        i--;
+    for(; i >= 0; i--) {
+        jac_dbl(r, r);
+        unsigned k = bn_bit(u1, i) | bn_bit(u2, i) << 1;
+        if(k && !(k == 3 && gq_inf))
+            jac_madd(r, r, &tab[k - 1]);
+    }
+}
+
+/***********************************************************
+ * comb tables: with the 256 scalar bits laid out as COMB_TEETH rows
+ * of COMB_D, column j's bits pick one of the 2^teeth - 1 sums of
+ * 2^(i*COMB_D) P, so k P is COMB_D doublings and at most COMB_D
+ * additions.  G's table is built on first use; keys get one each in
+ * the cache below.
+ */
+
+// 63 affine points, ~4k per table: 43 doublings.
+#define COMB_TEETH 6
+#define COMB_D ((256 + COMB_TEETH - 1) / COMB_TEETH)
+#define COMB_N ((1 << COMB_TEETH) - 1)
+
+// r[i] = p[i] in affine, for n points none at infinity: one inversion
+// for all of them (Montgomery's trick).
+static void jac_to_aff_n(aff_t *r, const jac_t *p, unsigned n) {
+    static fe_t acc[COMB_N];
+    fe_t inv, zi, zi2;
+
+    memcpy(acc[0], p[0].z, sizeof(fe_t));
+    for(unsigned i = 1; i < n; i++)
+        fe_mul(acc[i], acc[i-1], p[i].z);
+    fe_inv(inv, acc[n-1]);
+
+    for(unsigned i = n; i-- > 0; ) {
+        if(i) {
+            fe_mul(zi, inv, acc[i-1]);
+            fe_mul(inv, inv, p[i].z);
+        } else
+            memcpy(zi, inv, sizeof(fe_t));
+        fe_sqr(zi2, zi);
+        fe_mul(r[i].x, p[i].x, zi2);
+        fe_mul(zi2, zi2, zi);
+        fe_mul(r[i].y, p[i].y, zi2);
+    }
+}
+
+// tab[idx - 1] = sum of 2^(i * COMB_D) q over the bits i of idx.
+static void comb_build(aff_t *tab, const aff_t *q) {
+    static jac_t t[COMB_N];
+
+    // the teeth: tab[2^i - 1] = 2^(i * COMB_D) q.
+    jac_t p = { .z = {1} };
+    memcpy(p.x, q->x, sizeof(fe_t));
+    memcpy(p.y, q->y, sizeof(fe_t));
+    t[0] = p;
+    for(unsigned i = 1; i < COMB_TEETH; i++) {
+        for(unsigned j = 0; j < COMB_D; j++)
+            jac_dbl(&p, &p);
+        t[(1 << i) - 1] = p;
+    }
+    aff_t teeth[COMB_TEETH];
+    jac_t tj[COMB_TEETH];
+    for(unsigned i = 0; i < COMB_TEETH; i++)
+        tj[i] = t[(1 << i) - 1];
+    jac_to_aff_n(teeth, tj, COMB_TEETH);
+
+    // every other sum is a smaller one plus its top tooth.  the
+    // multipliers are distinct and below 2^258 / 2^43 < n, so none
+    // is infinity.
+    for(unsigned idx = 3; idx <= COMB_N; idx++) {
+        unsigned top = 31 - __builtin_clz(idx), low = idx & ~(1 << top);
+        if(low)
+            jac_madd(&t[idx - 1], &t[low - 1], &teeth[top]);
+    }
+    jac_to_aff_n(tab, t, COMB_N);
+}
+
+static unsigned comb_idx(const fe_t k, unsigned col) {
+    unsigned idx = 0;
+    for(unsigned i = 0; i < COMB_TEETH; i++) {
+        unsigned bit = i * COMB_D + col;
+        if(bit < 256)
+            idx |= bn_bit(k, bit) << i;
+    }
+    return idx;
+}
+
+// sum of k[i] P_i from the P_i's comb tables, sharing the doublings.
+static void comb_n(jac_t *r, const fe_t *k, const aff_t *const *tab, unsigned m) {
+    memset(r, 0, sizeof *r);
+    for(int j = COMB_D - 1; j >= 0; j--) {
+        jac_dbl(r, r);
+        for(unsigned i = 0; i < m; i++) {
+            unsigned idx = comb_idx(k[i], j);
+            if(idx)
+                jac_madd(r, r, &tab[i][idx - 1]);
+        }
+    }
+}
+
+static aff_t g_comb[COMB_N];
+static int g_comb_ok;
+
+static const aff_t *g_table(void) {
+    if(!g_comb_ok) {
+        comb_build(g_comb, &G);
+        g_comb_ok = 1;
+    }
+    return g_comb;
+}
+
+/***********************************************************
+ * the key cache: P256_KEY_CACHE_N slots of (key, comb table), found
+ * by the key's fast_hash32 and evicted least recently used.  kmalloc
+ * has no free, so a slot's table is allocated once and reused.  with
+ * no heap yet (kmalloc_init not called) there is no cache, and
+ * everything goes by Shamir's trick.
+ */
+
+typedef struct {
+    uint32_t hash;
+    uint32_t last_use;      // 0 = empty.
+    uint8_t key[64];
+    aff_t *tab;
+} key_slot_t;
+
+static key_slot_t slots[P256_KEY_CACHE_N ? P256_KEY_CACHE_N : 1];
+static uint32_t use_clock;
+static p256_cache_stats_t stats;
+
+static int cache_on(void) {
+    return P256_KEY_CACHE_N && kmalloc_heap_ptr();
+}
+
+// the table for <pubkey>, building it on a miss; 0 if the key is not
+// on the curve.
+static const aff_t *key_table(const uint8_t pubkey[64]) {
+    uint32_t h = fast_hash32(pubkey, 64);
+    key_slot_t *victim = &slots[0];
+
+    for(unsigned i = 0; i < P256_KEY_CACHE_N; i++) {
+        key_slot_t *k = &slots[i];
+        if(k->last_use && k->hash == h && memcmp(k->key, pubkey, 64) == 0) {
+            k->last_use = ++use_clock;
+            stats.hits++;
+            return k->tab;
+        }
+        if(k->last_use < victim->last_use)
+            victim = k;
+    }
+
+    aff_t q;
+    aff_from_bytes(&q, pubkey);
+    if(!on_curve(&q))
+        return 0;
+
+    stats.misses++;
+    if(victim->last_use)
+        stats.evictions++;
+    if(!victim->tab)
+        victim->tab = kmalloc(COMB_N * sizeof *victim->tab);
+    comb_build(victim->tab, &q);
+    victim->hash = h;
+    memcpy(victim->key, pubkey, 64);
+    victim->last_use = ++use_clock;
+    return victim->tab;
+}
+
+void p256_cache_flush(void) {
+    for(unsigned i = 0; i < P256_KEY_CACHE_N; i++)
+        slots[i].last_use = 0;
+}
+
+p256_cache_stats_t p256_cache_stats(void) {
+    return stats;
+}
+
+/***********************************************************
+ * verification.
+ */
+
+// r and s from <sig> and e from <digest>; 0 if r or s is out of range.
+static int sig_parse(fe_t r, fe_t s, fe_t e, const uint8_t digest[32], const uint8_t sig[64]) {
+    bn_from_bytes(r, sig);
+    bn_from_bytes(s, sig + 32);
+    if(bn_is_zero(r) || bn_is_zero(s) || bn_cmp(r, N) >= 0 || bn_cmp(s, N) >= 0)
+        return 0;
+
+    // e < 2^256 < 2n.
+    bn_from_bytes(e, digest);
+    if(bn_cmp(e, N) >= 0)
+        bn_sub(e, e, N);
+    return 1;
+}
+
+// R = u1 G + u2 Q, through the cache when there is one; 0 if <pubkey>
+// is not on the curve.
+static int sig_point(jac_t *R, const uint8_t pubkey[64], const fe_t u1, const fe_t u2) {
+    if(!cache_on()) {
+        aff_t q;
+        aff_from_bytes(&q, pubkey);
+        if(!on_curve(&q))
+            return 0;
+        shamir(R, u1, u2, &q);
+        return 1;
+    }
+    const aff_t *tab[2] = { g_table(), key_table(pubkey) };
+    if(!tab[1])
+        return 0;
+    fe_t k[2];
+    memcpy(k[0], u1, sizeof(fe_t));
+    memcpy(k[1], u2, sizeof(fe_t));
+    comb_n(R, k, tab, 2);
+    return 1;
+}
+
+// x(R) mod n == r, without inverting z: r z^2 == X, or (r + n) z^2 ==
+// X when r + n is still below p.
+static int x_matches(const jac_t *R, const fe_t r) {
+    if(jac_is_inf(R))
+        return 0;
+    fe_t z2, t;
+    fe_sqr(z2, R->z);
+    fe_mul(t, r, z2);
+    if(bn_cmp(t, R->x) == 0)
+        return 1;
+    if(bn_add(t, r, N) || bn_cmp(t, P) >= 0)
+        return 0;
+    fe_mul(t, t, z2);
+    return bn_cmp(t, R->x) == 0;
+}
+
+int p256_verify_uncached(const uint8_t pubkey[64], const uint8_t digest[32], const uint8_t sig[64]) {
+    fe_t r, s, e, w, u1, u2;
+    aff_t q;
+
+    if(!sig_parse(r, s, e, digest, sig))
+        return 0;
+    aff_from_bytes(&q, pubkey);
+    if(!on_curve(&q))
+        return 0;
+    bn_inv_mod(w, s, N);
+    sc_mul(u1, e, w);
+    sc_mul(u2, r, w);
+
+    jac_t R;
+    shamir(&R, u1, u2, &q);
+    return x_matches(&R, r);
+}
+
+// the verify behind p256_verify and p256_verify_recid.
+static int verify_point(jac_t *R, fe_t r, const uint8_t pubkey[64], const uint8_t digest[32], const uint8_t sig[64]) {
+    fe_t s, e, w, u1, u2;
+    if(!sig_parse(r, s, e, digest, sig))
+        return 0;
+    bn_inv_mod(w, s, N);
+    sc_mul(u1, e, w);
+    sc_mul(u2, r, w);
+    return sig_point(R, pubkey, u1, u2) && x_matches(R, r);
+}
+
+int p256_verify(const uint8_t pubkey[64], const uint8_t digest[32], const uint8_t sig[64]) {
+    fe_t r;
+    jac_t R;
+    return verify_point(&R, r, pubkey, digest, sig);
+}
+
+int p256_verify_recid(const uint8_t pubkey[64], const uint8_t digest[32], const uint8_t sig[64]) {
+    fe_t r;
+    jac_t R;
+    if(!verify_point(&R, r, pubkey, digest, sig))
+        return -1;
+    aff_t a;
+    jac_to_aff(&a, &R);
+    return (a.y[0] & 1) | (bn_cmp(a.x, N) >= 0) << 1;
+}
+
+/***********************************************************
+ * batches.  for items with a recovery id, R is known, so with
+ * random z_i the whole set checks at once:
+ *
+ *     (sum z_i u1_i) G + sum over keys (sum z_i u2_i) Q - sum z_i R_i == 0
+ *
+ * the G and Q terms are one comb pass; the R terms are a Pippenger
+ * multi-scalar multiplication over 128-bit z_i.  a set that fails is
+ * bisected; small sets, and items without a recovery id, verify one
+ * at a time.  either way every s is inverted in one go.
+ */
+
+// sets smaller than this verify one at a time: below it, the square
+// root per item plus Pippenger's bucket sums cost more than they save.
+#define BATCH_AGG_MIN 16
+
+typedef struct {
+    fe_t r, u1, u2, z;
+    aff_t R;                // from the recovery id.
+} batch_ent_t;
+
+static batch_ent_t ents[P256_BATCH_MAX];
+static unsigned idx[P256_BATCH_MAX], solo[P256_BATCH_MAX];
+static p256_batch_stats_t bstats;
+
+// R for recovery id <recid>: the point with x = r (+ n) and y of
+// <recid>'s parity.  0 if there is none.
+static int recover_r(aff_t *R, const fe_t r, int recid) {
+    if(recid < 0 || recid > 3)
+        return 0;
+    memcpy(R->x, r, sizeof(fe_t));
+    if(recid & 2)
+        if(bn_add(R->x, r, N) || bn_cmp(R->x, P) >= 0)
+            return 0;
+
+    fe_t t, y2;
+    fe_sqr(y2, R->x);
+    fe_mul(y2, y2, R->x);
+    fe_add(t, R->x, R->x);
+    fe_add(t, t, R->x);
+    fe_sub(y2, y2, t);
+    fe_add(y2, y2, B);
+    if(!fe_sqrt(R->y, y2))
+        return 0;
+    if((R->y[0] & 1) != (unsigned)(recid & 1))
+        bn_sub(R->y, P, R->y);
+    return 1;
+}
+
+static unsigned pip_digit(const fe_t z, unsigned lo, unsigned c) {
+    unsigned v = 0;
+    for(unsigned i = 0; i < c && lo + i < 128; i++)
+        v |= bn_bit(z, lo + i) << i;
+    return v;
+}
+
+// sum of z_i R_i over ents[idx[lo..hi)]: Pippenger, window <c>.
+static void pippenger(jac_t *acc, unsigned lo, unsigned hi) {
+    static jac_t bucket[63];
+    unsigned n = hi - lo, c = 2, best = ~0u;
+
+    // per window: n mixed adds (~11M) and 2^(c+1) full adds for the
+    // bucket sums (~16M).
+    for(unsigned w = 2; w <= 6; w++) {
+        unsigned cost = (128 + w - 1) / w * (11 * n + 32 * ((1 << w) - 1));
+        if(cost < best) {
+            best = cost;
+            c = w;
+        }
+    }
+    unsigned nb = (1 << c) - 1;
+
+    memset(acc, 0, sizeof *acc);
+    for(int w = (128 + c - 1) / c - 1; w >= 0; w--) {
+        for(unsigned i = 0; i < c; i++)
+            jac_dbl(acc, acc);
+        memset(bucket, 0, nb * sizeof bucket[0]);
+        for(unsigned i = lo; i < hi; i++) {
+            batch_ent_t *e = &ents[idx[i]];
+            unsigned d = pip_digit(e->z, w * c, c);
+            if(d)
+                jac_madd(&bucket[d - 1], &bucket[d - 1], &e->R);
+        }
+        // sum of d * bucket[d - 1], as a running sum of sums.
+        jac_t run, sum;
+        memset(&run, 0, sizeof run);
+        memset(&sum, 0, sizeof sum);
+        for(unsigned d = nb; d > 0; d--) {
+            jac_add(&run, &run, &bucket[d - 1]);
+            jac_add(&sum, &sum, &run);
+        }
+        jac_add(acc, acc, &sum);
+    }
+}
+
+// the aggregate check over ents[idx[lo..hi)].  -1 if it has more
+// keys than the cache can hold at once.
+static int batch_check(const p256_batch_item_t *items, unsigned lo, unsigned hi) {
+    enum { MAXK = P256_KEY_CACHE_N ? P256_KEY_CACHE_N : 1 };
+    const uint8_t *keys[MAXK];
+    const aff_t *tab[MAXK + 1];
+    fe_t k[MAXK + 1] = {{0}}, t;
+    unsigned nk = 0;
+
+    for(unsigned i = lo; i < hi; i++) {
+        batch_ent_t *e = &ents[idx[i]];
+        const uint8_t *q = items[idx[i]].pubkey;
+        unsigned j;
+        for(j = 0; j < nk; j++)
+            if(keys[j] == q || memcmp(keys[j], q, 64) == 0)
+                break;
+        if(j == nk) {
+            if(nk == MAXK)
+                return -1;
+            keys[nk++] = q;
+        }
+        sc_mul(t, e->z, e->u1);
+        sc_add(k[0], k[0], t);
+        sc_mul(t, e->z, e->u2);
+        sc_add(k[j + 1], k[j + 1], t);
+    }
+    // every key was checked on the way in, so none of these fail.
+    // looking them all up after the loop keeps them from evicting
+    // each other.
+    tab[0] = g_table();
+    for(unsigned j = 0; j < nk; j++)
+        tab[j + 1] = key_table(keys[j]);
+
+    jac_t lhs, rhs;
+    comb_n(&lhs, k, tab, nk + 1);
+    pippenger(&rhs, lo, hi);
+    bstats.naggregate++;
+    return jac_eq(&lhs, &rhs);
+}
+
+static int verify_one(const p256_batch_item_t *it, const batch_ent_t *e) {
+    jac_t R;
+    bstats.nsingle++;
+    return sig_point(&R, it->pubkey, e->u1, e->u2) && x_matches(&R, e->r);
+}
+
+// ok[] for ents[idx[lo..hi)].  <bad>: the caller knows one fails.
+static void batch_resolve(const p256_batch_item_t *items, uint8_t *ok, unsigned lo, unsigned hi, int bad) {
+    if(hi - lo < BATCH_AGG_MIN) {
+        for(unsigned i = lo; i < hi; i++)
+            ok[idx[i]] = verify_one(&items[idx[i]], &ents[idx[i]]);
+        return;
+    }
+    if(!bad) {
+        int r = batch_check(items, lo, hi);
+        if(r == 1) {
+            for(unsigned i = lo; i < hi; i++)
+                ok[idx[i]] = 1;
+            return;
+        }
+        bad = (r == 0);
+    }
+    unsigned mid = lo + (hi - lo) / 2;
+    bstats.nsplits++;
+    // if the first half passes, the fault is in the second.
+    batch_resolve(items, ok, lo, mid, 0);
+    int left_ok = 1;
+    for(unsigned i = lo; i < mid; i++)
+        left_ok &= ok[idx[i]];
+    batch_resolve(items, ok, mid, hi, bad && left_ok);
+}
+
+// z_i: 128 bits of SHA-256(SHA-256(the batch) || i), so a batch always
+// checks the same way, on the pi or not, and a forger cannot pick
+// signatures that cancel.
+static void batch_randomizers(const p256_batch_item_t *items, unsigned n) {
+    sha256_ctx_t h;
+    uint8_t seed[36], d[32];
+
+    sha256_init(&h);
+    for(unsigned i = 0; i < n; i++) {
+        uint8_t recid = items[i].recid;
+        sha256_update(&h, items[i].pubkey, 64);
+        sha256_update(&h, items[i].digest, 32);
+        sha256_update(&h, items[i].sig, 64);
+        sha256_update(&h, &recid, 1);
+    }
+    sha256_final(&h, seed);
+
+    for(unsigned i = 0; i < n; i++) {
+        seed[32] = i;
+        seed[33] = i >> 8;
+        seed[34] = i >> 16;
+        seed[35] = i >> 24;
+        sha256(seed, sizeof seed, d);
+        fe_t *z = &ents[i].z;
+        memset(*z, 0, sizeof *z);
+        bn_from_bytes(*z, d);
+        memset(&(*z)[4], 0, 4 * sizeof(uint32_t));
+        (*z)[0] |= 1;
+    }
+}
+
+static unsigned batch_chunk(const p256_batch_item_t *items, unsigned n, uint8_t *ok) {
+    static fe_t s[P256_BATCH_MAX], acc[P256_BATCH_MAX];
+    unsigned nlive = 0, nagg = 0;
+
+    bstats.nbatches++;
+
+    // parse, and bad signatures and keys out of the way.
+    for(unsigned i = 0; i < n; i++) {
+        batch_ent_t *e = &ents[i];
+        aff_t q;
+        ok[i] = 0;
+        if(!sig_parse(e->r, s[i], e->u1, items[i].digest, items[i].sig))
+            continue;
+        aff_from_bytes(&q, items[i].pubkey);
+        if(!on_curve(&q))
+            continue;
+        idx[nlive++] = i;
+    }
+    if(!nlive)
+        return 0;
+
+    // every s^-1 from one inversion (Montgomery's trick).
+    memcpy(acc[0], s[idx[0]], sizeof(fe_t));
+    for(unsigned j = 1; j < nlive; j++)
+        sc_mul(acc[j], acc[j-1], s[idx[j]]);
+    fe_t inv, w;
+    bn_inv_mod(inv, acc[nlive - 1], N);
+    for(unsigned j = nlive; j-- > 0; ) {
+        batch_ent_t *e = &ents[idx[j]];
+        if(j) {
+            sc_mul(w, inv, acc[j-1]);
+            sc_mul(inv, inv, s[idx[j]]);
+        } else
+            memcpy(w, inv, sizeof w);
+        // u1 holds e until here.
+        sc_mul(e->u1, e->u1, w);
+        sc_mul(e->u2, e->r, w);
+    }
+
+    // items with a usable recovery id go to the aggregate, if there
+    // are enough of them to be worth a square root each and key tables
+    // to check them with.
+    unsigned nrec = 0, nsolo = 0;
+    for(unsigned j = 0; j < nlive; j++)
+        nrec += (unsigned)items[idx[j]].recid <= 3;
+    int agg = nrec >= BATCH_AGG_MIN && cache_on();
+    if(agg)
+        batch_randomizers(items, n);
+    for(unsigned j = 0; j < nlive; j++) {
+        unsigned i = idx[j];
+        if(agg && recover_r(&ents[i].R, ents[i].r, items[i].recid))
+            idx[nagg++] = i;
+        else
+            solo[nsolo++] = i;
+    }
+    batch_resolve(items, ok, 0, nagg, 0);
+    for(unsigned j = 0; j < nsolo; j++) {
+        unsigned i = solo[j];
+        ok[i] = verify_one(&items[i], &ents[i]);
+    }
+
+    unsigned nok = 0;
+    for(unsigned i = 0; i < n; i++)
+        nok += ok[i];
+    return nok;
+}
+
+unsigned p256_verify_batch(const p256_batch_item_t *items, unsigned n, uint8_t *ok) {
+    unsigned nok = 0;
+    for(unsigned i = 0; i < n; i += P256_BATCH_MAX) {
+        unsigned m = n - i < P256_BATCH_MAX ? n - i : P256_BATCH_MAX;
+        nok += batch_chunk(items + i, m, ok + i);
+    }
+    return nok;
+}
+
+p256_batch_stats_t p256_batch_stats(void) {
+    return bstats;
+}
@@ -0,0 +1,812 @@
+// secp256k1 ECDSA: see <secp256k1.h>.
+#include "rpi.h"
+#include "secp256k1.h"
+#include "sha256.h"
+#include "bn256.h"
+
+typedef bn_t fe_t;
+
+// k G for secret k: a comb over the 256 bits as COMB_TEETH rows of
+// COMB_D, 63 affine points.
+#define COMB_TEETH 6
+#define COMB_D ((256 + COMB_TEETH - 1) / COMB_TEETH)
+#define COMB_N ((1 << COMB_TEETH) - 1)
+
+// Jacobian (x/z^2, y/z^3); z = 0 is the point at infinity.
+typedef struct { fe_t x, y, z; } jac_t;
+typedef struct { fe_t x, y; } aff_t;
+
+// p = 2^256 - 2^32 - 977.
+static const fe_t P = {
+    0xfffffc2f, 0xfffffffe, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+};
+static const fe_t N = {
+    0xd0364141, 0xbfd25e8c, 0xaf48a03b, 0xbaaedce6,
+    0xfffffffe, 0xffffffff, 0xffffffff, 0xffffffff,
+};
+// (n - 1) / 2: the largest low S.
+static const fe_t N_HALF = {
+    0x681b20a0, 0xdfe92f46, 0x57a4501d, 0x5d576e73,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x7fffffff,
+};
+static const aff_t G = {
+    { 0x16f81798, 0x59f2815b, 0x2dce28d9, 0x029bfcdb,
+      0xce870b07, 0x55a06295, 0xf9dcbbac, 0x79be667e },
+    { 0xfb10d4b8, 0x9c47d08f, 0xa6855419, 0xfd17b448,
+      0x0e1108a8, 0x5da4fbfc, 0x26a3c465, 0x483ada77 },
+};
+// Montgomery constants mod n: -n^-1 mod 2^32 and 2^512 mod n.
+#define N0 0x5588b13f
+static const fe_t N_R2 = {
+    0x67d7d140, 0x896cf214, 0x0e7cf878, 0x741496c2,
+    0x5bcd07c6, 0xe697f5e4, 0x81c69bc5, 0x9d671cd5,
+};
+
+// the endomorphism: lambda (x, y) = (beta x, y), lambda^3 = 1 mod n,
+// beta^3 = 1 mod p.
+static const fe_t BETA = {
+    0x719501ee, 0xc1396c28, 0x12f58995, 0x9cf04975,
+    0xac3434e9, 0x6e64479e, 0x657c0710, 0x7ae96a2b,
+};
+static const fe_t MINUS_LAMBDA = {
+    0xb51283cf, 0xe0cfc810, 0x8ec739c2, 0xa880b9fc,
+    0x77ed9ba4, 0x5ad9e3fd, 0x3fa3cf1f, 0xac9c52b3,
+};
+// splitting k: c1 = round(k g1 / 2^384), c2 = round(k g2 / 2^384),
+// k2 = c1 (-b1) + c2 (-b2), k1 = k - k2 lambda, both mod n and under
+// 2^128 in size (the constants are libsecp256k1's).
+static const fe_t GLV_G1 = {
+    0x45dbb031, 0xe893209a, 0x71e8ca7f, 0x3daa8a14,
+    0x9284eb15, 0xe86c90e4, 0xa7d46bcd, 0x3086d221,
+};
+static const fe_t GLV_G2 = {
+    0x8ac47f71, 0x1571b4ae, 0x9df506c6, 0x221208ac,
+    0x0abfe4c4, 0x6f547fa9, 0x010e8828, 0xe4437ed6,
+};
+static const fe_t GLV_MINUS_B1 = {
+    0x0abfe4c3, 0x6f547fa9, 0x010e8828, 0xe4437ed6,
+};
+static const fe_t GLV_MINUS_B2 = {
+    0x3db1562c, 0xd765cda8, 0x0774346d, 0x8a280ac5,
+    0xfffffffe, 0xffffffff, 0xffffffff, 0xffffffff,
+};
+
+/***********************************************************
+ * arithmetic mod p.  everything stays fully reduced, and the add, sub
+ * and multiplies reduce with masks rather than branches: signing runs
+ * them on the nonce.
+ */
+
+static void fe_add(fe_t r, const fe_t a, const fe_t b) {
+    uint32_t c = bn_add(r, a, b);
+    bn_csub(r, r, c, P);
+}
+
+static void fe_sub(fe_t r, const fe_t a, const fe_t b) {
+    uint32_t c = bn_sub(r, a, b);
+    bn_cadd(r, r, c, P);
+}
+
+static void fe_neg(fe_t r, const fe_t a) {
+    if(bn_is_zero(a))
+        memset(r, 0, sizeof(fe_t));
+    else
+        bn_sub(r, P, a);
+}
+
+// 512 -> 256 bits: 2^256 = 2^32 + 977 mod p, so the high half folds
+// in as hi * 977 + hi << 32, and the few bits that spill out of that
+// fold in again.
+static void fe_reduce(fe_t r, const uint32_t t[16]) {
+    uint64_t c = 0;
+    for(unsigned i = 0; i < 8; i++) {
+        c += (uint64_t)t[i] + (uint64_t)t[8+i] * 977 + (i ? t[7+i] : 0);
+        r[i] = c;
+        c >>= 32;
+    }
+    c += t[15];
+
+    uint64_t d = (uint64_t)r[0] + c * 977;
+    r[0] = d;
+    d = (d >> 32) + r[1] + c;
+    r[1] = d;
+    d >>= 32;
+    for(unsigned i = 2; i < 8; i++) {
+        d += r[i];
+        r[i] = d;
+        d >>= 32;
+    }
+    // wrapped once more: r is tiny, so this cannot carry.
+    uint32_t w = d;
+    d = (uint64_t)r[0] + (977 & -w);
+    r[0] = d;
+    r[1] += w + (uint32_t)(d >> 32);
+    bn_csub(r, r, 0, P);
+}
+
+static void fe_mul(fe_t r, const fe_t a, const fe_t b) {
+    uint32_t t[16];
+    bn_mul(t, a, b);
+    fe_reduce(r, t);
+}
+
+static void fe_sqr(fe_t r, const fe_t a) {
+    uint32_t t[16];
+    bn_sqr(t, a);
+    fe_reduce(r, t);
+}
+
+// a^(2^n) mod p.
+static void fe_sqr_n(fe_t r, const fe_t a, unsigned n) {
+    fe_sqr(r, a);
+    while(--n)
+        fe_sqr(r, r);
+}
+
+// a^-1 = a^(p-2) mod p: 255 squarings and 15 multiplies whatever <a>
+// is (libsecp256k1's chain), for the z of a secret multiple.
+static void fe_inv_ct(fe_t r, const fe_t a) {
+    fe_t x2, x3, x6, x9, x11, x22, x44, x88, x176, x220, x223, t;
+
+    fe_sqr(x2, a);
+    fe_mul(x2, x2, a);
+    fe_sqr(x3, x2);
+    fe_mul(x3, x3, a);
+    fe_sqr_n(x6, x3, 3);
+    fe_mul(x6, x6, x3);
+    fe_sqr_n(x9, x6, 3);
+    fe_mul(x9, x9, x3);
+    fe_sqr_n(x11, x9, 2);
+    fe_mul(x11, x11, x2);
+    fe_sqr_n(x22, x11, 11);
+    fe_mul(x22, x22, x11);
+    fe_sqr_n(x44, x22, 22);
+    fe_mul(x44, x44, x22);
+    fe_sqr_n(x88, x44, 44);
+    fe_mul(x88, x88, x44);
+    fe_sqr_n(x176, x88, 88);
+    fe_mul(x176, x176, x88);
+    fe_sqr_n(x220, x176, 44);
+    fe_mul(x220, x220, x44);
+    fe_sqr_n(x223, x220, 3);
+    fe_mul(x223, x223, x3);
+
+    fe_sqr_n(t, x223, 23);
+    fe_mul(t, t, x22);
+    fe_sqr_n(t, t, 5);
+    fe_mul(t, t, a);
+    fe_sqr_n(t, t, 3);
+    fe_mul(t, t, x2);
+    fe_sqr_n(t, t, 2);
+    fe_mul(r, t, a);
+}
+
+/***********************************************************
+ * arithmetic mod n.
+ */
+
+static void sc_mont_mul(fe_t r, const fe_t a, const fe_t b) {
+    bn_mont_mul(r, a, b, N, N0);
+}
+
+// a * b mod n.
+static void sc_mul(fe_t r, const fe_t a, const fe_t b) {
+    fe_t t;
+    sc_mont_mul(t, a, b);
+    sc_mont_mul(r, t, N_R2);
+}
+
+static void sc_add(fe_t r, const fe_t a, const fe_t b) {
+    uint32_t c = bn_add(r, a, b);
+    bn_csub(r, r, c, N);
+}
+
+static void sc_neg(fe_t r, const fe_t a) {
+    if(bn_is_zero(a))
+        memset(r, 0, sizeof(fe_t));
+    else
+        bn_sub(r, N, a);
+}
+
+// a^-1 = a^(n-2) mod n: the same squarings and multiplies whatever
+// <a> is, for the secret nonce.
+static void sc_inv_ct(fe_t r, const fe_t a) {
+    static const fe_t one = {1}, two = {2};
+    fe_t e, am, x;
+    bn_sub(e, N, two);
+    sc_mont_mul(am, a, N_R2);
+    sc_mont_mul(x, one, N_R2);
+    for(int i = 255; i >= 0; i--) {
+        sc_mont_mul(x, x, x);
+        if(bn_bit(e, i))
+            sc_mont_mul(x, x, am);
+    }
+    sc_mont_mul(r, x, one);
+}
+
+// a mod n, for a < 2^256 < 2n.
+static void sc_from_bytes(fe_t r, const uint8_t b[32]) {
+    bn_from_bytes(r, b);
+    bn_csub(r, r, 0, N);
+}
+
+/***********************************************************
+ * points.
+ */
+
+static int jac_is_inf(const jac_t *p) {
+    return bn_is_zero(p->z);
+}
+
+static void jac_from_aff(jac_t *r, const aff_t *a) {
+    memcpy(r->x, a->x, sizeof(fe_t));
+    memcpy(r->y, a->y, sizeof(fe_t));
+    memset(r->z, 0, sizeof(fe_t));
+    r->z[0] = 1;
+}
+
+// a = 0 doubling: 2M + 5S (dbl-2009-l).  <r> may be <p>.
+static void jac_dbl(jac_t *r, const jac_t *p) {
+    if(jac_is_inf(p)) {
+        *r = *p;
+        return;
+    }
+    fe_t a, b, c, d, e, f, t;
+
+    fe_sqr(a, p->x);
+    fe_sqr(b, p->y);
+    fe_sqr(c, b);
+    // d = 2 ((x + b)^2 - a - c)
+    fe_add(t, p->x, b);
+    fe_sqr(t, t);
+    fe_sub(t, t, a);
+    fe_sub(t, t, c);
+    fe_add(d, t, t);
+    fe_add(e, a, a);
+    fe_add(e, e, a);
+    fe_sqr(f, e);
+
+    // z3 = 2 y z, before y goes.
+    fe_mul(t, p->y, p->z);
+    fe_add(r->z, t, t);
+    // x3 = f - 2d
+    fe_sub(t, f, d);
+    fe_sub(r->x, t, d);
+    // y3 = e (d - x3) - 8c
+    fe_sub(t, d, r->x);
+    fe_mul(t, e, t);
+    fe_add(c, c, c);
+    fe_add(c, c, c);
+    fe_add(c, c, c);
+    fe_sub(r->y, t, c);
+}
+
+// r = p + q, q affine: 8M + 3S.  <r> may be <p>.
+static void jac_madd(jac_t *r, const jac_t *p, const aff_t *q) {
+    if(jac_is_inf(p)) {
+        jac_from_aff(r, q);
+        return;
+    }
+    fe_t z1z1, u2, s2, h, rr, hh, hhh, v, t;
+
+    fe_sqr(z1z1, p->z);
+    fe_mul(u2, q->x, z1z1);
+    fe_mul(s2, q->y, p->z);
+    fe_mul(s2, s2, z1z1);
+    fe_sub(h, u2, p->x);
+    fe_sub(rr, s2, p->y);
+
+    if(bn_is_zero(h)) {
+        // same x: p == q doubles, p == -q is infinity.
+        if(bn_is_zero(rr)) {
+            jac_t qj;
+            jac_from_aff(&qj, q);
+            jac_dbl(r, &qj);
+        } else
+            memset(r->z, 0, sizeof(fe_t));
+        return;
+    }
+
+    fe_sqr(hh, h);
+    fe_mul(hhh, h, hh);
+    fe_mul(v, p->x, hh);
+    fe_mul(t, p->y, hhh);
+
+    fe_mul(r->z, p->z, h);
+    // x3 = rr^2 - h^3 - 2v
+    fe_sqr(u2, rr);
+    fe_sub(u2, u2, hhh);
+    fe_sub(u2, u2, v);
+    fe_sub(r->x, u2, v);
+    // y3 = rr (v - x3) - y1 h^3
+    fe_sub(v, v, r->x);
+    fe_mul(v, rr, v);
+    fe_sub(r->y, v, t);
+}
+
+static void jac_to_aff(aff_t *r, const jac_t *p) {
+    fe_t zi, zi2;
+    bn_inv_mod(zi, p->z, P);
+    fe_sqr(zi2, zi);
+    fe_mul(r->x, p->x, zi2);
+    fe_mul(zi2, zi2, zi);
+    fe_mul(r->y, p->y, zi2);
+}
+
+// jac_to_aff for a secret multiple: the inversion takes the same time
+// whatever z is.
+static void jac_to_aff_ct(aff_t *r, const jac_t *p) {
+    fe_t zi, zi2;
+    fe_inv_ct(zi, p->z);
+    fe_sqr(zi2, zi);
+    fe_mul(r->x, p->x, zi2);
+    fe_mul(zi2, zi2, zi);
+    fe_mul(r->y, p->y, zi2);
+}
+
+// r[i] = p[i] in affine, none at infinity: one inversion for all.
+static void jac_to_aff_n(aff_t *r, const jac_t *p, unsigned n) {
+    static fe_t acc[COMB_N];
+    fe_t inv, zi, zi2;
+
+    memcpy(acc[0], p[0].z, sizeof(fe_t));
+    for(unsigned i = 1; i < n; i++)
+        fe_mul(acc[i], acc[i-1], p[i].z);
+    bn_inv_mod(inv, acc[n-1], P);
+
+    for(unsigned i = n; i-- > 0; ) {
+        if(i) {
+            fe_mul(zi, inv, acc[i-1]);
+            fe_mul(inv, inv, p[i].z);
+        } else
+            memcpy(zi, inv, sizeof(fe_t));
+        fe_sqr(zi2, zi);
+        fe_mul(r[i].x, p[i].x, zi2);
+        fe_mul(zi2, zi2, zi);
+        fe_mul(r[i].y, p[i].y, zi2);
+    }
+}
+
+static int on_curve(const aff_t *q) {
+    if(bn_cmp(q->x, P) >= 0 || bn_cmp(q->y, P) >= 0)
+        return 0;
+    // y^2 = x^3 + 7
+    static const fe_t seven = {7};
+    fe_t l, r;
+    fe_sqr(l, q->y);
+    fe_sqr(r, q->x);
+    fe_mul(r, r, q->x);
+    fe_add(r, r, seven);
+    return bn_cmp(l, r) == 0;
+}
+
+/***********************************************************
+ * k G for secret k: 43 doublings and additions.
+ */
+
+static aff_t g_comb[COMB_N];
+// -(2^COMB_D G): takes mul_g's starting G back off.
+static aff_t g_comb_off;
+static int g_comb_ok;
+
+// tab[idx - 1] = sum of 2^(i * COMB_D) G over the bits i of idx.
+static const aff_t *g_comb_table(void) {
+    if(g_comb_ok)
+        return g_comb;
+
+    static jac_t t[COMB_N];
+    jac_t p;
+    jac_from_aff(&p, &G);
+    t[0] = p;
+    for(unsigned i = 1; i < COMB_TEETH; i++) {
+        for(unsigned j = 0; j < COMB_D; j++)
+            jac_dbl(&p, &p);
+        t[(1 << i) - 1] = p;
+    }
+    jac_t tj[COMB_TEETH];
+    aff_t teeth[COMB_TEETH];
+    for(unsigned i = 0; i < COMB_TEETH; i++)
+        tj[i] = t[(1 << i) - 1];
+    jac_to_aff_n(teeth, tj, COMB_TEETH);
+    for(unsigned idx = 3; idx <= COMB_N; idx++) {
+        unsigned top = 31 - __builtin_clz(idx), low = idx & ~(1 << top);
+        if(low)
+            jac_madd(&t[idx - 1], &t[low - 1], &teeth[top]);
+    }
+
+    jac_to_aff_n(g_comb, t, COMB_N);
+    memcpy(g_comb_off.x, g_comb[1].x, sizeof(fe_t));
+    fe_neg(g_comb_off.y, g_comb[1].y);
+    g_comb_ok = 1;
+    return g_comb;
+}
+
+// r = <m> ? a : b, without a branch on <m>.
+static void fe_select(fe_t r, uint32_t m, const fe_t a, const fe_t b) {
+    for(unsigned i = 0; i < 8; i++)
+        r[i] = (a[i] & m) | (b[i] & ~m);
+}
+
+// tab[idx - 1] (or tab[0] for idx 0), reading every entry.
+static void comb_lookup(aff_t *r, const aff_t *tab, unsigned idx) {
+    memset(r, 0, sizeof *r);
+    idx += !idx;
+    for(unsigned i = 1; i <= COMB_N; i++) {
+        uint32_t m = -(uint32_t)(i == idx);
+        for(unsigned j = 0; j < 8; j++) {
+            r->x[j] |= tab[i-1].x[j] & m;
+            r->y[j] |= tab[i-1].y[j] & m;
+        }
+    }
+}
+
+// k G, for 0 < k < n: the same table reads, doublings and additions
+// whatever k's bits.  r starts at G rather than infinity, so neither
+// jac_dbl nor jac_madd takes its infinity shortcut for the nonce's
+// leading zero columns; the D doublings turn that G into 2^COMB_D G,
+// which comes off at the end.  (jac_madd still branches if r and the
+// entry share an x, which no k hits but with negligible odds.)
+static void mul_g(jac_t *r, const fe_t k) {
+    const aff_t *tab = g_comb_table();
+    aff_t e;
+    jac_t t;
+
+    jac_from_aff(r, &G);
+    for(int j = COMB_D - 1; j >= 0; j--) {
+        jac_dbl(r, r);
+        unsigned idx = 0;
+        for(unsigned i = 0; i < COMB_TEETH; i++) {
+            unsigned bit = i * COMB_D + j;
+            if(bit < 256)
+                idx |= bn_bit(k, bit) << i;
+        }
+        comb_lookup(&e, tab, idx);
+        jac_madd(&t, r, &e);
+        uint32_t m = -(uint32_t)(idx != 0);
+        fe_select(r->x, m, t.x, r->x);
+        fe_select(r->y, m, t.y, r->y);
+        fe_select(r->z, m, t.z, r->z);
+    }
+    jac_madd(r, r, &g_comb_off);
+}
+
+/***********************************************************
+ * u1 G + u2 Q for verifying: GLV halves as width-5 NAFs.
+ */
+
+#define WNAF_W 5
+#define WNAF_N (1 << (WNAF_W - 2))      // odd multiples 1P .. 15P.
+#define WNAF_LEN 136
+
+// k = k1 + k2 lambda mod n, with |k1|, |k2| < 2^128: k_i holds the
+// magnitude and neg_i the sign.
+static void glv_split(fe_t k1, int *neg1, fe_t k2, int *neg2, const fe_t k) {
+    uint32_t t[16];
+    fe_t c1, c2;
+
+    // round(k g / 2^384): the top 128 bits, plus bit 383.
+    bn_mul(t, k, GLV_G1);
+    memset(c1, 0, sizeof c1);
+    memcpy(c1, &t[12], 4 * sizeof(uint32_t));
+    if(t[11] >> 31) {
+        static const fe_t one = {1};
+        bn_add(c1, c1, one);
+    }
+    bn_mul(t, k, GLV_G2);
+    memset(c2, 0, sizeof c2);
+    memcpy(c2, &t[12], 4 * sizeof(uint32_t));
+    if(t[11] >> 31) {
+        static const fe_t one = {1};
+        bn_add(c2, c2, one);
+    }
+
+    sc_mul(c1, c1, GLV_MINUS_B1);
+    sc_mul(c2, c2, GLV_MINUS_B2);
+    sc_add(k2, c1, c2);
+    sc_mul(k1, k2, MINUS_LAMBDA);
+    sc_add(k1, k1, k);
+
+    if((*neg1 = bn_cmp(k1, N_HALF) > 0))
+        sc_neg(k1, k1);
+    if((*neg2 = bn_cmp(k2, N_HALF) > 0))
+        sc_neg(k2, k2);
+}
+
+// k as a width-WNAF_W NAF, least significant digit first: every
+// nonzero digit is odd and followed by WNAF_W - 1 zeros.  returns the
+// number of digits.
+static unsigned wnaf(int8_t *naf, const fe_t kin) {
+    fe_t k, d;
+    unsigned n = 0;
+    memcpy(k, kin, sizeof k);
+    memset(d, 0, sizeof d);
+
+    while(!bn_is_zero(k)) {
+        int v = 0;
+        if(k[0] & 1) {
+            v = k[0] & ((1 << WNAF_W) - 1);
+            if(v >= 1 << (WNAF_W - 1))
+                v -= 1 << WNAF_W;
+            if(v > 0) {
+                d[0] = v;
+                bn_sub(k, k, d);
+            } else {
+                d[0] = -v;
+                bn_add(k, k, d);
+            }
+        }
+        assert(n < WNAF_LEN);
+        naf[n++] = v;
+        bn_shr1(k, 0);
+    }
+    return n;
+}
+
+// tab[i] = (2i + 1) q.
+static void odd_multiples(aff_t *tab, const aff_t *q) {
+    jac_t t[WNAF_N], q2j;
+    aff_t q2;
+
+    jac_from_aff(&q2j, q);
+    jac_dbl(&q2j, &q2j);
+    jac_to_aff(&q2, &q2j);
+    jac_from_aff(&t[0], q);
+    for(unsigned i = 1; i < WNAF_N; i++)
+        jac_madd(&t[i], &t[i-1], &q2);
+    jac_to_aff_n(tab, t, WNAF_N);
+}
+
+// lambda P for each P in <tab>: (beta x, y).
+static void lambda_table(aff_t *r, const aff_t *tab) {
+    for(unsigned i = 0; i < WNAF_N; i++) {
+        fe_mul(r[i].x, tab[i].x, BETA);
+        memcpy(r[i].y, tab[i].y, sizeof(fe_t));
+    }
+}
+
+static void add_digit(jac_t *r, const aff_t *tab, int d, int neg) {
+    aff_t e = tab[(d < 0 ? -d : d) >> 1];
+    if((d < 0) != neg)
+        fe_neg(e.y, e.y);
+    jac_madd(r, r, &e);
+}
+
+// u1 G + u2 Q: four half-length scalars against G, lambda G, Q,
+// lambda Q, sharing ~130 doublings.
+static void mul_double(jac_t *r, const fe_t u1, const fe_t u2, const aff_t *q) {
+    static aff_t g_tab[WNAF_N], gl_tab[WNAF_N];
+    static int g_tab_ok;
+    aff_t q_tab[WNAF_N], ql_tab[WNAF_N];
+    const aff_t *tabs[4] = { g_tab, gl_tab, q_tab, ql_tab };
+
+    if(!g_tab_ok) {
+        odd_multiples(g_tab, &G);
+        lambda_table(gl_tab, g_tab);
+        g_tab_ok = 1;
+    }
+    odd_multiples(q_tab, q);
+    lambda_table(ql_tab, q_tab);
+
+    fe_t k[4];
+    int neg[4];
+    glv_split(k[0], &neg[0], k[1], &neg[1], u1);
+    glv_split(k[2], &neg[2], k[3], &neg[3], u2);
+
+    int8_t naf[4][WNAF_LEN];
+    unsigned len[4], top = 0;
+    for(unsigned i = 0; i < 4; i++) {
+        len[i] = wnaf(naf[i], k[i]);
+        if(len[i] > top)
+            top = len[i];
+    }
+
+    memset(r, 0, sizeof *r);
+    for(int b = top - 1; b >= 0; b--) {
+        jac_dbl(r, r);
+        for(unsigned i = 0; i < 4; i++)
+            if((unsigned)b < len[i] && naf[i][b])
+                add_digit(r, tabs[i], naf[i][b], neg[i]);
+    }
+}
+
+/***********************************************************
+ * keys, signing and verifying.
+ */
+
+int secp256k1_key_init(secp256k1_key_t *k, const uint8_t priv[32]) {
+    fe_t d;
+    bn_from_bytes(d, priv);
+    if(bn_is_zero(d) || bn_cmp(d, N) >= 0)
+        return 0;
+
+    jac_t R;
+    aff_t a;
+    mul_g(&R, d);
+    jac_to_aff_ct(&a, &R);
+    memcpy(k->priv, priv, 32);
+    bn_to_bytes(k->pubkey, a.x);
+    bn_to_bytes(k->pubkey + 32, a.y);
+    sha256_wipe(d, sizeof d);
+    return 1;
+}
+
+void secp256k1_key_wipe(secp256k1_key_t *k) {
+    sha256_wipe(k, sizeof *k);
+}
+
+// RFC 6979 3.2: the HMAC-DRBG seeded with the key and the digest.
+typedef struct {
+    uint8_t k[32], v[32];
+} rfc6979_t;
+
+static void rfc6979_init(rfc6979_t *g, const uint8_t priv[32], const uint8_t h1[32]) {
+    hmac_sha256_ctx_t c;
+    memset(g->v, 0x01, 32);
+    memset(g->k, 0x00, 32);
+    for(uint8_t sep = 0; sep < 2; sep++) {
+        hmac_sha256_init(&c, g->k, 32);
+        hmac_sha256_update(&c, g->v, 32);
+        hmac_sha256_update(&c, &sep, 1);
+        hmac_sha256_update(&c, priv, 32);
+        hmac_sha256_update(&c, h1, 32);
+        hmac_sha256_final(&c, g->k);
+        hmac_sha256(g->k, 32, g->v, 32, g->v);
+    }
+    sha256_wipe(&c, sizeof c);
+}
+
+// the next candidate nonce (step h): k in [1, n).
+static void rfc6979_next(rfc6979_t *g, fe_t k, int retry) {
+    if(retry) {
+        uint8_t zero = 0;
+        hmac_sha256_ctx_t c;
+        hmac_sha256_init(&c, g->k, 32);
+        hmac_sha256_update(&c, g->v, 32);
+        hmac_sha256_update(&c, &zero, 1);
+        hmac_sha256_final(&c, g->k);
+        hmac_sha256(g->k, 32, g->v, 32, g->v);
+        sha256_wipe(&c, sizeof c);
+    }
+    hmac_sha256(g->k, 32, g->v, 32, g->v);
+    bn_from_bytes(k, g->v);
+}
+
+int secp256k1_sign(const secp256k1_key_t *key, const uint8_t digest[32], uint8_t sig[64]) {
+    fe_t d, e, k, r, s, t;
+    uint8_t h1[32];
+    rfc6979_t g;
+    int recid = -1;
+
+    bn_from_bytes(d, key->priv);
+    if(bn_is_zero(d) || bn_cmp(d, N) >= 0)
+        return -1;
+    sc_from_bytes(e, digest);
+    bn_to_bytes(h1, e);
+    rfc6979_init(&g, key->priv, h1);
+
+    for(int retry = 0; ; retry = 1) {
+        rfc6979_next(&g, k, retry);
+        if(bn_is_zero(k) || bn_cmp(k, N) >= 0)
+            continue;
+
+        jac_t R;
+        aff_t a;
+        mul_g(&R, k);
+        jac_to_aff_ct(&a, &R);
+        recid = (a.y[0] & 1) | (bn_cmp(a.x, N) >= 0) << 1;
+        memcpy(r, a.x, sizeof r);
+        if(bn_cmp(r, N) >= 0)
+            bn_sub(r, r, N);
+        if(bn_is_zero(r))
+            continue;
+
+        // s = k^-1 (e + r d)
+        sc_mul(t, r, d);
+        sc_add(t, t, e);
+        sc_inv_ct(k, k);
+        sc_mul(s, k, t);
+        if(bn_is_zero(s))
+            continue;
+        break;
+    }
+
+    // low S: -s signs the same, with R negated.
+    if(bn_cmp(s, N_HALF) > 0) {
+        sc_neg(s, s);
+        recid ^= 1;
+    }
+    bn_to_bytes(sig, r);
+    bn_to_bytes(sig + 32, s);
+
+    sha256_wipe(d, sizeof d);
+    sha256_wipe(k, sizeof k);
+    sha256_wipe(t, sizeof t);
+    sha256_wipe(&g, sizeof g);
+    return recid;
+}
+
+int secp256k1_verify(const uint8_t pubkey[64], const uint8_t digest[32], const uint8_t sig[64]) {
+    fe_t r, s, e, w, u1, u2;
+    aff_t q;
+
+    bn_from_bytes(r, sig);
+    bn_from_bytes(s, sig + 32);
+    if(bn_is_zero(r) || bn_is_zero(s) || bn_cmp(r, N) >= 0 || bn_cmp(s, N) >= 0)
+        return 0;
+    bn_from_bytes(q.x, pubkey);
+    bn_from_bytes(q.y, pubkey + 32);
+    if(!on_curve(&q))
+        return 0;
+
+    sc_from_bytes(e, digest);
+    bn_inv_mod(w, s, N);
+    sc_mul(u1, e, w);
+    sc_mul(u2, r, w);
+
+    jac_t R;
+    mul_double(&R, u1, u2, &q);
+    if(jac_is_inf(&R))
+        return 0;
+
+    // x(R) mod n == r, without inverting z.
+    fe_t z2, t;
+    fe_sqr(z2, R.z);
+    fe_mul(t, r, z2);
+    if(bn_cmp(t, R.x) == 0)
+        return 1;
+    if(bn_add(t, r, N) || bn_cmp(t, P) >= 0)
+        return 0;
+    fe_mul(t, t, z2);
+    return bn_cmp(t, R.x) == 0;
+}
+
+/***********************************************************
+ * sealing.
+ */
+
+static void seal_keys(uint8_t kenc[32], uint8_t kmac[32], const uint8_t kek[32]) {
+    hmac_sha256(kek, 32, "secp256k1 seal enc", 18, kenc);
+    hmac_sha256(kek, 32, "secp256k1 seal mac", 18, kmac);
+}
+
+static void seal_tag(uint8_t tag[32], const uint8_t kmac[32], const secp256k1_sealed_t *s) {
+    hmac_sha256_ctx_t c;
+    hmac_sha256_init(&c, kmac, 32);
+    hmac_sha256_update(&c, s->nonce, sizeof s->nonce);
+    hmac_sha256_update(&c, s->ct, sizeof s->ct);
+    hmac_sha256_final(&c, tag);
+    sha256_wipe(&c, sizeof c);
+}
+
+void secp256k1_seal(secp256k1_sealed_t *out, const uint8_t kek[32],
+                    const uint8_t priv[32], const uint8_t nonce[16]) {
+    uint8_t kenc[32], kmac[32], ks[32];
+    seal_keys(kenc, kmac, kek);
+    memcpy(out->nonce, nonce, sizeof out->nonce);
+    hmac_sha256(kenc, 32, out->nonce, sizeof out->nonce, ks);
+    for(unsigned i = 0; i < 32; i++)
+        out->ct[i] = priv[i] ^ ks[i];
+    seal_tag(out->tag, kmac, out);
+
+    sha256_wipe(kenc, sizeof kenc);
+    sha256_wipe(kmac, sizeof kmac);
+    sha256_wipe(ks, sizeof ks);
+}
+
+int secp256k1_unseal(uint8_t priv[32], const uint8_t kek[32], const secp256k1_sealed_t *in) {
+    uint8_t kenc[32], kmac[32], ks[32], tag[32], diff = 0;
+    seal_keys(kenc, kmac, kek);
+    seal_tag(tag, kmac, in);
+    for(unsigned i = 0; i < 32; i++)
+        diff |= tag[i] ^ in->tag[i];
+
+    hmac_sha256(kenc, 32, in->nonce, sizeof in->nonce, ks);
+    for(unsigned i = 0; i < 32; i++)
+        priv[i] = diff ? 0 : in->ct[i] ^ ks[i];
+
+    sha256_wipe(kenc, sizeof kenc);
+    sha256_wipe(kmac, sizeof kmac);
+    sha256_wipe(ks, sizeof ks);
+    return diff == 0;
+}
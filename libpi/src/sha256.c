@@ -0,0 +1,219 @@
+// software SHA-256: see <sha256.h>.
+#include "rpi.h"
+#include "sha256.h"
+
+static const uint32_t K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+// the barrel shifter does these for free as an operand.
+#define ROR(x, n)   (((x) >> (n)) | ((x) << (32 - (n))))
+#define S0(x)       (ROR(x, 2) ^ ROR(x, 13) ^ ROR(x, 22))
+#define S1(x)       (ROR(x, 6) ^ ROR(x, 11) ^ ROR(x, 25))
+#define s0(x)       (ROR(x, 7) ^ ROR(x, 18) ^ ((x) >> 3))
+#define s1(x)       (ROR(x, 17) ^ ROR(x, 19) ^ ((x) >> 10))
+// one fewer op each than the textbook forms.
+#define CH(e, f, g)     ((g) ^ ((e) & ((f) ^ (g))))
+#define MAJ(a, b, c)    (((a) & (b)) | ((c) & ((a) | (b))))
+
+// a round without moving the eight working variables: the caller
+// rotates their names instead.
+#define R(a, b, c, d, e, f, g, h, w, k) do {                    \
+    h += S1(e) + CH(e, f, g) + (k) + (w);                       \
+    d += h;                                                     \
+    h += S0(a) + MAJ(a, b, c);                                  \
+} while(0)
+
+// 16 rounds over the current schedule window, constants from <k>.
+#define ROUNDS16(k) do {                                        \
+    R(a, b, c, d, e, f, g, h, w0,  (k)[0]);                     \
+    R(h, a, b, c, d, e, f, g, w1,  (k)[1]);                     \
+    R(g, h, a, b, c, d, e, f, w2,  (k)[2]);                     \
+    R(f, g, h, a, b, c, d, e, w3,  (k)[3]);                     \
+    R(e, f, g, h, a, b, c, d, w4,  (k)[4]);                     \
+    R(d, e, f, g, h, a, b, c, w5,  (k)[5]);                     \
+    R(c, d, e, f, g, h, a, b, w6,  (k)[6]);                     \
+    R(b, c, d, e, f, g, h, a, w7,  (k)[7]);                     \
+    R(a, b, c, d, e, f, g, h, w8,  (k)[8]);                     \
+    R(h, a, b, c, d, e, f, g, w9,  (k)[9]);                     \
+    R(g, h, a, b, c, d, e, f, w10, (k)[10]);                    \
+    R(f, g, h, a, b, c, d, e, w11, (k)[11]);                    \
+    R(e, f, g, h, a, b, c, d, w12, (k)[12]);                    \
+    R(d, e, f, g, h, a, b, c, w13, (k)[13]);                    \
+    R(c, d, e, f, g, h, a, b, w14, (k)[14]);                    \
+    R(b, c, d, e, f, g, h, a, w15, (k)[15]);                    \
+} while(0)
+
+// the next 16 schedule words, in place: w[i] += s1(w[i-2]) + w[i-7]
+// + s0(w[i-15]), indices mod 16.
+#define W(i, i2, i7, i15)   i += s1(i2) + i7 + s0(i15)
+#define SCHED16() do {                                          \
+    W(w0,  w14, w9,  w1);  W(w1,  w15, w10, w2);                \
+    W(w2,  w0,  w11, w3);  W(w3,  w1,  w12, w4);                \
+    W(w4,  w2,  w13, w5);  W(w5,  w3,  w14, w6);                \
+    W(w6,  w4,  w15, w7);  W(w7,  w5,  w0,  w8);                \
+    W(w8,  w6,  w1,  w9);  W(w9,  w7,  w2,  w10);               \
+    W(w10, w8,  w3,  w11); W(w11, w9,  w4,  w12);               \
+    W(w12, w10, w5,  w13); W(w13, w11, w6,  w14);               \
+    W(w14, w12, w7,  w15); W(w15, w13, w8,  w0);                \
+} while(0)
+
+// big-endian words from an aligned block: REV on armv6.
+#define LD(i)   __builtin_bswap32(in[i])
+
+static void compress(uint32_t st[8], const uint32_t *in) {
+    uint32_t a = st[0], b = st[1], c = st[2], d = st[3],
+             e = st[4], f = st[5], g = st[6], h = st[7];
+    uint32_t w0  = LD(0),  w1  = LD(1),  w2  = LD(2),  w3  = LD(3),
+             w4  = LD(4),  w5  = LD(5),  w6  = LD(6),  w7  = LD(7),
+             w8  = LD(8),  w9  = LD(9),  w10 = LD(10), w11 = LD(11),
+             w12 = LD(12), w13 = LD(13), w14 = LD(14), w15 = LD(15);
+
+    ROUNDS16(K);
+    SCHED16();
+    ROUNDS16(K + 16);
+    SCHED16();
+    ROUNDS16(K + 32);
+    SCHED16();
+    ROUNDS16(K + 48);
+
+    st[0] += a; st[1] += b; st[2] += c; st[3] += d;
+    st[4] += e; st[5] += f; st[6] += g; st[7] += h;
+}
+
+void sha256_blocks(uint32_t h[8], const void *p, unsigned nblocks) {
+    const uint8_t *b = p;
+    if((uintptr_t)b % 4 == 0) {
+        for(; nblocks; nblocks--, b += 64)
+            compress(h, (const uint32_t *)b);
+        return;
+    }
+    // unaligned: one copy per block beats four byte loads per word.
+    uint32_t tmp[16];
+    for(; nblocks; nblocks--, b += 64) {
+        memcpy(tmp, b, 64);
+        compress(h, tmp);
+    }
+}
+
+void sha256_init(sha256_ctx_t *c) {
+    static const uint32_t iv[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+        0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+    };
+    memcpy(c->h, iv, sizeof iv);
+    c->nbytes = 0;
+    c->nbuf = 0;
+}
+
+void sha256_update(sha256_ctx_t *c, const void *data, unsigned n) {
+    const uint8_t *p = data;
+    uint8_t *buf = (uint8_t *)c->buf;
+    c->nbytes += n;
+
+    if(c->nbuf) {
+        unsigned k = 64 - c->nbuf < n ? 64 - c->nbuf : n;
+        memcpy(buf + c->nbuf, p, k);
+        c->nbuf += k;
+        p += k;
+        n -= k;
+        if(c->nbuf < 64)
+            return;
+        compress(c->h, c->buf);
+        c->nbuf = 0;
+    }
+    // whole blocks straight from the caller.
+    if(n >= 64) {
+        sha256_blocks(c->h, p, n / 64);
+        p += n & ~63;
+        n &= 63;
+    }
+    memcpy(buf, p, n);
+    c->nbuf = n;
+}
+
+void sha256_final(sha256_ctx_t *c, uint8_t digest[32]) {
+    uint8_t *buf = (uint8_t *)c->buf;
+    uint64_t bits = c->nbytes * 8;
+    unsigned n = c->nbuf;
+
+    buf[n++] = 0x80;
+    // no room for the 8-byte length: pad this block out, start another.
+    if(n > 56) {
+        memset(buf + n, 0, 64 - n);
+        compress(c->h, c->buf);
+        n = 0;
+    }
+    memset(buf + n, 0, 56 - n);
+    c->buf[14] = __builtin_bswap32(bits >> 32);
+    c->buf[15] = __builtin_bswap32(bits);
+    compress(c->h, c->buf);
+
+    for(unsigned i = 0; i < 8; i++) {
+        uint32_t x = c->h[i];
+        digest[4*i]   = x >> 24;
+        digest[4*i+1] = x >> 16;
+        digest[4*i+2] = x >> 8;
+        digest[4*i+3] = x;
+    }
+}
+
+void sha256(const void *msg, unsigned n, uint8_t digest[32]) {
+    sha256_ctx_t c;
+    sha256_init(&c);
+    sha256_update(&c, msg, n);
+    sha256_final(&c, digest);
+}
+
+void hmac_sha256_init(hmac_sha256_ctx_t *c, const void *key, unsigned keylen) {
+    uint8_t k[64], pad[64];
+    memset(k, 0, sizeof k);
+    if(keylen > sizeof k)
+        sha256(key, keylen, k);
+    else
+        memcpy(k, key, keylen);
+
+    for(unsigned i = 0; i < 64; i++)
+        pad[i] = k[i] ^ 0x36;
+    sha256_init(&c->inner);
+    sha256_update(&c->inner, pad, 64);
+    for(unsigned i = 0; i < 64; i++)
+        pad[i] = k[i] ^ 0x5c;
+    sha256_init(&c->outer);
+    sha256_update(&c->outer, pad, 64);
+    sha256_wipe(k, sizeof k);
+    sha256_wipe(pad, sizeof pad);
+}
+
+void hmac_sha256_update(hmac_sha256_ctx_t *c, const void *data, unsigned n) {
+    sha256_update(&c->inner, data, n);
+}
+
+void hmac_sha256_final(hmac_sha256_ctx_t *c, uint8_t mac[32]) {
+    uint8_t d[32];
+    sha256_final(&c->inner, d);
+    sha256_update(&c->outer, d, 32);
+    sha256_final(&c->outer, mac);
+    sha256_wipe(d, sizeof d);
+}
+
+void hmac_sha256(const void *key, unsigned keylen, const void *msg, unsigned n, uint8_t mac[32]) {
+    hmac_sha256_ctx_t c;
+    hmac_sha256_init(&c, key, keylen);
+    hmac_sha256_update(&c, msg, n);
+    hmac_sha256_final(&c, mac);
+    sha256_wipe(&c, sizeof c);
+}
+
+void sha256_wipe(void *p, unsigned n) {
+    volatile uint8_t *v = p;
+    for(unsigned i = 0; i < n; i++)
+        v[i] = 0;
+}
@@ -0,0 +1,211 @@
+// bit-banged i2c master: see <sw-i2c.h>.
+#include "rpi.h"
+#include "sw-i2c.h"
+#include "cycle-count.h"
+#include "cycle-util.h"
+
+#define CPU_HZ (700 * 1000 * 1000)
+
+// open drain: pull the line low, or let go of it.
+static inline void line_low(unsigned pin) {
+    gpio_set_output(pin);
+}
+static inline void line_release(unsigned pin) {
+    gpio_set_input(pin);
+}
+
+// wait out half a period from <*t> and restart the count from there,
+// so small per-bit overheads do not add up.
+static inline void half(sw_i2c_t *h, unsigned *t) {
+    delay_ncycles(*t, h->cyc_per_half);
+    *t += h->cyc_per_half;
+}
+
+// let SCL go and wait for it to get high: the slave may be holding
+// it low (clock stretching).  restarts the timing from when it rose.
+static int scl_release(sw_i2c_t *h, unsigned *t) {
+    line_release(h->scl);
+    if(gpio_read(h->scl))
+        return 0;
+    unsigned s = cycle_cnt_read(), limit = h->stretch_usec * (CPU_HZ / 1000000);
+    while(!gpio_read(h->scl))
+        if(cycle_cnt_read() - s >= limit)
+            return SW_I2C_ERR_CLKT;
+    *t = cycle_cnt_read();
+    return 0;
+}
+
+// SDA is set while SCL is low; the slave samples it while SCL is high.
+static int bit_write(sw_i2c_t *h, unsigned *t, unsigned b) {
+    if(b)
+        line_release(h->sda);
+    else
+        line_low(h->sda);
+    half(h, t);
+    int r = scl_release(h, t);
+    if(r < 0)
+        return r;
+    half(h, t);
+    line_low(h->scl);
+    return 0;
+}
+
+// returns the bit or < 0.
+static int bit_read(sw_i2c_t *h, unsigned *t) {
+    line_release(h->sda);
+    half(h, t);
+    int r = scl_release(h, t);
+    if(r < 0)
+        return r;
+    int b = gpio_read(h->sda);
+    half(h, t);
+    line_low(h->scl);
+    return b;
+}
+
+// msb first, then the slave's ACK (SDA low).
+static int byte_write(sw_i2c_t *h, unsigned *t, uint8_t b) {
+    int r;
+    for(int i = 7; i >= 0; i--)
+        if((r = bit_write(h, t, (b >> i) & 1)) < 0)
+            return r;
+    if((r = bit_read(h, t)) < 0)
+        return r;
+    return r ? SW_I2C_ERR_NACK : 0;
+}
+
+// we ACK every byte but the last.
+static int byte_read(sw_i2c_t *h, unsigned *t, int last_p) {
+    int r, b = 0;
+    for(int i = 0; i < 8; i++) {
+        if((r = bit_read(h, t)) < 0)
+            return r;
+        b = (b << 1) | r;
+    }
+    if((r = bit_write(h, t, last_p)) < 0)
+        return r;
+    return b;
+}
+
+// SDA falls while SCL is high.  also a repeated START: from SCL low,
+// bring both lines back up first.
+static int start(sw_i2c_t *h, unsigned *t) {
+    line_release(h->sda);
+    half(h, t);
+    int r = scl_release(h, t);
+    if(r < 0)
+        return r;
+    if(!gpio_read(h->sda))
+        return SW_I2C_ERR_BUSY;
+    half(h, t);
+    line_low(h->sda);
+    half(h, t);
+    line_low(h->scl);
+    return 0;
+}
+
+// SDA rises while SCL is high.  the lines end up released even if the
+// slave misbehaves.
+static int stop(sw_i2c_t *h, unsigned *t) {
+    line_low(h->sda);
+    half(h, t);
+    int r = scl_release(h, t);
+    half(h, t);
+    line_release(h->sda);
+    half(h, t);
+    line_release(h->scl);
+    return r;
+}
+
+// START + address byte.
+static int addr(sw_i2c_t *h, unsigned *t, unsigned a, int read_p) {
+    int r = start(h, t);
+    if(r < 0)
+        return r;
+    return byte_write(h, t, (a << 1) | (read_p != 0));
+}
+
+// finish the transfer with a STOP: the first error wins.
+static int finish(sw_i2c_t *h, unsigned *t, int r) {
+    int s = stop(h, t);
+    return r < 0 ? r : s < 0 ? s : r;
+}
+
+static int do_write(sw_i2c_t *h, unsigned *t, const uint8_t *data, unsigned n) {
+    for(unsigned i = 0; i < n; i++) {
+        int r = byte_write(h, t, data[i]);
+        if(r < 0)
+            return r;
+    }
+    return n;
+}
+
+static int do_read(sw_i2c_t *h, unsigned *t, uint8_t *data, unsigned n) {
+    for(unsigned i = 0; i < n; i++) {
+        int b = byte_read(h, t, i == n - 1);
+        if(b < 0)
+            return b;
+        data[i] = b;
+    }
+    return n;
+}
+
+int sw_i2c_write(sw_i2c_t *h, unsigned a, const uint8_t *data, unsigned nbytes) {
+    unsigned t = cycle_cnt_read();
+    int r = addr(h, &t, a, 0);
+    if(r == SW_I2C_ERR_BUSY)
+        return r;
+    if(r >= 0)
+        r = do_write(h, &t, data, nbytes);
+    return finish(h, &t, r);
+}
+
+int sw_i2c_read(sw_i2c_t *h, unsigned a, uint8_t *data, unsigned nbytes) {
+    unsigned t = cycle_cnt_read();
+    int r = addr(h, &t, a, 1);
+    if(r == SW_I2C_ERR_BUSY)
+        return r;
+    if(r >= 0)
+        r = do_read(h, &t, data, nbytes);
+    return finish(h, &t, r);
+}
+
+int sw_i2c_write_read(sw_i2c_t *h, unsigned a,
+                      const uint8_t *wdata, unsigned wn,
+                      uint8_t *rdata, unsigned rn) {
+    unsigned t = cycle_cnt_read();
+    int r = addr(h, &t, a, 0);
+    if(r == SW_I2C_ERR_BUSY)
+        return r;
+    if(r >= 0)
+        r = do_write(h, &t, wdata, wn);
+    // repeated START: no STOP in between.
+    if(r >= 0)
+        r = addr(h, &t, a, 1);
+    if(r >= 0)
+        r = do_read(h, &t, rdata, rn);
+    return finish(h, &t, r);
+}
+
+sw_i2c_t sw_i2c_init(unsigned scl, unsigned sda, unsigned hz) {
+    assert(scl < 32 && sda < 32 && scl != sda);
+    assert(hz && hz <= 1000 * 1000);
+
+    cycle_cnt_init();
+
+    // output latches stay 0: switching to output pulls the line low.
+    gpio_set_input(scl);
+    gpio_set_input(sda);
+    gpio_set_off(scl);
+    gpio_set_off(sda);
+    gpio_set_pullup(scl);
+    gpio_set_pullup(sda);
+
+    return (sw_i2c_t) {
+        .scl = scl,
+        .sda = sda,
+        .hz = hz,
+        .cyc_per_half = CPU_HZ / (2 * hz),
+        .stretch_usec = SW_I2C_STRETCH_USEC,
+    };
+}
@@ -41,6 +41,11 @@ static inline uint32_t fast_hash_inc32(const void * _data, uint32_t len, uint32_
     return hash;
 }
 
+// same as libpi's: for whole words the remainder case never runs.
+static inline uint32_t fast_hash32(const void * data, uint32_t len) {
+    return fast_hash_inc32(data, len, len);
+}
+
 // put your extra libc prototypes here.
 uint32_t fast_hash(const void *data, uint32_t len);
 uint32_t fast_hash_inc(const void * _data, uint32_t len, uint32_t hash);
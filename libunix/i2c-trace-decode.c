@@ -0,0 +1,152 @@
+// decode the binary i2c trace dump from proj/1-i2c/i2c-trace.h and
+// print a latency histogram for each phase transition.
+//
+// the dump is usually buried in captured uart output, so we scan
+// for the magic rather than expecting it at the start.
+#include <stdio.h>
+#include <string.h>
+
+#include "libunix.h"
+
+#define TRACE_MAGIC     0x54433249      // "I2CT"
+#define HDR_BYTES       12
+#define REC_BYTES       12
+#define NPHASE          6               // phases are 1..5
+#define NBUCKET         32
+
+static const char *phase_name[NPHASE] = {
+    "?", "begin", "start", "last", "done", "err"
+};
+
+typedef struct {
+    unsigned n;
+    uint64_t sum, bytes;
+    uint32_t min, max;
+    unsigned hist[NBUCKET];             // by log2(cycles).
+} lat_t;
+
+static uint32_t get32le(const uint8_t *p) {
+    return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+static uint16_t get16le(const uint8_t *p) {
+    return p[0] | p[1] << 8;
+}
+
+static unsigned log2_bucket(uint32_t x) {
+    unsigned b = 0;
+    while(x >>= 1)
+        b++;
+    return b;
+}
+
+static void lat_add(lat_t *l, uint32_t cyc, unsigned nbytes) {
+    if(!l->n || cyc < l->min)
+        l->min = cyc;
+    if(cyc > l->max)
+        l->max = cyc;
+    l->n++;
+    l->sum += cyc;
+    l->bytes += nbytes;
+    l->hist[log2_bucket(cyc)]++;
+}
+
+static void lat_print(const char *name, lat_t *l, unsigned cyc_per_usec) {
+    if(!l->n)
+        return;
+    uint64_t avg = l->sum / l->n;
+    uint64_t avg_us10 = avg * 10 / cyc_per_usec;
+    printf("%-14s n=%-5u min=%-8u avg=%-8llu max=%-8u cycles (avg %llu.%llu usec)",
+        name, l->n, l->min, (unsigned long long)avg, l->max,
+        (unsigned long long)(avg_us10 / 10), (unsigned long long)(avg_us10 % 10));
+    if(l->bytes)
+        printf(", %llu cycles/byte", (unsigned long long)(l->sum / l->bytes));
+    printf("\n");
+
+    unsigned most = 0;
+    for(unsigned b = 0; b < NBUCKET; b++)
+        if(l->hist[b] > most)
+            most = l->hist[b];
+    for(unsigned b = 0; b < NBUCKET; b++) {
+        if(!l->hist[b])
+            continue;
+        unsigned bar = (l->hist[b] * 40 + most - 1) / most;
+        printf("    [%10u, %10u) %5u ", 1u << b, b == 31 ? ~0u : 1u << (b + 1), l->hist[b]);
+        while(bar--)
+            putchar('#');
+        putchar('\n');
+    }
+}
+
+int i2c_trace_decode(const void *buf, unsigned n, unsigned cyc_per_usec) {
+    const uint8_t *p = buf, *end = p + n;
+    demand(cyc_per_usec, "cycles per usec cannot be 0");
+
+    // find the header.
+    for(; p + HDR_BYTES <= end; p++)
+        if(get32le(p) == TRACE_MAGIC)
+            break;
+    if(p + HDR_BYTES > end)
+        return -1;
+
+    unsigned nrec = get32le(p + 4), ndropped = get32le(p + 8);
+    p += HDR_BYTES;
+    if(p + nrec * REC_BYTES > end) {
+        unsigned have = (end - p) / REC_BYTES;
+        printf("i2c trace: truncated: %u of %u records\n", have, nrec);
+        nrec = have;
+    }
+    printf("i2c trace: %u records", nrec);
+    if(ndropped)
+        printf(" (%u older ones overwritten)", ndropped);
+    printf("\n");
+
+    lat_t lat[NPHASE][NPHASE], total;
+    memset(lat, 0, sizeof lat);
+    memset(&total, 0, sizeof total);
+
+    // <prev> is the last event of the transfer in progress; <begin>
+    // is its first.
+    int have_prev = 0;
+    uint32_t prev_cyc = 0, begin_cyc = 0;
+    unsigned prev_phase = 0, nbytes = 0, nerr = 0;
+
+    for(unsigned i = 0; i < nrec; i++, p += REC_BYTES) {
+        uint32_t cyc = get32le(p);
+        unsigned phase = p[9], arg = get16le(p + 10);
+        if(!phase || phase >= NPHASE) {
+            printf("i2c trace: record %u: bad phase %u, stopping\n", i, phase);
+            break;
+        }
+
+        if(phase == 1) {
+            begin_cyc = cyc;
+            nbytes = 0;
+        } else if(have_prev) {
+            // only the data phase is per-byte.
+            unsigned bytes = (phase == 3) ? arg : 0;
+            lat_add(&lat[prev_phase][phase], cyc - prev_cyc, bytes);
+            if(phase == 3)
+                nbytes += arg;
+        }
+        if(phase == 4 && have_prev)
+            lat_add(&total, cyc - begin_cyc, nbytes);
+        if(phase == 5)
+            nerr++;
+
+        // a transfer ends at DONE or ERR.
+        have_prev = (phase != 4 && phase != 5);
+        prev_phase = phase;
+        prev_cyc = cyc;
+    }
+
+    char name[32];
+    for(unsigned a = 1; a < NPHASE; a++)
+        for(unsigned b = 1; b < NPHASE; b++) {
+            snprintf(name, sizeof name, "%s->%s", phase_name[a], phase_name[b]);
+            lat_print(name, &lat[a][b], cyc_per_usec);
+        }
+    lat_print("total", &total, cyc_per_usec);
+    if(nerr)
+        printf("i2c trace: %u failed transfers\n", nerr);
+    return nrec;
+}
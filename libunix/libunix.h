@@ -176,6 +176,13 @@ void close_open_fds(void);
 
 #include "fast-hash32.h"
 
+// find the binary i2c trace dump (see proj/1-i2c/i2c-trace.h) in
+// <buf> (e.g., raw captured uart output) and print a latency
+// histogram for each phase transition.  <cyc_per_usec> is the
+// pi's cycle rate (700 on the pi zero).  returns the number of
+// records decoded, -1 if there is no dump.
+int i2c_trace_decode(const void *buf, unsigned n, unsigned cyc_per_usec);
+
 // look for a pi binary in "./" or colon-seperated list in
 // <PI_PATH> 
 const char *find_pi_binary(const char *name);
@@ -0,0 +1,203 @@
+// several ATECC608As on one bus: see <atecc-bus.h>.
+#include "atecc-bus.h"
+#include "atecc-exec.h"
+#include "i2c-log.h"
+
+static atecc_dev_t devs[ATECC_BUS_MAX];
+static unsigned ndevs;
+
+atecc_dev_t *atecc_bus_add(uint8_t addr) {
+    for(unsigned i = 0; i < ndevs; i++)
+        if(devs[i].addr == addr)
+            panic("atecc at %x added twice\n", addr);
+    if(ndevs == ATECC_BUS_MAX)
+        panic("more than %d atecc devices\n", ATECC_BUS_MAX);
+
+    atecc_dev_t *d = &devs[ndevs++];
+    memset(d, 0, sizeof *d);
+    d->addr = addr;
+    return d;
+}
+
+unsigned atecc_bus_ndev(void) { return ndevs; }
+
+atecc_dev_t *atecc_bus_dev(unsigned i) {
+    assert(i < ndevs);
+    return &devs[i];
+}
+
+// read <d>'s wake token after a pulse.
+static int dev_woke(atecc_dev_t *d) {
+    uint8_t buf[4];
+    d->awake = i2c_read(d->addr, buf, sizeof buf) == sizeof buf
+        && buf[0] == 0x04 && buf[1] == 0x11;
+    d->op = 0;
+    if(d->awake)
+        d->woke_at = timer_get_usec();
+    return d->awake;
+}
+
+int atecc_bus_wake(void) {
+    // a pulse does nothing to a chip that is already awake, and its
+    // watchdog keeps running from whenever it woke: idle everyone
+    // first (asleep ones just NACK) so all start a fresh one.
+    for(unsigned i = 0; i < ndevs; i++) {
+        uint8_t idle_cmd = 0x02;
+        i2c_write(devs[i].addr, &idle_cmd, 1);
+    }
+    atecc_wake_pulse();
+    i2c_init();
+
+    int n = 0;
+    for(unsigned i = 0; i < ndevs; i++)
+        n += dev_woke(&devs[i]);
+    return n;
+}
+
+// idle and re-wake idle device <d> if a command of up to <usec> would
+// run past its watchdog (which would put it to sleep mid-batch), as
+// session_refresh does for the single-chip driver.  the pulse reaches
+// every chip, but the busy ones are awake already and ignore it.
+// returns 0, or -1 if <d> did not come back.
+static int dev_refresh(atecc_dev_t *d, unsigned usec) {
+    uint32_t up = timer_get_usec() - d->woke_at;
+    if(up + usec + ATECC_WATCHDOG_MARGIN_USEC < ATECC_WATCHDOG_USEC)
+        return 0;
+    d->nrefreshes++;
+    uint8_t idle_cmd = 0x02;
+    i2c_write(d->addr, &idle_cmd, 1);
+    atecc_wake_pulse();
+    i2c_init();
+    if(!dev_woke(d)) {
+        LOG_ERROR("atecc %x: did not wake after idle\n", d->addr);
+        return -1;
+    }
+    return 0;
+}
+
+void atecc_bus_sleep(void) {
+    for(unsigned i = 0; i < ndevs; i++) {
+        uint8_t sleep_cmd = 0x01;
+        i2c_write(devs[i].addr, &sleep_cmd, 1);
+        devs[i].awake = 0;
+        devs[i].op = 0;
+    }
+}
+
+int atecc_dev_submit(atecc_dev_t *d, uint8_t cmd, uint8_t p1, uint16_t p2,
+                     const uint8_t *data, uint8_t data_len) {
+    assert(!d->op);
+    int r = atecc_cmd_send(d->addr, cmd, p1, p2, data, data_len);
+    if(r < 0)
+        return r;
+    d->op = cmd;
+    d->mode = p1;
+    d->nacked = 0;
+    d->sent = timer_get_usec();
+    d->busy_until = d->sent + atecc_exec_wait_usec(cmd, p1);
+    return 0;
+}
+
+int atecc_dev_poll(atecc_dev_t *d) {
+    if(!d->op)
+        return 0;
+    uint32_t now = timer_get_usec();
+    if((int32_t)(now - d->busy_until) < 0)
+        return 0;
+
+    d->npolls++;
+    int r = atecc_cmd_recv(d->addr, d->resp, sizeof d->resp);
+    // still executing: come back later.
+    if(r == I2C_ERR_NACK) {
+        if(now - d->sent <= atecc_exec_max_usec(d->op, d->mode)) {
+            d->busy_until = now + ATECC_POLL_USEC;
+            d->nacked = 1;
+            return 0;
+        }
+        r = I2C_ERR_TIMEOUT;
+    } else if(r > 4 || (r == 4 && d->resp[1] == ATECC_ST_OK))
+        // a payload, or a status saying it ran: error statuses say
+        // nothing about how long the command takes.
+        atecc_exec_record(d->op, d->mode, now - d->sent, !d->nacked);
+    d->status = r;
+    d->last_op = d->op;
+    d->op = 0;
+    d->nops++;
+    return 1;
+}
+
+// give up on a batch: forget what is in flight.  a chip that is still
+// executing NACKs until it is done, which the next submit reports.
+static int sign_fail(int r) {
+    for(unsigned i = 0; i < ndevs; i++)
+        devs[i].op = 0;
+    return r;
+}
+
+int atecc_bus_sign(uint16_t key_id, const uint8_t (*digest)[32],
+                   uint8_t (*sig)[64], uint8_t *who, unsigned n) {
+    // the digest each chip is working on.
+    unsigned job[ATECC_BUS_MAX];
+    unsigned next = 0, ndone = 0;
+    unsigned pair_usec = atecc_exec_max_usec(ATECC_CMD_NONCE, 0x03)
+                       + atecc_exec_max_usec(ATECC_CMD_SIGN, 0x80);
+    int r;
+
+    for(unsigned i = 0; i < ndevs; i++)
+        if(devs[i].op)
+            panic("atecc %x still has op %x running\n", devs[i].addr, devs[i].op);
+
+    while(ndone < n) {
+        for(unsigned i = 0; i < ndevs; i++) {
+            atecc_dev_t *d = &devs[i];
+            if(!d->awake)
+                continue;
+
+            if(d->op) {
+                if(!atecc_dev_poll(d))
+                    continue;
+                if(d->status < 0)
+                    return sign_fail(d->status);
+
+                // NONCE done: TempKey holds the digest, sign it.
+                if(d->last_op == ATECC_CMD_NONCE) {
+                    if(d->resp[1] != 0x00) {
+                        LOG_ERROR("atecc %x: NONCE failed with error: %x\n", d->addr, d->resp[1]);
+                        return sign_fail(-1);
+                    }
+                    // Mode 0x80: use TempKey as the source of the digest
+                    if((r = atecc_dev_submit(d, ATECC_CMD_SIGN, 0x80, key_id, 0, 0)) < 0)
+                        return sign_fail(r);
+                    continue;
+                }
+
+                // SIGN done: count + 64 bytes + CRC, or an error status.
+                if(d->status != 67) {
+                    LOG_ERROR("atecc %x: SIGN failed with error: %x\n", d->addr, d->resp[1]);
+                    return sign_fail(-1);
+                }
+                memcpy(sig[job[i]], &d->resp[1], 64);
+                if(who)
+                    who[job[i]] = d->addr;
+                ndone++;
+            }
+
+            // chip is free: hand it the next digest, if its watchdog
+            // leaves room for the pair.  one that does not come back
+            // drops out and the others carry on.
+            if(next < n) {
+                if(dev_refresh(d, pair_usec) < 0)
+                    continue;
+                job[i] = next++;
+                if((r = atecc_dev_submit(d, ATECC_CMD_NONCE, 0x03, 0x0000,
+                                digest[job[i]], 32)) < 0)
+                    return sign_fail(r);
+            }
+        }
+        if(ndone < n && next == ndone) {
+            LOG_ERROR("no awake atecc to sign with\n");
+            return sign_fail(-1);
+        }
+    }
+    return n;
+}
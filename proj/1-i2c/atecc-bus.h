@@ -0,0 +1,78 @@
+#ifndef __ATECC_BUS_H__
+#define __ATECC_BUS_H__
+// several ATECC608As on one I2C bus.
+//
+// a SIGN keeps the chip busy for tens of milliseconds and the bus
+// idle.  the bus manager splits every command into send / collect
+// (atecc_cmd_send / atecc_cmd_recv) and keeps per-device state, so
+// while one chip computes the bus feeds and drains the others.
+// everything is polled: nothing blocks on a single device.
+//
+// each chip needs its own address (the I2C_Address byte in its
+// config zone); a wake pulse on SDA wakes all of them at once.  each
+// chip's watchdog runs from its own wake, so a long batch idles and
+// re-wakes a chip before a NONCE+SIGN that would run past it.
+#include "atecc608a.h"
+
+#define ATECC_BUS_MAX 8
+
+// a result is first looked for after the command's expected time
+// (atecc-exec.h); the device NACKs until it is done, after which we
+// retry every ATECC_POLL_USEC.
+#define ATECC_POLL_USEC     200
+
+typedef struct {
+    uint8_t addr;
+    uint8_t awake;
+    // when it last woke (timer_get_usec()): the watchdog runs from here.
+    uint32_t woke_at;
+
+    // command executing (0 = none) and its mode, and the one that
+    // finished last.
+    uint8_t op, mode, last_op;
+    // <op> has NACKed at least one poll.
+    uint8_t nacked;
+    // when it went out, and don't poll before this (timer_get_usec()).
+    uint32_t sent, busy_until;
+
+    // result of <last_op>: response length or < 0 (I2C_ERR_*).
+    int status;
+    uint8_t resp[ATECC_RESP_MAX];
+
+    // stats.
+    unsigned nops,      // commands completed.
+             npolls,    // collect attempts, incl. NACKed ones.
+             nrefreshes; // idle+wakes to stay clear of the watchdog.
+} atecc_dev_t;
+
+// put a chip at <addr> under the manager.
+atecc_dev_t *atecc_bus_add(uint8_t addr);
+unsigned atecc_bus_ndev(void);
+atecc_dev_t *atecc_bus_dev(unsigned i);
+
+// wake every chip: returns how many answered.
+int atecc_bus_wake(void);
+// put every chip to sleep.
+void atecc_bus_sleep(void);
+
+// start a command on idle device <d>.  returns 0 or < 0 (I2C_ERR_*).
+int atecc_dev_submit(atecc_dev_t *d, uint8_t cmd, uint8_t p1, uint16_t p2,
+                     const uint8_t *data, uint8_t data_len);
+
+// try to collect <d>'s result if it should be ready.  returns 1 when
+// the command finished (result in d->status / d->resp, op in
+// d->last_op), 0 if it is still running or there is nothing to do.
+// a command still NACKing past its datasheet max finishes with
+// I2C_ERR_TIMEOUT.
+int atecc_dev_poll(atecc_dev_t *d);
+
+// sign the <n> digests in <digest> with <key_id> on every chip, each
+// NONCE+SIGN pair going to whichever chip is free, so throughput
+// scales with the number of chips.  all chips must hold the same key
+// (or the caller must know which chip signed what: <who>, if not 0,
+// gets the address per signature).  returns <n> or < 0, including
+// when no chip is awake to sign with.
+int atecc_bus_sign(uint16_t key_id, const uint8_t (*digest)[32],
+                   uint8_t (*sig)[64], uint8_t *who, unsigned n);
+
+#endif
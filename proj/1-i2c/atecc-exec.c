@@ -0,0 +1,89 @@
+// per-opcode execution times: see <atecc-exec.h>.
+#include "rpi.h"
+#include "atecc608a.h"
+#include "atecc-exec.h"
+
+#define MS(x) ((x) * 1000)
+
+// max is the datasheet worst case (default clock divider).  typ is
+// where we start before anything has been observed: the datasheet
+// typical where it gives one, otherwise about half the max.  more
+// specific modes come first: the first match wins.
+static atecc_exec_t exec_table[] = {
+    { ATECC_CMD_CHECKMAC,  0x00, 0x00, MS(5),   MS(40)  },
+    { ATECC_CMD_COUNTER,   0x00, 0x00, MS(5),   MS(25)  },
+    { ATECC_CMD_DERIVEKEY, 0x00, 0x00, MS(20),  MS(50)  },
+    { ATECC_CMD_ECDH,      0x00, 0x00, MS(38),  MS(75)  },
+    { ATECC_CMD_GENDIG,    0x00, 0x00, MS(5),   MS(25)  },
+    { ATECC_CMD_GENKEY,    0x00, 0x00, MS(59),  MS(115) },
+    { ATECC_CMD_INFO,      0x00, 0x00, 200,     MS(5)   },
+    { ATECC_CMD_LOCK,      0x00, 0x00, MS(8),   MS(35)  },
+    { ATECC_CMD_MAC,       0x00, 0x00, MS(5),   MS(55)  },
+    // pass-through just copies into TempKey; the others run the RNG.
+    { ATECC_CMD_NONCE,     0x03, 0x03, 200,     MS(20)  },
+    { ATECC_CMD_NONCE,     0x00, 0x00, MS(7),   MS(20)  },
+    { ATECC_CMD_PRIVWRITE, 0x00, 0x00, MS(20),  MS(50)  },
+    { ATECC_CMD_RANDOM,    0x00, 0x00, MS(2),   MS(23)  },
+    { ATECC_CMD_READ,      0x00, 0x00, 200,     MS(5)   },
+    { ATECC_CMD_SHA,       0x00, 0x00, MS(1),   MS(36)  },
+    { ATECC_CMD_SIGN,      0x00, 0x00, MS(50),  MS(115) },
+    { ATECC_CMD_VERIFY,    0x00, 0x00, MS(58),  MS(105) },
+    { ATECC_CMD_WRITE,     0x00, 0x00, MS(7),   MS(45)  },
+};
+
+// anything not in the table.
+static atecc_exec_t exec_default = { 0, 0x00, 0x00, MS(1), MS(250) };
+
+static atecc_exec_t *exec_lookup(uint8_t opcode, uint8_t mode) {
+    for (unsigned i = 0; i < sizeof exec_table / sizeof exec_table[0]; i++) {
+        atecc_exec_t *e = &exec_table[i];
+        if (e->opcode == opcode && (mode & e->mode_mask) == e->mode_val)
+            return e;
+    }
+    return &exec_default;
+}
+
+unsigned atecc_exec_wait_usec(uint8_t opcode, uint8_t mode) {
+    atecc_exec_t *e = exec_lookup(opcode, mode);
+    if (!e->n)
+        return e->typ_usec;
+    // wake a little before the average: ACK polling a few times is
+    // cheap, sleeping past the result is not.
+    return e->avg_usec - e->avg_usec / 16;
+}
+
+unsigned atecc_exec_max_usec(uint8_t opcode, uint8_t mode) {
+    return exec_lookup(opcode, mode)->max_usec;
+}
+
+void atecc_exec_record(uint8_t opcode, uint8_t mode, unsigned usec, int first_poll) {
+    atecc_exec_t *e = exec_lookup(opcode, mode);
+
+    // overslept: all we know is it is faster than we thought, so
+    // step down 1/8 and look earlier next time.  otherwise we polled
+    // for it, <usec> is within a poll of the truth: average it in.
+    unsigned est = first_poll ? usec - usec / 8 : usec;
+    if (!e->n++)
+        e->avg_usec = est;
+    else if (first_poll)
+        e->avg_usec = est < e->avg_usec ? est : e->avg_usec - e->avg_usec / 8;
+    else
+        e->avg_usec = (int)e->avg_usec + ((int)est - (int)e->avg_usec) / 8;
+
+    if (e->n == 1 || usec < e->min_usec)
+        e->min_usec = usec;
+    if (usec > e->hi_usec)
+        e->hi_usec = usec;
+}
+
+void atecc_exec_dump(void) {
+    printk("opcode mode: typ max | n avg min max (usec)\n");
+    for (unsigned i = 0; i < sizeof exec_table / sizeof exec_table[0]; i++) {
+        atecc_exec_t *e = &exec_table[i];
+        if (!e->n)
+            continue;
+        printk("  %x %x/%x: %d %d | %d %d %d %d\n",
+            e->opcode, e->mode_val, e->mode_mask, e->typ_usec, e->max_usec,
+            e->n, e->avg_usec, e->min_usec, e->hi_usec);
+    }
+}
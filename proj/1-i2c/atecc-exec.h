@@ -0,0 +1,37 @@
+#ifndef __ATECC_EXEC_H__
+#define __ATECC_EXEC_H__
+// how long ATECC608A commands take to execute, per opcode and mode.
+//
+// the driver waits about the expected time, then ACK-polls (the chip
+// NACKs its address until the result is ready) until the max.  each
+// completion is recorded, and the expected time follows what the
+// chip actually does, so we neither poll for tens of ms nor sleep
+// tens of ms past the result.
+#include <stdint.h>
+
+typedef struct {
+    uint8_t opcode;
+    // applies when (mode & mode_mask) == mode_val.
+    uint8_t mode_mask, mode_val;
+    // starting estimate and the datasheet worst case (usec).
+    uint32_t typ_usec, max_usec;
+
+    // observed: count, smoothed estimate, min and max.
+    uint32_t n, avg_usec, min_usec, hi_usec;
+} atecc_exec_t;
+
+// first look for the result this long after the command went out.
+unsigned atecc_exec_wait_usec(uint8_t opcode, uint8_t mode);
+// past this, the command is not going to finish.
+unsigned atecc_exec_max_usec(uint8_t opcode, uint8_t mode);
+
+// the result of <opcode>/<mode> was ready <usec> after it was sent.
+// <first_poll>: it was already there the first time we looked, so
+// <usec> is only an upper bound and we waited too long.  only for a
+// command that ran: an error response can come back at any time.
+void atecc_exec_record(uint8_t opcode, uint8_t mode, unsigned usec, int first_poll);
+
+// print the table with what has been seen.
+void atecc_exec_dump(void);
+
+#endif
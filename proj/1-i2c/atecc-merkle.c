@@ -0,0 +1,161 @@
+// Merkle batch signing: see <atecc-merkle.h>.
+#include "rpi.h"
+#include "atecc-merkle.h"
+#include "atecc608a.h"
+#include "sha256.h"
+#include "p256.h"
+#include "i2c-log.h"
+
+enum { TAG_LEAF = 0x00, TAG_NODE = 0x01, TAG_ROOT = 0x02 };
+
+static void hash_leaf(uint8_t out[32], const uint8_t digest[32]) {
+    sha256_ctx_t c;
+    uint8_t tag = TAG_LEAF;
+    sha256_init(&c);
+    sha256_update(&c, &tag, 1);
+    sha256_update(&c, digest, 32);
+    sha256_final(&c, out);
+}
+
+static void hash_node(uint8_t out[32], const uint8_t l[32], const uint8_t r[32]) {
+    sha256_ctx_t c;
+    uint8_t tag = TAG_NODE;
+    sha256_init(&c);
+    sha256_update(&c, &tag, 1);
+    sha256_update(&c, l, 32);
+    sha256_update(&c, r, 32);
+    sha256_final(&c, out);
+}
+
+static void put_be32(uint8_t *p, uint32_t x) {
+    p[0] = x >> 24;
+    p[1] = x >> 16;
+    p[2] = x >> 8;
+    p[3] = x;
+}
+
+static uint32_t get_be32(const uint8_t *p) {
+    return (uint32_t)p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
+}
+
+static void hash_root(uint8_t out[32], uint32_t n, const uint8_t top[32]) {
+    sha256_ctx_t c;
+    uint8_t hdr[5] = { TAG_ROOT };
+    put_be32(&hdr[1], n);
+    sha256_init(&c);
+    sha256_update(&c, hdr, sizeof hdr);
+    sha256_update(&c, top, 32);
+    sha256_final(&c, out);
+}
+
+// siblings on the way up from leaf <index> of <n>: one per level,
+// except where the node is the odd one out and carries up.
+static unsigned path_len(uint32_t index, uint32_t n) {
+    unsigned len = 0;
+    for(; n > 1; index >>= 1, n = (n + 1) / 2)
+        if((index ^ 1) < n)
+            len++;
+    return len;
+}
+
+void atecc_merkle_init(atecc_merkle_t *m) {
+    m->n = 0;
+    m->signed_p = 0;
+}
+
+int atecc_merkle_add(atecc_merkle_t *m, const uint8_t digest[32]) {
+    if(m->signed_p || m->n == ATECC_MERKLE_MAX)
+        return -1;
+    hash_leaf(m->node[m->n], digest);
+    return m->n++;
+}
+
+int atecc_merkle_sign(atecc_merkle_t *m, uint8_t key_id) {
+    if(!m->n || m->signed_p)
+        return -1;
+
+    // each level goes right after the one below it.
+    unsigned lo = 0, cnt = m->n;
+    while(cnt > 1) {
+        unsigned up = lo + cnt;
+        assert(up + (cnt + 1) / 2 <= ATECC_MERKLE_NODES);
+        for(unsigned i = 0; i + 1 < cnt; i += 2)
+            hash_node(m->node[up + i / 2], m->node[lo + i], m->node[lo + i + 1]);
+        if(cnt & 1)
+            memcpy(m->node[up + cnt / 2], m->node[lo + cnt - 1], 32);
+        lo = up;
+        cnt = (cnt + 1) / 2;
+    }
+    hash_root(m->root, m->n, m->node[lo]);
+
+    if(atecc608a_sign(key_id, m->root, m->root_sig) < 0) {
+        LOG_ERROR("batch of %d: signing the root failed\n", m->n);
+        return -1;
+    }
+    m->signed_p = 1;
+    return 0;
+}
+
+void atecc_merkle_proof(const atecc_merkle_t *m, unsigned index, atecc_merkle_proof_t *p) {
+    assert(m->signed_p && index < m->n);
+    p->index = index;
+    p->n = m->n;
+    memcpy(p->root_sig, m->root_sig, 64);
+    p->npath = 0;
+
+    unsigned lo = 0, cnt = m->n, i = index;
+    for(; cnt > 1; lo += cnt, i >>= 1, cnt = (cnt + 1) / 2)
+        if((i ^ 1) < cnt)
+            memcpy(p->path[p->npath++], m->node[lo + (i ^ 1)], 32);
+}
+
+int atecc_merkle_root(uint8_t root[32], const uint8_t digest[32], const atecc_merkle_proof_t *p) {
+    if(p->n == 0 || p->n > ATECC_MERKLE_MAX || p->index >= p->n
+    || p->npath != path_len(p->index, p->n))
+        return -1;
+
+    uint8_t h[32];
+    unsigned k = 0, cnt = p->n, i = p->index;
+    hash_leaf(h, digest);
+    for(; cnt > 1; i >>= 1, cnt = (cnt + 1) / 2) {
+        if((i ^ 1) >= cnt)
+            continue;
+        if(i & 1)
+            hash_node(h, p->path[k++], h);
+        else
+            hash_node(h, h, p->path[k++]);
+    }
+    hash_root(root, p->n, h);
+    return 0;
+}
+
+int atecc_merkle_verify(const uint8_t pubkey[64], const uint8_t digest[32],
+                        const atecc_merkle_proof_t *p) {
+    uint8_t root[32];
+    if(atecc_merkle_root(root, digest, p) < 0)
+        return 1;
+    return p256_verify(pubkey, root, p->root_sig) ? 0 : 1;
+}
+
+unsigned atecc_merkle_proof_pack(uint8_t *out, const atecc_merkle_proof_t *p) {
+    put_be32(&out[0], p->index);
+    put_be32(&out[4], p->n);
+    memcpy(&out[8], p->root_sig, 64);
+    memcpy(&out[72], p->path, 32 * p->npath);
+    return ATECC_MERKLE_PROOF_BYTES(p->npath);
+}
+
+int atecc_merkle_proof_unpack(atecc_merkle_proof_t *p, const uint8_t *in, unsigned len) {
+    if(len < ATECC_MERKLE_PROOF_BYTES(0))
+        return -1;
+    p->index = get_be32(&in[0]);
+    p->n = get_be32(&in[4]);
+    if(p->n == 0 || p->n > ATECC_MERKLE_MAX || p->index >= p->n)
+        return -1;
+    p->npath = path_len(p->index, p->n);
+    if(len < ATECC_MERKLE_PROOF_BYTES(p->npath))
+        return -1;
+    memcpy(p->root_sig, &in[8], 64);
+    memcpy(p->path, &in[72], 32 * p->npath);
+    return ATECC_MERKLE_PROOF_BYTES(p->npath);
+}
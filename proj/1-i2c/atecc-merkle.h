@@ -0,0 +1,80 @@
+#ifndef __ATECC_MERKLE_H__
+#define __ATECC_MERKLE_H__
+// Merkle batch signing: one chip SIGN for up to ATECC_MERKLE_MAX
+// digests.
+//
+// the digests go into a SHA-256 tree built in RAM and only its root
+// is signed.  each digest's receipt is the root signature plus the
+// sibling hashes on its path to the root, so checking one costs its
+// ~log2(n) hashes and a P-256 verify of the root.  per digest that is
+// a ~50ms SIGN divided by the batch size, plus about two hashes.
+//
+// the tree (RFC 6962 style, so no leaf can pass for a node):
+//   leaf    = SHA-256(0x00 || digest)
+//   node    = SHA-256(0x01 || left || right)
+// a level with an odd count carries its last node up unhashed (no
+// duplicated leaves, so no two batches share a root).  the signed
+// root also commits to the leaf count:
+//   root    = SHA-256(0x02 || n as 4 bytes big-endian || top)
+// the path's shape follows from the index and n, so a receipt cannot
+// claim another position in the tree.
+//
+// proj/2-py-util/merkle-verify.py checks receipts on a host.
+#include <stdint.h>
+
+#ifndef ATECC_MERKLE_MAX
+#define ATECC_MERKLE_MAX 256
+#endif
+// path length for ATECC_MERKLE_MAX leaves (log2, rounded up).
+#define ATECC_MERKLE_DEPTH 8
+// every level, leaves first.  each of the <= DEPTH levels above the
+// leaves holds half the one below, plus one if that was odd (n = 5:
+// 5 + 3 + 2 + 1), so the tree is always under 2n + DEPTH hashes.
+#define ATECC_MERKLE_NODES (2 * ATECC_MERKLE_MAX + ATECC_MERKLE_DEPTH)
+_Static_assert((1 << ATECC_MERKLE_DEPTH) >= ATECC_MERKLE_MAX,
+               "ATECC_MERKLE_DEPTH too small for ATECC_MERKLE_MAX (and ATECC_MERKLE_NODES)");
+
+typedef struct {
+    unsigned n;
+    int signed_p;
+    uint8_t root[32];
+    uint8_t root_sig[64];
+    uint8_t node[ATECC_MERKLE_NODES][32];
+} atecc_merkle_t;
+
+// what one digest gets back.
+typedef struct {
+    uint32_t index, n;
+    uint8_t root_sig[64];
+    unsigned npath;
+    uint8_t path[ATECC_MERKLE_DEPTH][32];
+} atecc_merkle_proof_t;
+
+// on the wire: index and n (4 bytes big-endian each), the signature,
+// then the path.
+#define ATECC_MERKLE_PROOF_BYTES(npath) (4 + 4 + 64 + 32 * (npath))
+
+void atecc_merkle_init(atecc_merkle_t *m);
+// add <digest> to the batch: its index, or -1 if the batch is full or
+// already signed.
+int atecc_merkle_add(atecc_merkle_t *m, const uint8_t digest[32]);
+// build the tree and sign its root with <key_id> (atecc608a_sign): 0,
+// or -1.  after this the batch takes no more digests.
+int atecc_merkle_sign(atecc_merkle_t *m, uint8_t key_id);
+// the receipt for digest <index> of a signed batch.
+void atecc_merkle_proof(const atecc_merkle_t *m, unsigned index, atecc_merkle_proof_t *p);
+
+// the root <p> leads to from <digest>: 0, or -1 if <p> is malformed
+// (index out of range, wrong path length).
+int atecc_merkle_root(uint8_t root[32], const uint8_t digest[32], const atecc_merkle_proof_t *p);
+// check a receipt: 0 valid, 1 not (atecc608a_verify's convention).
+// software only (libpi p256.h): no chip needed.
+int atecc_merkle_verify(const uint8_t pubkey[64], const uint8_t digest[32],
+                        const atecc_merkle_proof_t *p);
+
+// serialize / parse a receipt: bytes written, or bytes read (-1 if
+// <in> is not a receipt).
+unsigned atecc_merkle_proof_pack(uint8_t *out, const atecc_merkle_proof_t *p);
+int atecc_merkle_proof_unpack(atecc_merkle_proof_t *p, const uint8_t *in, unsigned len);
+
+#endif
@@ -0,0 +1,58 @@
+// secp256k1 keys sealed under the chip: see <atecc-seal.h>.
+#include "rpi.h"
+#include "atecc-seal.h"
+#include "sha256.h"
+#include "i2c-log.h"
+
+// a P-256 point nobody knows the log of: x = SHA-256("raspberry-tee
+// seal point" || ctr) for the first byte ctr = 0, 1, .. that lands on
+// the curve (5), and the even y.
+const uint8_t atecc_seal_point[64] = {
+    0x75, 0xfc, 0x63, 0x2c, 0x1e, 0x8a, 0x56, 0x34, 0x7f, 0xb9, 0xdb, 0xa1, 0x5f, 0xe3, 0x81, 0x77,
+    0x1c, 0x5a, 0x52, 0x84, 0x83, 0x50, 0xc5, 0xc4, 0x4c, 0x4f, 0x8e, 0xa5, 0x16, 0x9a, 0x9d, 0xc6,
+    0x1e, 0xfd, 0xda, 0xb4, 0x3a, 0x94, 0x13, 0x46, 0x84, 0xe4, 0xe2, 0x13, 0xc7, 0x0d, 0x07, 0xd4,
+    0xab, 0x3e, 0xfd, 0xfd, 0x6e, 0xb8, 0x2c, 0xc4, 0x64, 0xe6, 0xaa, 0xcd, 0x80, 0xd8, 0xb8, 0x6a,
+};
+
+int atecc_seal_kek(uint8_t kek[32]) {
+    static const char label[] = "raspberry-tee secp256k1 kek";
+    uint8_t secret[32];
+
+    if (atecc608a_ecdh(ATECC_SEAL_SLOT, atecc_seal_point, secret) < 0) {
+        LOG_ERROR("no seal key: ECDH with slot %d failed\n", ATECC_SEAL_SLOT);
+        return -1;
+    }
+    hmac_sha256(secret, sizeof secret, label, sizeof label - 1, kek);
+    sha256_wipe(secret, sizeof secret);
+    return 0;
+}
+
+int atecc_seal_k1(const uint8_t priv[32], secp256k1_sealed_t *out) {
+    uint8_t kek[32], rand[32];
+    int ret = -1;
+
+    if (atecc_session_begin() < 0)
+        return -1;
+    if (atecc608a_random(rand) == 0 && atecc_seal_kek(kek) == 0) {
+        secp256k1_seal(out, kek, priv, rand);
+        ret = 0;
+    }
+    atecc_session_end(0);
+    sha256_wipe(kek, sizeof kek);
+    return ret;
+}
+
+int atecc_unseal_k1(const secp256k1_sealed_t *in, secp256k1_key_t *key) {
+    uint8_t kek[32], priv[32];
+
+    if (atecc_seal_kek(kek) < 0)
+        return -1;
+    int ok = secp256k1_unseal(priv, kek, in) && secp256k1_key_init(key, priv);
+    sha256_wipe(kek, sizeof kek);
+    sha256_wipe(priv, sizeof priv);
+    if (!ok) {
+        LOG_ERROR("sealed key does not open on this chip\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,49 @@
+#ifndef __ATECC_SEAL_H__
+#define __ATECC_SEAL_H__
+// a secp256k1 signing key (libpi secp256k1.h) kept sealed under a key
+// only this ATECC608A can derive.
+//
+// the chip has no secp256k1, so the signing runs in software and the
+// private key has to live outside the chip: it is stored encrypted and
+// authenticated (secp256k1_seal) under a key-encryption key that is
+// ECDH between a P-256 key in ATECC_SEAL_SLOT and a fixed point.  the
+// slot's private key never leaves the chip, so neither does the kek's
+// source: a sealed blob copied off this board opens nowhere else.
+//
+// the fixed point is hashed to the curve, so nobody knows its discrete
+// log; ECDH is deterministic (SIGN is not) so the same kek comes back
+// every time.  the slot has to allow ECDH with clear output, which
+// slot 0 (sign only) does not: see atecc608a-config.h slot 2.
+//
+// what this does NOT protect against: ECDH mode 0x0C returns the
+// shared secret in the clear, so it crosses I2C on every seal and
+// unseal.  anyone with a probe on SDA/SCL while the Pi signs gets the
+// ECDH secret, hence the kek, hence every key sealed on this board.
+// the sealing only keeps a blob copied off the board (SD card, a
+// backup) useless without this chip.  the chip's encrypted ECDH output
+// would not close that gap here: it is encrypted under an IO
+// protection key the Pi has to hold as well.
+#include "atecc608a.h"
+#include "secp256k1.h"
+
+#ifndef ATECC_SEAL_SLOT
+#define ATECC_SEAL_SLOT 2
+#endif
+
+// the fixed point (x || y).
+extern const uint8_t atecc_seal_point[64];
+
+// the kek: HMAC-SHA256 of a label under ECDH(ATECC_SEAL_SLOT, seal
+// point).  0, or -1 if the chip would not do it.
+int atecc_seal_kek(uint8_t kek[32]);
+
+// seal <priv> for this chip, under a fresh nonce from its RNG.  0 or
+// -1.
+int atecc_seal_k1(const uint8_t priv[32], secp256k1_sealed_t *out);
+
+// open <in> into a key ready to sign with: 0, 1 if <in> was not sealed
+// by this chip or was changed (or holds no valid key), -1 if the chip
+// failed.  wipe <key> (secp256k1_key_wipe) when done with it.
+int atecc_unseal_k1(const secp256k1_sealed_t *in, secp256k1_key_t *key);
+
+#endif
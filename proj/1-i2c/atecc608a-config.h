@@ -58,7 +58,11 @@ static const uint8_t config[128] =
                   //   (Private keys use GenKey/PrivWrite, so normal writes are blocked.)
 
     0xFF, 0xFF,   // SlotConfig[1]
-    0xFF, 0xFF,   // SlotConfig[2]
+    // Slot 2: ECC Private Key for P256, ECDH only: the secp256k1 key
+    // sealing key (atecc-seal.h) comes from ECDH with this slot.
+    0x84, 0x02,   // SlotConfig[2]: = 0x0284
+                  //   readKey=0x4 (signExt=0, signInt=0, ECDH=1, secret to output)
+                  //   isSecret=1 (bit7)
     0xFF, 0xFF,   // SlotConfig[3]
     0xFF, 0xFF,   // SlotConfig[4]
     0xFF, 0xFF,   // SlotConfig[5]
@@ -115,7 +119,8 @@ static const uint8_t config[128] =
                   //  bits14..15=X509id=0
 
     0xFF, 0xFF,   // KeyConfig[1]
-    0xFF, 0xFF,   // KeyConfig[2]
+    // Slot 2: as slot 0 without ReqRandom (ECDH takes no nonce)
+    0x33, 0x00,   // KeyConfig[2] = 0x0033: Private, PubInfo, P256, Lockable
     0xFF, 0xFF,   // KeyConfig[3]
     0xFF, 0xFF,   // KeyConfig[4]
     0xFF, 0xFF,   // KeyConfig[5]
@@ -1,5 +1,9 @@
 #include "atecc608a.h"
 #include "i2c.h"
+#include "atecc-exec.h"
+#include "i2c-log.h"
+#include "sha256.h"
+#include "p256.h"
 
 
 // Check if ATECC608A is awake
@@ -24,8 +28,8 @@ int atecc608a_is_awake(void) {
     return 0;
 }
 
-// Wake up the ATECC608A
-int atecc608a_wakeup(void) {
+// Hold SDA low for tWLO: wakes every device on the bus at once.
+void atecc_wake_pulse(void) {
     // Create a wake pulse by holding SDA low for tWLO (min ~60us)
     gpio_set_function(I2C_SDA, GPIO_FUNC_OUTPUT);
 
@@ -39,42 +43,112 @@ int atecc608a_wakeup(void) {
 
     // Wait for tWHI (at least 150 us) before communication
     delay_us(150);
-    // printk("Wake pulse sent\n");
-    i2c_init();
-    // Now immediately perform I2C read from the ATECC608A
-    uint8_t buffer[4];
-    if (i2c_read(ATECC608A_ADDR, buffer, sizeof(buffer)) < 0) {
-        // printk("I2C error during read: 0xb0000151\n");
-    } else {
-        if (buffer[0] == 0x04 &&
-            buffer[1] == 0x11 &&
-            buffer[2] == 0x33 &&
-            buffer[3] == 0x43) {
-            printk("Wake successful\n");
-        } else {
-            printk("Unexpected wake response\n");
+}
+
+// what we believe the chip is doing: awake since <woke_at>, and
+// <depth> nested sessions open.
+static struct {
+    int awake;
+    uint32_t woke_at;
+    unsigned depth;
+    unsigned nwakes, nrefreshes;
+} sess;
+
+// Idle: like sleep, but keeps TempKey and wakes the same way.
+int atecc608a_idle(void) {
+    uint8_t idle_cmd = 0x02;
+    sess.awake = 0;
+    return i2c_write(ATECC608A_ADDR, &idle_cmd, 1);
+}
+
+// Wake pulse and read the wake token (04 11 33 43).
+static int wake_token(void) {
+    for (int try = 0; try < 2; try++) {
+        atecc_wake_pulse();
+        uint8_t buffer[4];
+        if (i2c_read(ATECC608A_ADDR, buffer, sizeof(buffer)) < 0)
+            return -1;
+        if (buffer[0] == 0x04 && buffer[1] == 0x11 &&
+            buffer[2] == 0x33 && buffer[3] == 0x43) {
+            sess.awake = 1;
+            sess.woke_at = timer_get_usec();
+            sess.nwakes++;
+            return 0;
         }
+        // already awake, watchdog started who knows when: idle it
+        // so the next pulse starts a fresh one.
+        atecc608a_idle();
     }
+    LOG_ERROR("Unexpected wake response\n");
+    return -1;
+}
+
+// Wake up the ATECC608A
+int atecc608a_wakeup(void) {
+    i2c_init();
+    if (wake_token() < 0)
+        return -1;
+    LOG_INFO("Wake successful\n");
     return 0;
 }
 
 // Put ATECC608A to sleep
 int atecc608a_sleep(void) {
     uint8_t sleep_cmd = 0x01;  // Sleep opcode
+    sess.awake = 0;
     return i2c_write(ATECC608A_ADDR, &sleep_cmd, 1);
 }
 
+int atecc_session_begin(void) {
+    if (sess.depth++)
+        return 0;
+    if (sess.awake)
+        return 0;
+    i2c_init_once();
+    if (wake_token() < 0) {
+        LOG_ERROR("ATECC608A did not wake\n");
+        sess.depth--;
+        return -1;
+    }
+    return 0;
+}
+
+int atecc_session_end(int more_soon) {
+    assert(sess.depth);
+    if (--sess.depth)
+        return 0;
+    return more_soon ? atecc608a_idle() : atecc608a_sleep();
+}
+
+unsigned atecc_session_nwakes(void) {
+    return sess.nwakes;
+}
+unsigned atecc_session_nrefreshes(void) {
+    return sess.nrefreshes;
+}
+
+// the watchdog puts the chip to sleep (losing TempKey) a fixed time
+// after the wake, busy or not.  if a command of up to <usec> would
+// cross it, idle and wake again first: that restarts the watchdog
+// and keeps TempKey.
+static int session_refresh(unsigned usec) {
+    if (!sess.awake)
+        return 0;
+    uint32_t up = timer_get_usec() - sess.woke_at;
+    if (up + usec + ATECC_WATCHDOG_MARGIN_USEC < ATECC_WATCHDOG_USEC)
+        return 0;
+    sess.nrefreshes++;
+    atecc608a_idle();
+    return wake_token();
+}
+
 // See datasheet pg.56, follows polynomial 0x8005
-uint16_t calculate_crc16(size_t length, const uint8_t *data)
+// one bit at a time: the reference atecc_crc16_update is checked
+// against.
+uint16_t atecc_crc16_update_bitwise(uint16_t crc, const uint8_t *data, size_t length)
 {
-    // printk("Calculating CRC-16 for %d bytes\n", length);
-    // printk("Data: ");
-    // for (int i = 0; i < length; i++) {
-    //     printk("%x ", data[i]);
-    // }
-    // printk("\n");
     size_t counter;
-    uint16_t crc_register = 0;
+    uint16_t crc_register = crc;
     uint16_t polynom = 0x8005;
     uint8_t shift_register;
     uint8_t data_bit, crc_bit;
@@ -90,147 +164,469 @@ uint16_t calculate_crc16(size_t length, const uint8_t *data)
                 crc_register ^= polynom;
         }
     }
-    // printk("CRC-16: %x\n", crc_register);
     return crc_register;
 }
 
-static void print_packet(uint8_t *packet, uint8_t count) {
+// the device feeds each byte in LSB first but shifts the register
+// left, so it is the reflected CRC (poly 0xA001, one table lookup per
+// byte) with the register bit-reversed on the way in and out.
+static const uint16_t crc16_table[256] = {
+    0x0000, 0xc0c1, 0xc181, 0x0140, 0xc301, 0x03c0, 0x0280, 0xc241,
+    0xc601, 0x06c0, 0x0780, 0xc741, 0x0500, 0xc5c1, 0xc481, 0x0440,
+    0xcc01, 0x0cc0, 0x0d80, 0xcd41, 0x0f00, 0xcfc1, 0xce81, 0x0e40,
+    0x0a00, 0xcac1, 0xcb81, 0x0b40, 0xc901, 0x09c0, 0x0880, 0xc841,
+    0xd801, 0x18c0, 0x1980, 0xd941, 0x1b00, 0xdbc1, 0xda81, 0x1a40,
+    0x1e00, 0xdec1, 0xdf81, 0x1f40, 0xdd01, 0x1dc0, 0x1c80, 0xdc41,
+    0x1400, 0xd4c1, 0xd581, 0x1540, 0xd701, 0x17c0, 0x1680, 0xd641,
+    0xd201, 0x12c0, 0x1380, 0xd341, 0x1100, 0xd1c1, 0xd081, 0x1040,
+    0xf001, 0x30c0, 0x3180, 0xf141, 0x3300, 0xf3c1, 0xf281, 0x3240,
+    0x3600, 0xf6c1, 0xf781, 0x3740, 0xf501, 0x35c0, 0x3480, 0xf441,
+    0x3c00, 0xfcc1, 0xfd81, 0x3d40, 0xff01, 0x3fc0, 0x3e80, 0xfe41,
+    0xfa01, 0x3ac0, 0x3b80, 0xfb41, 0x3900, 0xf9c1, 0xf881, 0x3840,
+    0x2800, 0xe8c1, 0xe981, 0x2940, 0xeb01, 0x2bc0, 0x2a80, 0xea41,
+    0xee01, 0x2ec0, 0x2f80, 0xef41, 0x2d00, 0xedc1, 0xec81, 0x2c40,
+    0xe401, 0x24c0, 0x2580, 0xe541, 0x2700, 0xe7c1, 0xe681, 0x2640,
+    0x2200, 0xe2c1, 0xe381, 0x2340, 0xe101, 0x21c0, 0x2080, 0xe041,
+    0xa001, 0x60c0, 0x6180, 0xa141, 0x6300, 0xa3c1, 0xa281, 0x6240,
+    0x6600, 0xa6c1, 0xa781, 0x6740, 0xa501, 0x65c0, 0x6480, 0xa441,
+    0x6c00, 0xacc1, 0xad81, 0x6d40, 0xaf01, 0x6fc0, 0x6e80, 0xae41,
+    0xaa01, 0x6ac0, 0x6b80, 0xab41, 0x6900, 0xa9c1, 0xa881, 0x6840,
+    0x7800, 0xb8c1, 0xb981, 0x7940, 0xbb01, 0x7bc0, 0x7a80, 0xba41,
+    0xbe01, 0x7ec0, 0x7f80, 0xbf41, 0x7d00, 0xbdc1, 0xbc81, 0x7c40,
+    0xb401, 0x74c0, 0x7580, 0xb541, 0x7700, 0xb7c1, 0xb681, 0x7640,
+    0x7200, 0xb2c1, 0xb381, 0x7340, 0xb101, 0x71c0, 0x7080, 0xb041,
+    0x5000, 0x90c1, 0x9181, 0x5140, 0x9301, 0x53c0, 0x5280, 0x9241,
+    0x9601, 0x56c0, 0x5780, 0x9741, 0x5500, 0x95c1, 0x9481, 0x5440,
+    0x9c01, 0x5cc0, 0x5d80, 0x9d41, 0x5f00, 0x9fc1, 0x9e81, 0x5e40,
+    0x5a00, 0x9ac1, 0x9b81, 0x5b40, 0x9901, 0x59c0, 0x5880, 0x9841,
+    0x8801, 0x48c0, 0x4980, 0x8941, 0x4b00, 0x8bc1, 0x8a81, 0x4a40,
+    0x4e00, 0x8ec1, 0x8f81, 0x4f40, 0x8d01, 0x4dc0, 0x4c80, 0x8c41,
+    0x4400, 0x84c1, 0x8581, 0x4540, 0x8701, 0x47c0, 0x4680, 0x8641,
+    0x8201, 0x42c0, 0x4380, 0x8341, 0x4100, 0x81c1, 0x8081, 0x4040,
+};
+
+// no RBIT on the ARM1176.
+static inline uint16_t rev16(uint16_t x) {
+    x = ((x >> 1) & 0x5555) | ((x & 0x5555) << 1);
+    x = ((x >> 2) & 0x3333) | ((x & 0x3333) << 2);
+    x = ((x >> 4) & 0x0f0f) | ((x & 0x0f0f) << 4);
+    return (x >> 8) | (x << 8);
+}
+
+// continued from <crc>, so a packet that lives in pieces can be
+// checksummed in place.
+uint16_t atecc_crc16_update(uint16_t crc, const uint8_t *data, size_t length)
+{
+    uint16_t c = rev16(crc);
+    for (size_t i = 0; i < length; i++)
+        c = (c >> 8) ^ crc16_table[(c ^ data[i]) & 0xff];
+    return rev16(c);
+}
+
+uint16_t calculate_crc16(size_t length, const uint8_t *data)
+{
+    return atecc_crc16_update(0, data, length);
+}
+
+const char *atecc_strstatus(uint8_t status) {
+    switch (status) {
+    case ATECC_ST_OK:         return "ok";
+    case ATECC_ST_MISCOMPARE: return "miscompare";
+    case ATECC_ST_PARSE:      return "parse error";
+    case ATECC_ST_ECC_FAULT:  return "ECC fault";
+    case ATECC_ST_SELFTEST:   return "self test error";
+    case ATECC_ST_HEALTH:     return "health test error";
+    case ATECC_ST_EXEC:       return "execution error";
+    case ATECC_ST_WAKE:       return "after wake";
+    case ATECC_ST_WATCHDOG:   return "watchdog about to expire";
+    case ATECC_ST_CRC:        return "command CRC error";
+    default:                  return "unknown status";
+    }
+}
+
+const char *atecc_strerror(int err) {
+    if (err == ATECC_ERR_CRC)
+        return "bad response CRC";
+    return i2c_strerror(err);
+}
+
+static unsigned nrereads, nresends;
+
+unsigned atecc_resp_nrereads(void) {
+    return nrereads;
+}
+unsigned atecc_cmd_nresends(void) {
+    return nresends;
+}
+
+// the response CRC covers the count byte and the <n> bytes after it
+// (payload, or the status byte), which do not sit together.
+static int resp_crc_ok(const atecc_ctx_t *c, const uint8_t *payload, unsigned n) {
+    uint16_t crc = atecc_crc16_update(0, &c->count, 1);
+    crc = atecc_crc16_update(crc, payload, n);
+    return c->rcrc[0] == (crc & 0xFF) && c->rcrc[1] == ((crc >> 8) & 0xFF);
+}
+
+// word address 0x00 points the chip's address counter back at the
+// count byte: the next read gets the same response, and nothing runs
+// again.
+static int resp_rewind(uint8_t addr) {
+    uint8_t reset_cmd = 0x00;
+    nrereads++;
+    int r = i2c_write(addr, &reset_cmd, 1);
+    if (r == 1)
+        return 0;
+    return r < 0 ? r : I2C_ERR_UNDERRUN;
+}
+
+static void print_packet(const i2c_iovec_t *segs, unsigned n) {
     printk("Command packet: ");
-    for (int i = 0; i < count; i++) {
-        printk("%x ", packet[i]);
+    for (unsigned s = 0; s < n; s++) {
+        for (unsigned i = 0; i < segs[s].nbytes; i++) {
+            printk("%x ", segs[s].data[i]);
+        }
     }
     printk("\n");
 }
 
-static int atecc608a_send_command(uint8_t cmd, uint8_t p1, uint16_t p2, 
-                                 const uint8_t *data, uint8_t data_len,
-                                 uint8_t *response, uint8_t *response_len, int delay_time_ms) {
-    // Packet structure:
-    // [word_addr] [count][cmd][param1][param2L][param2H][data...][CRC16L][CRC16H]
-    uint8_t packet[128];
-    uint8_t count = 7 + data_len;  // count includes count byte + 7 bytes overhead + data
-    
-    // printk("Building command packet: cmd=0x%x, p1=0x%x, p2=0x%x, data_len=%d\n", 
-    //        cmd, p1, p2, data_len);
+// the command tables below are only worth having if these fold into
+// their callers with the sizes as constants.
+#define ATECC_INLINE static inline __attribute__((always_inline))
+
+// send the packet whose header is already in <c>: the CRC goes after
+// the caller's data (<ndata> pieces), which goes out in place.
+ATECC_INLINE int packet_send(atecc_ctx_t *c, uint8_t addr,
+                             const i2c_iovec_t *data, unsigned ndata) {
+    // CRC-16 over count..data (excludes word_addr and the CRC itself)
+    uint16_t crc = atecc_crc16_update(0, c->hdr + 1, sizeof c->hdr - 1);
+    for (unsigned i = 0; i < ndata; i++)
+        crc = atecc_crc16_update(crc, data[i].data, data[i].nbytes);
+    c->crc[0] = crc & 0xFF; // (For info: 0x03 0x5d)
+    c->crc[1] = (crc >> 8) & 0xFF;
+
+    i2c_iovec_t segs[4];
+    unsigned n = 0;
+    segs[n++] = (i2c_iovec_t){ .data = c->hdr, .nbytes = sizeof c->hdr };
+    for (unsigned i = 0; i < ndata; i++)
+        segs[n++] = data[i];
+    segs[n++] = (i2c_iovec_t){ .data = c->crc, .nbytes = sizeof c->crc };
     
-    // Build packet
-    packet[0] = 0x03; // Word address is 0x03 for all commands
-    packet[1] = count; // Packet length
-    packet[2] = cmd; // Command
-    packet[3] = p1; // Param1
-    packet[4] = p2 & 0xFF; // Param2 LSB
-    packet[5] = (p2 >> 8) & 0xFF; // Param2 MSB
+    if (I2C_LOG_ON(I2C_LOG_TRACE))
+        print_packet(segs, n);
     
-    // Copy data if present
-    if (data && data_len > 0) {
-        for (int i = 0; i < data_len; i++) {
-            packet[i + 6] = data[i];
-        }
+    int sent = i2c_writev(addr, segs, n);
+    if (sent == c->hdr[1] + 1)
+        return 0;
+    return sent < 0 ? sent : I2C_ERR_UNDERRUN;
+}
+
+// build [word_addr][count][cmd][p1][p2L][p2H][data...][crcL][crcH] and
+// send it to <addr>.  header and CRC are built in <c>; the caller's
+// data (<ndata> pieces) goes out in place between them.
+static int ctx_sendv(atecc_ctx_t *c, uint8_t addr, uint8_t cmd, uint8_t p1, uint16_t p2,
+                     const i2c_iovec_t *data, unsigned ndata) {
+    assert(ndata <= 2);
+    unsigned data_len = 0;
+    for (unsigned i = 0; i < ndata; i++)
+        data_len += data[i].nbytes;
+    uint8_t count = 7 + data_len;  // count includes count byte + 7 bytes overhead + data
+
+    c->hdr[0] = 0x03; // Word address is 0x03 for all commands
+    c->hdr[1] = count; // Packet length
+    c->hdr[2] = cmd; // Command
+    c->hdr[3] = p1; // Param1
+    c->hdr[4] = p2 & 0xFF; // Param2 LSB
+    c->hdr[5] = (p2 >> 8) & 0xFF; // Param2 MSB
+    return packet_send(c, addr, data, ndata);
+}
+
+int atecc_ctx_send(atecc_ctx_t *c, uint8_t addr, uint8_t cmd, uint8_t p1, uint16_t p2,
+                   const uint8_t *data, uint8_t data_len) {
+    i2c_iovec_t seg = { .data = data, .nbytes = data ? data_len : 0 };
+    return ctx_sendv(c, addr, cmd, p1, p2, &seg, 1);
+}
+
+static int ctx_recv_once(atecc_ctx_t *c, uint8_t addr, uint8_t *out, unsigned max) {
+    // a finished command leaves the I/O buffer pointer at the count
+    // byte, so a bare read is the ACK poll: NACK until the result is
+    // ready, the length once it is.
+    int r = i2c_read(addr, &c->count, 1);
+    if (r < 0)
+        return r;
+
+    // shortest response is count + status + CRC, and that is all a
+    // 4-byte one is.  anything longer is payload for the caller.
+    unsigned n = c->count;
+    if (n < 4)
+        return I2C_ERR_UNDERRUN;
+    i2c_rvec_t segs[] = {
+        { .data = &c->status, .nbytes = 1 },
+        { .data = c->rcrc,    .nbytes = sizeof c->rcrc },
+    };
+    if (n > 4) {
+        if (n - 3 > max)
+            return I2C_ERR_ARG;
+        segs[0] = (i2c_rvec_t){ .data = out, .nbytes = n - 3 };
+        c->status = 0;
     }
-    
-    // Calculate CRC-16 over the entire packet (excluding CRC bytes)
-    uint16_t crc = calculate_crc16(count - 2, packet + 1); // Exclude word_addr and final 2 CRC bytes
-    packet[count - 1] = crc & 0xFF;        // CRC LSB (For info is 0x03)
-    packet[count] = (crc >> 8) & 0xFF; // CRC MSB (For info is 0x5d)
-    
-    print_packet(packet, count + 1);
-    
-    // Send command
-    if (i2c_write(ATECC608A_ADDR, (uint8_t *) &packet, count + 1) != count + 1) {
-        printk("Failed to send command to ATECC608A\n");
-        return -1;
+
+    // Read the rest
+    r = i2c_readv(addr, segs, 2);
+    if (r < 0)
+        return r;
+    if (r != n - 1)
+        return I2C_ERR_UNDERRUN;
+    if (!resp_crc_ok(c, segs[0].data, segs[0].nbytes))
+        return ATECC_ERR_CRC;
+    return n > 4 ? n - 3 : 0;
+}
+
+int atecc_ctx_recv(atecc_ctx_t *c, uint8_t addr, uint8_t *out, unsigned max) {
+    int r = ctx_recv_once(c, addr, out, max);
+    for (unsigned i = 0; r == ATECC_ERR_CRC && i < ATECC_RESP_REREADS; i++) {
+        LOG_TRACE("atecc %x: bad response CRC, reading it again\n", addr);
+        if ((r = resp_rewind(addr)) == 0)
+            r = ctx_recv_once(c, addr, out, max);
     }
-    
-    // Wait for processing
-    printk("Waiting %d ms for command execution...\n", delay_time_ms);
-    delay_ms(delay_time_ms);
-
-    // Try polling for command completion
-    printk("Polling for command completion...\n");
-    int tries = 0;
-    int max_tries = 10;
-    while (tries < max_tries) {
-        // Reset word address (optional, may help with some I2C implementations)
-        uint8_t reset_addr = 0x00;
-        i2c_write(ATECC608A_ADDR, &reset_addr, 1);
-        delay_ms(1);
-        
-        // Read response length
-        uint8_t temp_resp[64];
-        int resp_len = i2c_read(ATECC608A_ADDR, temp_resp, 1);
-        
-        if (resp_len != 1) {
-            printk("Polling: No response yet (try %d/%d)\n", tries+1, max_tries);
-            tries++;
-            delay_ms(5);  // Wait a bit longer
+    return r;
+}
+
+int atecc_cmd_send(uint8_t addr, uint8_t cmd, uint8_t p1, uint16_t p2,
+                   const uint8_t *data, uint8_t data_len) {
+    atecc_ctx_t c;
+    return atecc_ctx_send(&c, addr, cmd, p1, p2, data, data_len);
+}
+
+int atecc_cmd_recv(uint8_t addr, uint8_t *resp, unsigned max) {
+    if (max < 4)
+        return I2C_ERR_ARG;
+    atecc_ctx_t c;
+    int n = atecc_ctx_recv(&c, addr, resp + 1, max - 3);
+    if (n < 0)
+        return n;
+    // put the packet back together around the payload.
+    if (!n)
+        resp[++n] = c.status;
+    resp[0] = c.count;
+    resp[n + 1] = c.rcrc[0];
+    resp[n + 2] = c.rcrc[1];
+    return c.count;
+}
+
+/***********************************************************
+ * the commands this driver runs, fixed at build time.
+ */
+
+// biggest command the chip's input buffer takes, count through CRC.
+#define ATECC_CMD_MAX 151
+
+// name, opcode, mode, data bytes sent (in two pieces: either can be
+// 0), payload bytes back (0: just a status byte).  param2 (key slot,
+// curve) is up to the caller.
+#define ATECC_CMDS(X)                                                   \
+    X(info_revision, ATECC_CMD_INFO,   0x00, 0,  0,  4)                 \
+    X(random,        ATECC_CMD_RANDOM, 0x00, 0,  0,  32)                \
+    X(genkey_public, ATECC_CMD_GENKEY, 0x00, 0,  0,  64)                \
+    X(nonce_load,    ATECC_CMD_NONCE,  0x03, 32, 0,  0)                 \
+    X(sign_tempkey,  ATECC_CMD_SIGN,   0x80, 0,  0,  64)                \
+    X(sha_start,     ATECC_CMD_SHA,    0x00, 0,  0,  0)                 \
+    X(sha_update,    ATECC_CMD_SHA,    0x01, 64, 0,  0)                 \
+    X(verify_extern, ATECC_CMD_VERIFY, 0x02, 64, 64, 0)               \
+    X(ecdh_clear,    ATECC_CMD_ECDH,   0x0C, 64, 0,  32)
+
+// the first four header bytes are constants: only param2 is filled in.
+ATECC_INLINE int fixed_send(atecc_ctx_t *c, const uint8_t hdr[4], uint16_t p2,
+                            const uint8_t *d0, unsigned n0,
+                            const uint8_t *d1, unsigned n1) {
+    memcpy(c->hdr, hdr, 4);
+    c->hdr[4] = p2 & 0xFF;
+    c->hdr[5] = (p2 >> 8) & 0xFF;
+    i2c_iovec_t data[] = {
+        { .data = d0, .nbytes = n0 },
+        { .data = d1, .nbytes = n1 },
+    };
+    return packet_send(c, ATECC608A_ADDR, data, n1 ? 2 : n0 ? 1 : 0);
+}
+
+// atecc_ctx_recv for a response we know the size of: <rx> payload
+// bytes (0: status only) into <out>, or a status byte instead.  any
+// other count longer than a status response is noise on the wire, so
+// it goes the way of a bad CRC.
+ATECC_INLINE int fixed_recv(atecc_ctx_t *c, uint8_t *out, unsigned rx) {
+    // a finished command leaves the I/O buffer pointer at the count
+    // byte, so a bare read is the ACK poll.
+    int r = i2c_read(ATECC608A_ADDR, &c->count, 1);
+    if (r < 0)
+        return r;
+
+    i2c_rvec_t segs[] = {
+        { .data = &c->status, .nbytes = 1 },
+        { .data = c->rcrc,    .nbytes = sizeof c->rcrc },
+    };
+    if (rx && c->count == rx + 3) {
+        segs[0] = (i2c_rvec_t){ .data = out, .nbytes = rx };
+        c->status = 0;
+    } else if (c->count != 4)
+        return c->count < 4 ? I2C_ERR_UNDERRUN : ATECC_ERR_CRC;
+
+    r = i2c_readv(ATECC608A_ADDR, segs, 2);
+    if (r < 0)
+        return r;
+    if (r != c->count - 1)
+        return I2C_ERR_UNDERRUN;
+    if (!resp_crc_ok(c, segs[0].data, segs[0].nbytes))
+        return ATECC_ERR_CRC;
+    return c->count == 4 ? 0 : rx;
+}
+
+// fixed_recv, reading a garbled response again instead of giving up
+// on (or re-running) the command.
+ATECC_INLINE int fixed_collect(atecc_ctx_t *c, uint8_t *out, unsigned rx) {
+    int len = fixed_recv(c, out, rx);
+    for (unsigned i = 0; len == ATECC_ERR_CRC && i < ATECC_RESP_REREADS; i++) {
+        LOG_TRACE("Bad response CRC, reading it again\n");
+        if ((len = resp_rewind(ATECC608A_ADDR)) == 0)
+            len = fixed_recv(c, out, rx);
+    }
+    return len;
+}
+
+// Wait for about as long as <cmd> usually takes (atecc-exec.c), then
+// ACK-poll back to back until the result is ready and read its
+// payload into <out>.  only a NACK (or a short read) is worth
+// polling again; a bad CRC is re-read, anything else (stuck bus,
+// deadline) fails now.  returns <rx> (the payload), 0 (a status
+// response, in c->status) or < 0 (I2C_ERR_*, ATECC_ERR_CRC).
+ATECC_INLINE int fixed_wait(atecc_ctx_t *c, uint8_t cmd, uint8_t p1,
+                            uint8_t *out, unsigned rx) {
+    unsigned start = timer_get_usec();
+    unsigned wait = atecc_exec_wait_usec(cmd, p1);
+    unsigned max = atecc_exec_max_usec(cmd, p1);
+    LOG_TRACE("Waiting %d usec for command execution...\n", wait);
+    delay_us(wait);
+
+    int npolls = 0;
+    while (1) {
+        // ready no later than this poll started: reading the result
+        // out is not execution time.
+        unsigned t = timer_get_usec() - start;
+        int len = fixed_collect(c, out, rx);
+        npolls++;
+
+        if (len == I2C_ERR_NACK || len == I2C_ERR_UNDERRUN) {
+            if (t > max)
+                return I2C_ERR_TIMEOUT;
             continue;
         }
-        
-        // Got a response
-        resp_len = temp_resp[0];
-        printk("Response length: %d bytes\n", resp_len);
-        
-        // Read the rest
-        if (resp_len > 1) {
-            int read_bytes = i2c_read(ATECC608A_ADDR, temp_resp + 1, resp_len - 1);
-            if (read_bytes != resp_len - 1) {
-                printk("Failed to read complete response\n");
-                tries++;
-                delay_ms(5);
-                continue;
-            }
-            
-            // Print response
-            printk("Full response on poll %d: ", tries+1);
-            for (int i = 0; i < resp_len; i++) {
-                printk("%x ", temp_resp[i]);
-            }
-            printk("\n");
-            // Copy to response buffer
-            for (int i = 0; i < resp_len; i++) {
-                response[i] = temp_resp[i];
-            }
-            *response_len = resp_len;
-            return 0;  // Success
+        if (len < 0) {
+            LOG_ERROR("Failed to read response: %s\n", atecc_strerror(len));
+            return len;
+        }
+        // an error (a fast parse error, a 0x0F) says nothing about
+        // how long the command takes when it runs.
+        if (c->status == ATECC_ST_OK)
+            atecc_exec_record(cmd, p1, t, npolls == 1);
+        LOG_TRACE("Response: %d bytes, status %x, after %d usec (%d polls)\n",
+            c->count, c->status, t, npolls);
+        return len;
+    }
+}
+
+// run one command to completion.  a command the chip got with a bad
+// CRC never ran, so it is the one thing worth sending again.
+ATECC_INLINE int fixed_run(atecc_ctx_t *c, const uint8_t hdr[4], uint16_t p2,
+                           const uint8_t *d0, unsigned n0,
+                           const uint8_t *d1, unsigned n1,
+                           uint8_t *out, unsigned rx) {
+    for (unsigned try = 0; ; try++) {
+        if (session_refresh(atecc_exec_max_usec(hdr[2], hdr[3])) < 0) {
+            LOG_ERROR("ATECC608A did not wake after idle\n");
+            return -1;
+        }
+
+        // Send command.  a NACK here means the device is asleep: no
+        // point retrying without a wake, so fail fast.
+        int sent = fixed_send(c, hdr, p2, d0, n0, d1, n1);
+        if (sent < 0) {
+            LOG_ERROR("Failed to send command to ATECC608A: %s\n", i2c_strerror(sent));
+            return sent;
         }
-        
-        tries++;
-        delay_ms(5);
+        int len = fixed_wait(c, hdr[2], hdr[3], out, rx);
+        if (len != 0 || c->status != ATECC_ST_CRC || try == ATECC_CMD_RESENDS)
+            return len;
+        LOG_TRACE("Command arrived garbled, sending it again\n");
+        nresends++;
     }
-    return -1;  // Failure if max tries exceeded
 }
 
+// for each command: its sizes (cmd_<name>_tx, cmd_<name>_rx), its
+// header, and send / wait / run with every length a constant.  a
+// command that cannot fit, or a payload that would read as a status
+// response, does not build.
+#define ATECC_CMD_FNS(name, op, mode, tx0, tx1, rx)                             \
+    _Static_assert((tx0) || !(tx1), #name ": second data piece without a first"); \
+    _Static_assert(7 + (tx0) + (tx1) <= ATECC_CMD_MAX, #name ": command too big"); \
+    _Static_assert((rx) == 0 || ((rx) > 1 && (rx) + 3 <= ATECC_RESP_MAX),     \
+                   #name ": bad response size");                                \
+    enum { cmd_##name##_tx = (tx0) + (tx1), cmd_##name##_rx = (rx) };           \
+    static const uint8_t cmd_##name##_hdr[4] = { 0x03, 7 + (tx0) + (tx1), op, mode }; \
+    static inline int cmd_##name##_send(atecc_ctx_t *c, uint16_t p2,            \
+                                        const uint8_t *d0, const uint8_t *d1) { \
+        return fixed_send(c, cmd_##name##_hdr, p2, d0, tx0, d1, tx1);           \
+    }                                                                           \
+    static inline int cmd_##name##_wait(atecc_ctx_t *c, uint8_t *out) {         \
+        return fixed_wait(c, op, mode, out, rx);                                \
+    }                                                                           \
+    static inline int cmd_##name##_run(atecc_ctx_t *c, uint16_t p2,             \
+                                       const uint8_t *d0, const uint8_t *d1,    \
+                                       uint8_t *out) {                          \
+        return fixed_run(c, cmd_##name##_hdr, p2, d0, tx0, d1, tx1, out, rx);   \
+    }
+ATECC_CMDS(ATECC_CMD_FNS)
+
 // Get revision info - this can be called safely even if no config is set
 // Datasheet pg. 79 (Section 11.8)
 int atecc608a_get_revision_info(void) {
-    printk("Executing get_revision_info...\n");
+    LOG_INFO("Executing get_revision_info...\n");
     
-    uint8_t response[7]; // 4 bytes for response + 3 bytes metadata
-    uint8_t response_len = 7;
+    atecc_ctx_t c;
+    uint8_t rev[cmd_info_revision_rx];
     
     // For the INFO command with Revision mode:
     // Mode (p1) should be 0x00 (Revision mode)
     // Param2 should be 0x0000
-    int ret = -1;
-    ret = atecc608a_send_command(ATECC_CMD_INFO, 0x00, 0x0000, NULL, 0, response, &response_len, 5);
-    int data_len = response_len - 3; // 3 bytes metadata - 1 byte status + 2 bytes CRC
-    if (ret == 0) {
-        // Check if response status bit is 0x0
-        if (response[1] == 0x00) {
+    int ret = cmd_info_revision_run(&c, 0x0000, NULL, NULL, rev);
+    if (ret == sizeof rev) {
+        if (I2C_LOG_ON(I2C_LOG_INFO)) {
             printk("Revision info received successfully: ");
-        } else {
-            printk("Failed to get revision info: ");
-        }
-        for (int j = 0; j < data_len; j++) {
-            printk("%x ", response[j + 1]);
+            for (int j = 0; j < sizeof rev; j++) {
+                printk("%x ", rev[j]);
+            }
+            printk("\n");
         }
-        printk("\n");
-    } else {
-        printk("Failed to get revision info, error: %d\n", ret);
+        return 0;
+    }
+    if (ret >= 0) {
+        LOG_ERROR("Failed to get revision info: %s (%x)\n", atecc_strstatus(c.status), c.status);
+        return -1;
     }
+    LOG_ERROR("Failed to get revision info, error: %d\n", ret);
     return ret;
 }
 
+// i2c_speed_probe() check: an INFO command has to come back whole
+// with a good CRC.  device must be awake.
+int atecc608a_check_link(void *arg) {
+    atecc_ctx_t c;
+    uint8_t rev[cmd_info_revision_rx];
+
+    // the CRC is checked on the way in.  a speed that only works
+    // with re-reads does not count.
+    unsigned rereads = nrereads;
+    return cmd_info_revision_run(&c, 0x0000, NULL, NULL, rev) == sizeof rev
+        && nrereads == rereads;
+}
+
 int atecc608a_init(void) {
     // Initialize I2C
     i2c_init();
@@ -241,205 +637,354 @@ int atecc608a_init(void) {
     return 0;
 }
 
-// Get 32 random bytes
+// Get 32 random bytes, straight into <rand_out>.
+static int random_cmd(uint8_t *rand_out) {
+    // Random command, default mode
+    atecc_ctx_t c;
+    
+    if (cmd_random_run(&c, 0, NULL, NULL, rand_out) != cmd_random_rx)
+        return -1;
+    return 0;
+}
+
 int atecc608a_random(uint8_t *rand_out) {
+    if (atecc_session_begin() < 0)
+        return -1;
+    int ret = random_cmd(rand_out);
+    atecc_session_end(0);
+    return ret;
+}
+
+// Get the public key, straight into <pubkey>.
+static int pubkey_cmd(uint8_t key_id, uint8_t *pubkey) {
+    atecc_ctx_t c;
     
-    // Wake up the device
-    atecc608a_wakeup();
-    // Random command parameters
-    uint8_t mode = 0x00;  // Default mode
-    uint8_t response[32];
-    uint8_t response_len = sizeof(response);
+    // Send GENKEY command with mode 0 (get public key from private key)
+    // Mode 0x00: compute public key from existing private key
+    LOG_INFO("Retrieving public key for key_id %d...\n", key_id);
     
-    int ret = atecc608a_send_command(ATECC_CMD_RANDOM, mode, 0, NULL, 0, response, &response_len, 50);
+    // The key_id is provided in param2
+    uint16_t param2 = key_id;
     
-    if (ret < 0)
+    // The public key is 64 bytes (X and Y coordinates, 32 bytes each)
+    int ret = cmd_genkey_public_run(&c, param2, NULL, NULL, pubkey);
+    if (ret != cmd_genkey_public_rx) {
+        if (ret == 0)
+            LOG_ERROR("GENKEY failed: %s (%x)\n", atecc_strstatus(c.status), c.status);
+        else
+            LOG_ERROR("Failed to execute GENKEY command: %s\n", atecc_strerror(ret));
         return -1;
-    
-    // Copy random bytes to output buffer
-    for (int i = 0; i < 32; i++) {
-        rand_out[i] = response[i + 1]; // Skip the first byte (status)
     }
-    
+    LOG_INFO("Public key retrieved successfully\n");
     return 0;
 }
 
-// Get the public key
 int atecc608a_pubkey(uint8_t key_id, uint8_t *pubkey) {
-    // Wake up the device first
-    atecc608a_wakeup();
-    
-    uint8_t response[70]; // Large enough for the signature response
-    uint8_t response_len = sizeof(response);
+    if (atecc_session_begin() < 0)
+        return -1;
+    int ret = pubkey_cmd(key_id, pubkey);
+    atecc_session_end(0);
+    return ret;
+}
+
+// ECDH with the key in <key_id>: mode 0x0C puts the shared x straight
+// in <secret>, unencrypted.
+int atecc608a_ecdh(uint8_t key_id, const uint8_t *pubkey, uint8_t *secret) {
+    atecc_ctx_t c;
+
+    if (atecc_session_begin() < 0)
+        return -1;
+    LOG_INFO("ECDH with key %d...\n", key_id);
+    int ret = cmd_ecdh_clear_run(&c, key_id, pubkey, NULL, secret);
+    atecc_session_end(0);
+
+    if (ret != cmd_ecdh_clear_rx) {
+        if (ret == 0)
+            LOG_ERROR("ECDH failed: %s (%x)\n", atecc_strstatus(c.status), c.status);
+        else
+            LOG_ERROR("Failed to execute ECDH command: %s\n", atecc_strerror(ret));
+        return -1;
+    }
+    return 0;
+}
+
+
+// sign whatever digest TempKey holds: the signature lands straight in
+// <signature>.
+static int sign_tempkey_cmd(uint8_t key_id, uint8_t *signature) {
+    atecc_ctx_t c;
+    int ret;
     
-    // Send GENKEY command with mode 0 (get public key from private key)
-    // Mode 0x00: compute public key from existing private key
-    printk("Retrieving public key for key_id %d...\n", key_id);
+    // Sign the digest using SIGN command
+    // Mode 0x80: use TempKey as the source of the digest
+    LOG_INFO("Signing digest with key %d...\n", key_id);
     
-    // The key_id is provided in param2
+    // The key_id parameter is provided in param2
     uint16_t param2 = key_id;
     
-    int ret = atecc608a_send_command(ATECC_CMD_GENKEY, 0x00, param2, 
-                                    NULL, 0, response, &response_len, 50);
+    // The signature is 64 bytes (r and s components of ECDSA signature)
+    ret = cmd_sign_tempkey_run(&c, param2, NULL, NULL, signature);
     
-    if (ret != 0) {
-        printk("Failed to execute GENKEY command\n");
+    if (ret != cmd_sign_tempkey_rx) {
+        if (ret == 0)
+            LOG_ERROR("SIGN failed: %s (%x)\n", atecc_strstatus(c.status), c.status);
+        else
+            LOG_ERROR("Failed to execute SIGN command: %s\n", atecc_strerror(ret));
         return -1;
     }
-        
-    // The public key is 64 bytes (X and Y coordinates, 32 bytes each)
-    // It starts after count byte in the response
-    printk("Public key retrieved successfully\n");
-    
-    // Copy the public key to the output buffer
-    for (int i = 0; i < 64; i++) {
-        pubkey[i] = response[i + 1]; // Skip count byte
-    }
-    
-    // Put the device to sleep to save power
-    atecc608a_sleep();
     
+    LOG_INFO("Signature generated successfully\n");
     return 0;
 }
 
-
-int atecc608a_sign(uint8_t key_id, const uint8_t *msg, uint8_t *signature) {
-    // Wake up the device first
-    atecc608a_wakeup();
-    
-    uint8_t response[70]; // Large enough for the signature response
-    uint8_t response_len = sizeof(response);
+static int sign_cmd(uint8_t key_id, const uint8_t *msg, uint8_t *signature) {
+    atecc_ctx_t c;
     int ret;
     
     // Step 1: Load the message digest into TempKey using NONCE command
     // For NONCE command in Pass-through mode (mode 3)
     // This loads the 32-byte message/digest directly into TempKey
-    printk("Loading message digest into TempKey...\n");
-    ret = atecc608a_send_command(ATECC_CMD_NONCE, 0x03, 0x0000, 
-                                msg, 32, response, &response_len, 10);
+    LOG_TRACE("Loading message digest into TempKey...\n");
+    ret = cmd_nonce_load_run(&c, 0x0000, msg, NULL, NULL);
     
     if (ret != 0) {
-        printk("Failed to execute NONCE command\n");
+        LOG_ERROR("Failed to execute NONCE command: %s\n", atecc_strerror(ret));
         return -1;
     }
     
     // Check if NONCE command was successful
-    if (response[1] != 0x00) {
-        printk("NONCE command failed with error: %x\n", response[1]);
+    if (c.status != ATECC_ST_OK) {
+        LOG_ERROR("NONCE command failed: %s (%x)\n", atecc_strstatus(c.status), c.status);
         return -1;
     }
     
-    // Step 2: Sign the digest using SIGN command
-    // Mode 0x80: use TempKey as the source of the digest
-    printk("Signing digest with key %d...\n", key_id);
-    response_len = sizeof(response);
-    
-    // The key_id parameter is provided in param2
-    uint16_t param2 = key_id;
-    
-    ret = atecc608a_send_command(ATECC_CMD_SIGN, 0x80, param2, 
-                                NULL, 0, response, &response_len, 100);
-    
-    if (ret != 0) {
-        printk("Failed to execute SIGN command\n");
+    // Step 2: Sign the digest
+    return sign_tempkey_cmd(key_id, signature);
+}
+
+int atecc608a_sign(uint8_t key_id, const uint8_t *msg, uint8_t *signature) {
+    if (atecc_session_begin() < 0)
         return -1;
+    int ret = sign_cmd(key_id, msg, signature);
+    atecc_session_end(0);
+    return ret;
+}
+
+// 0 if a <len>-byte payload is the <want> bytes asked for, the chip's
+// status byte if it sent an error instead, or < 0 (I2C_ERR_*).
+static int run_status(const atecc_ctx_t *c, int len, int want) {
+    if (len < 0)
+        return len;
+    if (len == 0 && c->status)
+        return c->status;
+    return len == want ? 0 : I2C_ERR_UNDERRUN;
+}
+
+// send the NONCE that loads <digest> into TempKey, after making sure
+// the watchdog leaves room for it and the SIGN after it.
+static int batch_nonce(atecc_ctx_t *c, const uint8_t *digest) {
+    unsigned pair_usec = atecc_exec_max_usec(ATECC_CMD_NONCE, 0x03)
+                       + atecc_exec_max_usec(ATECC_CMD_SIGN, 0x80);
+    if (session_refresh(pair_usec) < 0)
+        return -1;
+    return cmd_nonce_load_send(c, 0x0000, digest, NULL);
+}
+
+// one chip runs one command at a time, so the pipeline is: NONCE for
+// digest i+1 goes out the moment signature i is in.  signatures are
+// read straight into <sig>.
+int atecc608a_sign_batch(uint8_t key_id, const uint8_t (*digest)[32], unsigned n,
+                         uint8_t (*sig)[64], int *status) {
+    if (atecc_session_begin() < 0)
+        return -1;
+
+    atecc_ctx_t c;
+    int nonce = n ? batch_nonce(&c, digest[0]) : 0;
+    int nsigned = 0;
+    for (unsigned i = 0; i < n; i++) {
+        // TempKey <- digest i, then sign it.
+        int st = nonce;
+        if (st == 0)
+            st = run_status(&c, cmd_nonce_load_wait(&c, NULL), cmd_nonce_load_rx);
+        if (st == 0)
+            st = cmd_sign_tempkey_send(&c, key_id, NULL, NULL);
+        if (st == 0)
+            st = run_status(&c, cmd_sign_tempkey_wait(&c, sig[i]), cmd_sign_tempkey_rx);
+
+        // the chip is free: start on the next digest.
+        if (i + 1 < n)
+            nonce = batch_nonce(&c, digest[i + 1]);
+
+        if (st == 0)
+            nsigned++;
+        if (status)
+            status[i] = st;
     }
-    
-    // Check if SIGN command was successful
-    // if (response[1] != 0x00) {
-    //     printk("SIGN command failed with error: %x\n", response[1]);
-    //     return -1;
-    // }
-    
-    // Copy the signature from the response
-    // The signature is 64 bytes (r and s components of ECDSA signature)
-    // It starts after the status byte (response[1])
-    printk("Signature generated successfully\n");
-    
-    // Copy the signature to the output buffer
-    for (int i = 0; i < 64; i++) {
-        signature[i] = response[i + 1];
+
+    atecc_session_end(0);
+    return nsigned;
+}
+
+/***********************************************************
+ * SHA-256 on the chip's engine.
+ */
+
+// SHA End, mode 7:6 = 00: the digest is returned and left in TempKey.
+#define SHA_END_TEMPKEY 0x02
+
+// the last 0..63 bytes: a command whose length is only known now, so
+// its header is built here rather than in ATECC_CMDS.
+static int sha_end_cmd(const uint8_t *tail, unsigned n, uint8_t *digest) {
+    atecc_ctx_t c;
+    const uint8_t hdr[4] = { 0x03, 7 + n, ATECC_CMD_SHA, SHA_END_TEMPKEY };
+    return run_status(&c, fixed_run(&c, hdr, n, tail, n, NULL, 0, digest, 32), 32);
+}
+
+static int sha_block_cmd(const uint8_t *block) {
+    atecc_ctx_t c;
+    return run_status(&c, cmd_sha_update_run(&c, 64, block, NULL, NULL), 0);
+}
+
+int atecc_sha256_init(atecc_sha256_t *h) {
+    h->nbuf = 0;
+    h->open = 0;
+    if (atecc_session_begin() < 0)
+        return h->err = -1;
+    h->open = 1;
+
+    atecc_ctx_t c;
+    h->err = run_status(&c, cmd_sha_start_run(&c, 0, NULL, NULL, NULL), 0);
+    if (h->err)
+        LOG_ERROR("SHA start failed: %d\n", h->err);
+    return h->err;
+}
+
+int atecc_sha256_update(atecc_sha256_t *h, const void *data, unsigned n) {
+    const uint8_t *p = data;
+    if (h->err)
+        return h->err;
+
+    // top up the block left over from last time.
+    if (h->nbuf) {
+        unsigned k = 64 - h->nbuf < n ? 64 - h->nbuf : n;
+        memcpy(h->buf + h->nbuf, p, k);
+        h->nbuf += k;
+        p += k;
+        n -= k;
+        if (h->nbuf < 64)
+            return 0;
+        if ((h->err = sha_block_cmd(h->buf)) != 0)
+            return h->err;
+        h->nbuf = 0;
     }
-    
-    // Put the device to sleep to save power
-    atecc608a_sleep();
-    
+    // whole blocks go out from where they are.
+    for (; n >= 64; p += 64, n -= 64)
+        if ((h->err = sha_block_cmd(p)) != 0)
+            return h->err;
+
+    memcpy(h->buf, p, n);
+    h->nbuf = n;
     return 0;
 }
 
-int atecc608a_verify_signature(const uint8_t *signature, const uint8_t *public_key) {
-    // Ensure the device is awake
-    if (!atecc608a_is_awake()) {
-        atecc608a_wakeup();
+int atecc_sha256_final(atecc_sha256_t *h, uint8_t *digest) {
+    uint8_t out[32];
+    int ret = h->err;
+    if (!ret)
+        ret = h->err = sha_end_cmd(h->buf, h->nbuf, digest ? digest : out);
+    if (ret)
+        LOG_ERROR("SHA failed: %d\n", ret);
+    if (h->open) {
+        h->open = 0;
+        atecc_session_end(1);
     }
-    
-    uint8_t response[7]; // Count + status + CRC bytes
-    uint8_t response_len = sizeof(response);
-    
-    // Prepare the combined data buffer for the VERIFY command
-    uint8_t verify_data[128];
-    
-    // Copy signature (64 bytes) to the first part of verify_data
-    for (int i = 0; i < 64; i++) {
-        verify_data[i] = signature[i];
-    }
-    
-    // Copy public key (64 bytes) to the second part of verify_data
-    for (int i = 0; i < 64; i++) {
-        verify_data[i + 64] = public_key[i];
+    return ret;
+}
+
+static unsigned sha_sw_min = ATECC_SHA_SW_MIN;
+
+unsigned atecc_sha_sw_min_set(unsigned nbytes) {
+    unsigned old = sha_sw_min;
+    sha_sw_min = nbytes;
+    return old;
+}
+
+int atecc_hash_backend(unsigned len) {
+    return len >= sha_sw_min ? ATECC_HASH_SW : ATECC_HASH_CHIP;
+}
+
+int atecc608a_sign_message(uint8_t key_id, const void *msg, unsigned len, uint8_t *signature) {
+    // software: a few microseconds of CPU and one NONCE, instead of a
+    // bus round trip per 64 bytes.
+    if (atecc_hash_backend(len) == ATECC_HASH_SW) {
+        uint8_t digest[32];
+        sha256(msg, len, digest);
+        return atecc608a_sign(key_id, digest, signature);
     }
+
+    if (atecc_session_begin() < 0)
+        return -1;
+
+    atecc_sha256_t h;
+    atecc_sha256_init(&h);
+    atecc_sha256_update(&h, msg, len);
+    int ret = atecc_sha256_final(&h, NULL);
+    // the digest is already in TempKey: no NONCE.
+    if (ret == 0)
+        ret = sign_tempkey_cmd(key_id, signature);
+
+    atecc_session_end(0);
+    return ret ? -1 : 0;
+}
+
+// TempKey must hold the digest (atecc608a_load_tempkey).
+static int verify_cmd(const uint8_t *signature, const uint8_t *public_key) {
+    atecc_ctx_t c;
     
-    printk("Verifying signature with external public key...\n");
+    LOG_INFO("Verifying signature with external public key...\n");
     
     // Send VERIFY command in External mode (0x02)
-    // Param2 = 0x0004 specifies P256 NIST ECC curve
-    int ret = atecc608a_send_command(ATECC_CMD_VERIFY, 0x02, 0x0004, 
-                                    verify_data, sizeof(verify_data), 
-                                    response, &response_len, 70);
+    // Param2 = 0x0004 specifies P256 NIST ECC curve.  signature (64
+    // bytes) then public key (64 bytes), both sent from where they are.
+    int ret = cmd_verify_extern_run(&c, 0x0004, signature, public_key, NULL);
     
     if (ret != 0) {
-        printk("Failed to execute VERIFY command\n");
+        LOG_ERROR("Failed to execute VERIFY command\n");
         return -1;
     }
     
     // Check verification result
-    if (response[1] == 0x00) {
+    if (c.status == ATECC_ST_OK) {
         // printk("Signature verified successfully\n");
         return 0; // Success
-    } else if (response[1] == 0x01) {
+    } else if (c.status == ATECC_ST_MISCOMPARE) {
         // printk("Signature verification failed - invalid signature\n");
         return 1; // Invalid signature
     } else {
-        printk("Verification command returned error: %x\n", response[1]);
+        LOG_ERROR("Verification command returned error: %s (%x)\n",
+            atecc_strstatus(c.status), c.status);
         return -1;
     }
 }
 
 // Load the message digest into TempKey slot
-int atecc608a_load_tempkey(const uint8_t *data) {
-    // Wake up the device if needed
-    if (!atecc608a_is_awake()) {
-        atecc608a_wakeup();
-    }
-    
-    uint8_t response[7]; // Count + status + 2 CRC bytes + buffer
-    uint8_t response_len = sizeof(response);
+static int load_tempkey_cmd(const uint8_t *data) {
+    atecc_ctx_t c;
     
-    printk("Loading data into TempKey using NONCE command...\n");
+    LOG_TRACE("Loading data into TempKey using NONCE command...\n");
     
     // NONCE command with mode 0x03 (Pass-through mode)
     // This directly loads the 32-byte input into TempKey without hashing
-    int ret = atecc608a_send_command(ATECC_CMD_NONCE, 0x03, 0x0000, 
-                                    data, 32, response, &response_len, 10);
+    int ret = cmd_nonce_load_run(&c, 0x0000, data, NULL, NULL);
     
     if (ret != 0) {
-        printk("Failed to execute NONCE command\n");
+        LOG_ERROR("Failed to execute NONCE command\n");
         return -1;
     }
     
     // Check if NONCE command was successful (status byte should be 0x00)
-    if (response[1] != 0x00) {
-        printk("NONCE command failed with error code: 0x%02x\n", response[1]);
+    if (c.status != ATECC_ST_OK) {
+        LOG_ERROR("NONCE command failed: %s (%x)\n", atecc_strstatus(c.status), c.status);
         return -1;
     }
     
@@ -447,18 +992,46 @@ int atecc608a_load_tempkey(const uint8_t *data) {
     return 0;
 }
 
-int atecc608a_verify(const uint8_t *msg, const uint8_t *signature, const uint8_t *public_key) {
+// on their own these leave the chip idle, not asleep, so TempKey
+// survives from one to the next.
+int atecc608a_verify_signature(const uint8_t *signature, const uint8_t *public_key) {
+    if (atecc_session_begin() < 0)
+        return -1;
+    int ret = verify_cmd(signature, public_key);
+    atecc_session_end(1);
+    return ret;
+}
+
+int atecc608a_load_tempkey(const uint8_t *data) {
+    if (atecc_session_begin() < 0)
+        return -1;
+    int ret = load_tempkey_cmd(data);
+    atecc_session_end(1);
+    return ret;
+}
+
+int atecc608a_verify_chip(const uint8_t *msg, const uint8_t *signature, const uint8_t *public_key) {
+    if (atecc_session_begin() < 0)
+        return -1;
+
     // Load the message digest into TempKey
-    int ret = atecc608a_load_tempkey(msg);
+    int ret = load_tempkey_cmd(msg);
     if (ret != 0) {
-        printk("Failed to load message into TempKey\n");
+        LOG_ERROR("Failed to load message into TempKey\n");
+        atecc_session_end(0);
         return -1;
     }
     // Verify the signature against the public key
-    ret = atecc608a_verify_signature(signature, public_key);
-    
-    // Put the device to sleep to save power
-    atecc608a_sleep();
+    ret = verify_cmd(signature, public_key);
     
+    atecc_session_end(0);
     return ret;
-}
\ No newline at end of file
+}
+
+int atecc608a_verify(const uint8_t *msg, const uint8_t *signature, const uint8_t *public_key) {
+#if ATECC_VERIFY_ON_CHIP
+    return atecc608a_verify_chip(msg, signature, public_key);
+#else
+    return p256_verify(public_key, msg, signature) ? 0 : 1;
+#endif
+}
@@ -6,6 +6,9 @@
 // ATECC608A I2C address (7-bit)
 #define ATECC608A_ADDR 0x60
 
+// biggest response: count + 64-byte signature/key + CRC.
+#define ATECC_RESP_MAX 72
+
 // ATECC608A commands
 #define ATECC_CMD_CHECKMAC    0x28
 #define ATECC_CMD_COUNTER     0x24
@@ -25,23 +28,188 @@
 #define ATECC_CMD_VERIFY      0x45
 #define ATECC_CMD_WRITE       0x12
 
-// Initialize the ATECC608A
+// status byte of a 4-byte response (datasheet table 9-4).
+enum {
+    ATECC_ST_OK         = 0x00,
+    ATECC_ST_MISCOMPARE = 0x01,  // VERIFY: signature does not match
+    ATECC_ST_PARSE      = 0x03,  // bad opcode, mode or length
+    ATECC_ST_ECC_FAULT  = 0x05,  // try again
+    ATECC_ST_SELFTEST   = 0x07,
+    ATECC_ST_HEALTH     = 0x08,  // RNG health test failed
+    ATECC_ST_EXEC       = 0x0F,  // could not execute (e.g. no TempKey)
+    ATECC_ST_WAKE       = 0x11,  // after a wake, before the first command
+    ATECC_ST_WATCHDOG   = 0xEE,  // would run past the watchdog
+    ATECC_ST_CRC        = 0xFF,  // command arrived with a bad CRC
+};
+const char *atecc_strstatus(uint8_t status);
+
+// the response's CRC (or count) was wrong even after re-reading it.
+// chosen clear of I2C_ERR_*, which the same calls return.
+#define ATECC_ERR_CRC (-16)
+// i2c_strerror plus ATECC_ERR_CRC.
+const char *atecc_strerror(int err);
+
+// a garbled response is still in the chip: reset its address counter
+// and read it again (~1ms at 100kHz), never run the command twice.
+#define ATECC_RESP_REREADS 2
+// a command the chip answers ATECC_ST_CRC never ran: send it again
+// this many times.
+#define ATECC_CMD_RESENDS  1
+
+// CRC-16 used by the command and response packets.
+uint16_t calculate_crc16(size_t length, const uint8_t *data);
+// continue a CRC-16 over another piece of a packet (start with 0).
+uint16_t atecc_crc16_update(uint16_t crc, const uint8_t *data, size_t length);
+// same, one bit at a time: slow, kept to check the table against.
+uint16_t atecc_crc16_update_bitwise(uint16_t crc, const uint8_t *data, size_t length);
+
+// hold SDA low for tWLO: wakes every device on the bus.
+void atecc_wake_pulse(void);
+
+// one command's packet framing.  nothing is copied: the command data
+// goes out from the caller's buffer between the header and CRC built
+// here, and the response payload is read straight into the caller's
+// buffer between the count and CRC that land here.  one cache line.
+typedef struct {
+    uint8_t hdr[6];     // word address (0x03), count, opcode, p1, p2.
+    uint8_t crc[2];
+    uint8_t count;      // response count byte.
+    uint8_t status;     // a 4-byte response's status byte, else 0.
+    uint8_t rcrc[2];    // response CRC.
+} __attribute__((aligned(32))) atecc_ctx_t;
+
+// split-phase commands for the device at <addr>, so the caller can
+// do something else while it executes.  send returns 0 or < 0
+// (I2C_ERR_*); NACK means the device is asleep or still busy.
+// <c> must stay put until the send returns.
+int atecc_ctx_send(atecc_ctx_t *c, uint8_t addr, uint8_t cmd, uint8_t p1, uint16_t p2,
+                   const uint8_t *data, uint8_t data_len);
+// collect the response: a payload (at most <max> bytes) goes to <out>
+// and its length is returned; a 4-byte status response returns 0 with
+// the byte in c->status.  I2C_ERR_NACK while the device is still
+// executing, or another I2C_ERR_*.  the CRC is checked, and a bad one
+// re-read up to ATECC_RESP_REREADS times before ATECC_ERR_CRC.
+int atecc_ctx_recv(atecc_ctx_t *c, uint8_t addr, uint8_t *out, unsigned max);
+
+// the same with the whole response packet in <resp> (at most <max>
+// bytes): returns its length including the count byte and CRC.
+int atecc_cmd_send(uint8_t addr, uint8_t cmd, uint8_t p1, uint16_t p2,
+                   const uint8_t *data, uint8_t data_len);
+int atecc_cmd_recv(uint8_t addr, uint8_t *resp, unsigned max);
+
+// Initialize the ATECC608A: 0, or -1 if it did not answer the wake
+// pulse with its wake token.
 int atecc608a_wakeup(void);
 int atecc608a_sleep(void);
+// idle keeps TempKey; sleep does not.  both need a wake after.
+int atecc608a_idle(void);
+
+// the chip puts itself to sleep this long after a wake, busy or
+// not (tWATCHDOG, datasheet typical).  we refresh it this much early.
+#define ATECC_WATCHDOG_USEC         1300000
+#define ATECC_WATCHDOG_MARGIN_USEC  100000
+
+// sessions keep the chip awake across a burst of operations, so each
+// one doesn't pay for a wake and a sleep (~0.8ms).  begin wakes the
+// chip if needed (and returns < 0 if it won't); the operations inside
+// run as they are, and a command that would outlast the watchdog gets
+// an idle+wake first.  sessions nest: only the outermost end counts.
+// it idles the chip if <more_soon> (cheaper to come back to, keeps
+// TempKey), else puts it to sleep.
+//
+// atecc608a_random / pubkey / sign / verify open their own session:
+// outside one they wake and sleep as before.
+int atecc_session_begin(void);
+int atecc_session_end(int more_soon);
+// wakes, and the idle+wakes done for the watchdog.
+unsigned atecc_session_nwakes(void);
+unsigned atecc_session_nrefreshes(void);
+// responses read again for a bad CRC, and commands sent again because
+// the chip saw a bad CRC (ATECC_ST_CRC: it ran nothing).
+unsigned atecc_resp_nrereads(void);
+unsigned atecc_cmd_nresends(void);
 int atecc608a_get_revision_info(void);
 
 int atecc608a_init(void);
 
+// for i2c_speed_probe(): 1 if an INFO command round-trips with a
+// good CRC at the current bus speed.
+int atecc608a_check_link(void *arg);
+
 // Generate a random number
 int atecc608a_random(uint8_t *rand_out);
 
 // Get the public key
 int atecc608a_pubkey(uint8_t key_id, uint8_t *pubkey);
 
+// ECDH between the P-256 key in <key_id> and the point <pubkey> (x ||
+// y): the shared x in <secret>, in the clear (so also on the bus: see
+// atecc-seal.h).  the slot must allow ECDH with output (SlotConfig
+// ReadKey bits 2 and 3, see atecc608a-config.h slot 2).  0, or -1.
+int atecc608a_ecdh(uint8_t key_id, const uint8_t *pubkey, uint8_t *secret);
+
 // Sign a message digest using a private key
 int atecc608a_sign(uint8_t key_id, const uint8_t *msg, uint8_t *signature);
 
-// Verify a signature
+// sign <n> digests with <key_id> in one wake, pipelined.  <status>,
+// if not 0, gets per digest: 0 (signed into <sig>), the chip's status
+// byte (e.g. 0x0F execution error), or < 0 (I2C_ERR_*).  a failed
+// digest does not stop the rest.  returns how many were signed, or
+// -1 if the chip would not wake.
+int atecc608a_sign_batch(uint8_t key_id, const uint8_t (*digest)[32], unsigned n,
+                         uint8_t (*sig)[64], int *status);
+
+// SHA-256 of a message of any length on the chip's engine, 64 bytes
+// per command.  init opens a session that final closes (idle, so
+// TempKey survives), and final leaves the digest in TempKey as well
+// as in <digest> (may be 0).  the SHA context lives on the chip: one
+// hash at a time, and no other command that uses TempKey in between.
+// a failure sticks until final.  each returns 0, the chip's status
+// byte, or < 0.
+typedef struct {
+    uint8_t buf[64];    // the block being filled.
+    unsigned nbuf;
+    int err;
+    int open;           // init's session is still open.
+} atecc_sha256_t;
+
+int atecc_sha256_init(atecc_sha256_t *h);
+int atecc_sha256_update(atecc_sha256_t *h, const void *data, unsigned n);
+int atecc_sha256_final(atecc_sha256_t *h, uint8_t *digest);
+
+// SHA-256 <msg> and sign the digest: what a host verifying (msg,
+// signature) with SHA-256 expects.  atecc_hash_backend picks where
+// the hashing happens: in software (sha256.h), with the digest then
+// uploaded by a NONCE, or on the chip, signing straight out of
+// TempKey in one session.
+int atecc608a_sign_message(uint8_t key_id, const void *msg, unsigned len, uint8_t *signature);
+
+// messages of at least ATECC_SHA_SW_MIN bytes hash in software.  a
+// chip SHA costs a bus round trip per 64 bytes plus a start and an
+// end, while a NONCE is one 32-byte command and software runs at CPU
+// speed, so on our numbers (fake/atecc-hash-bench, tests/13) software
+// wins at every length: 0.  raise it to keep short messages inside
+// the chip.
+#ifndef ATECC_SHA_SW_MIN
+#define ATECC_SHA_SW_MIN 0
+#endif
+enum { ATECC_HASH_CHIP, ATECC_HASH_SW };
+int atecc_hash_backend(unsigned len);
+// change the threshold at run time: returns the old one.
+unsigned atecc_sha_sw_min_set(unsigned nbytes);
+
+// Verify a signature over the 32-byte digest <msg>: 0 valid, 1 not,
+// -1 on error.  verifying needs no secrets, so by default it runs in
+// software (libpi p256.h, ~NONCE + VERIFY's 70ms off the chip) and
+// leaves the chip free to sign; atecc608a_verify_chip, or
+// -DATECC_VERIFY_ON_CHIP=1, uses the chip's VERIFY instead.  the
+// software verify caches per-key tables in the kmalloc heap, so call
+// kmalloc_init first for the fast path; with no heap it still works,
+// uncached (p256_verify_uncached).
+#ifndef ATECC_VERIFY_ON_CHIP
+#define ATECC_VERIFY_ON_CHIP 0
+#endif
 int atecc608a_verify(const uint8_t *msg, const uint8_t *signature, const uint8_t *public_key);
+int atecc608a_verify_chip(const uint8_t *msg, const uint8_t *signature, const uint8_t *public_key);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,75 @@
+// what atecc608a_sign costs over the chip's own execution time.
+//
+// the driver used to sleep a fixed 10ms for NONCE and 100ms for SIGN
+// no matter how long the chip took.  now it waits the expected time
+// from the exec table (../atecc-exec.c), ACK-polls, and learns: the
+// first sign starts from the datasheet typical, later ones from what
+// this chip actually did, and failed ones teach it nothing.
+#include "rpi.h"
+#include "i2c.h"
+#include "atecc608a.h"
+#include "atecc-exec.h"
+#include "fake-atecc.h"
+
+// a chip a bit faster than the table's typical SIGN.
+enum { NONCE_USEC = 150, SIGN_USEC = 38000, NSIGN = 8 };
+
+// the old fixed waits for the same two commands.
+enum { OLD_WAIT_USEC = 10000 + 100000 };
+
+void notmain(void) {
+    fake_i2c_slave_t *chip = fake_atecc(ATECC608A_ADDR);
+    fake_atecc_exec_usec_set(chip, ATECC_CMD_NONCE, NONCE_USEC);
+    fake_atecc_exec_usec_set(chip, ATECC_CMD_SIGN, SIGN_USEC);
+    fake_bsc_attach(chip);
+    i2c_init();
+
+    uint8_t digest[32], sig[64], expect[64];
+    unsigned t[NSIGN];
+    for(unsigned i = 0; i < NSIGN; i++) {
+        for(unsigned j = 0; j < 32; j++)
+            digest[j] = i * 7 + j;
+
+        uint64_t s = fake_time_ns();
+        if(atecc608a_sign(0, digest, sig) < 0)
+            panic("sign %d failed\n", i);
+        t[i] = (fake_time_ns() - s) / 1000;
+
+        fake_atecc_sig(ATECC608A_ADDR, digest, expect);
+        if(memcmp(sig, expect, sizeof sig) != 0)
+            panic("signature %d is wrong\n", i);
+    }
+
+    // each sign also pays for the wake, the transfers and the sleep
+    // (~12ms at 100kHz); only the waiting changes.
+    unsigned exec = NONCE_USEC + SIGN_USEC;
+    printk("chip exec %d usec per sign; the old fixed waits alone were %d usec\n",
+        exec, OLD_WAIT_USEC);
+    for(unsigned i = 0; i < NSIGN; i++)
+        printk("  sign %d: %d usec (%d over exec)\n", i, t[i], t[i] - exec);
+    atecc_exec_dump();
+
+    // the first sign waits the table's typical 50ms; once learned we
+    // should get back nearly all of the 12ms it overslept.
+    unsigned last = t[NSIGN-1];
+    unsigned overslept = 50000 - SIGN_USEC;
+    if(atecc_exec_wait_usec(ATECC_CMD_SIGN, 0x80) >= SIGN_USEC)
+        panic("learned SIGN wait is past the chip's exec time\n");
+    if(t[0] - last < overslept * 9 / 10)
+        panic("learning saved %d usec, expected about %d\n", t[0] - last, overslept);
+    // a run of fast errors (a parse error is back at once) must not
+    // drag the learned wait down.
+    unsigned learned = atecc_exec_wait_usec(ATECC_CMD_SIGN, 0x80);
+    fake_atecc_exec_usec_set(chip, ATECC_CMD_SIGN, 100);
+    for(unsigned i = 0; i < NSIGN; i++) {
+        fake_atecc_fail_next(chip, ATECC_CMD_SIGN, ATECC_ST_PARSE);
+        if(atecc608a_sign(0, digest, sig) >= 0)
+            panic("failed sign %d reported as signed\n", i);
+    }
+    if(atecc_exec_wait_usec(ATECC_CMD_SIGN, 0x80) != learned)
+        panic("%d failed signs moved the SIGN wait from %d to %d usec\n",
+            NSIGN, learned, atecc_exec_wait_usec(ATECC_CMD_SIGN, 0x80));
+
+    printk("SUCCESS: sign takes %d usec after learning (first %d), "
+        "the fixed waits alone took %d\n", last, t[0], OLD_WAIT_USEC);
+}
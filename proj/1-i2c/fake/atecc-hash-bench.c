@@ -0,0 +1,60 @@
+// sign_message with the hash on the chip vs in software, by message
+// length: bus commands and (virtual) usec for each.  the software
+// hash's own CPU time is not on the fake's clock: tests/13 measures
+// it on the pi (a few usec per kilobyte against ~1ms per chip block).
+#include "rpi.h"
+#include "i2c.h"
+#include "atecc608a.h"
+#include "fake-atecc.h"
+#include "fake-sha256.h"
+
+static uint8_t msg[4096];
+
+// sign <n> bytes with <sw_min>: returns usec, <ncmds> gets the
+// commands the chip ran.
+static unsigned sign_len(fake_i2c_slave_t *chip, unsigned n, unsigned sw_min, unsigned *ncmds) {
+    uint8_t sig[64], d[32], expect[64];
+    atecc_sha_sw_min_set(sw_min);
+    unsigned c = fake_atecc_stats(chip).ncmds;
+    uint64_t t = fake_time_ns();
+    if(atecc608a_sign_message(0, msg, n, sig) < 0)
+        panic("sign of %d bytes failed\n", n);
+    t = fake_time_ns() - t;
+    *ncmds = fake_atecc_stats(chip).ncmds - c;
+    fake_sha256(msg, n, d);
+    fake_atecc_sig(ATECC608A_ADDR, d, expect);
+    if(memcmp(sig, expect, 64) != 0)
+        panic("%d bytes: signed the wrong digest\n", n);
+    return t / 1000;
+}
+
+void notmain(void) {
+    fake_i2c_slave_t *chip = fake_atecc(ATECC608A_ADDR);
+    fake_atecc_exec_usec_set(chip, ATECC_CMD_NONCE, 150);
+    fake_atecc_exec_usec_set(chip, ATECC_CMD_SHA, 500);
+    fake_atecc_exec_usec_set(chip, ATECC_CMD_SIGN, 38000);
+    fake_bsc_attach(chip);
+    i2c_init();
+    for(unsigned i = 0; i < sizeof msg; i++)
+        msg[i] = i ^ (i >> 8);
+
+    // learn the exec times for both paths first.
+    unsigned nc;
+    for(unsigned i = 0; i < 8; i++) {
+        sign_len(chip, 200, ~0u, &nc);
+        sign_len(chip, 200, 0, &nc);
+    }
+
+    static const unsigned lens[] = { 0, 13, 55, 64, 128, 300, 1024, 4096 };
+    printk("bytes: chip sha (cmds, usec) | software sha (cmds, usec)\n");
+    for(unsigned i = 0; i < sizeof lens / sizeof lens[0]; i++) {
+        unsigned n = lens[i], chip_cmds, sw_cmds;
+        unsigned chip_us = sign_len(chip, n, ~0u, &chip_cmds);
+        unsigned sw_us = sign_len(chip, n, 0, &sw_cmds);
+        printk("%d: %d, %d | %d, %d\n", n, chip_cmds, chip_us, sw_cmds, sw_us);
+        if(sw_us >= chip_us)
+            panic("%d bytes: software path was not faster on the bus\n", n);
+    }
+    atecc_sha_sw_min_set(ATECC_SHA_SW_MIN);
+    printk("SUCCESS: software hashing wins on the bus at every length\n");
+}
@@ -0,0 +1,94 @@
+// what the driver's logging costs per command, with printk spinning
+// on a 115200 baud UART as it does on the pi.
+//
+// built twice: "make" at the default level (ERROR) has to get through
+// a sign with no printk at all; "make LOG=trace" builds it with every
+// level on.  compare the two runs' cycles per sign: at 100kHz a sign
+// went from ~62M cycles to ~36M.
+#include "rpi.h"
+#include "i2c.h"
+#include "i2c-log.h"
+#include "cycle-count.h"
+#include "atecc608a.h"
+#include "fake-atecc.h"
+
+enum { NOPS = 8, BAUD = 115200 };
+
+typedef struct {
+    unsigned cyc, uart_cyc, nprintk;
+} cost_t;
+
+// fake cycle counter: 700MHz.
+static unsigned ns_to_cyc(uint64_t ns) { return ns * 7 / 10; }
+
+static void sign_op(unsigned i) {
+    uint8_t digest[32], sig[64], expect[64];
+    for(unsigned j = 0; j < 32; j++)
+        digest[j] = i * 3 + j;
+    if(atecc608a_sign(0, digest, sig) < 0)
+        panic("sign %d failed\n", i);
+    fake_atecc_sig(ATECC608A_ADDR, digest, expect);
+    if(memcmp(sig, expect, sizeof sig) != 0)
+        panic("signature %d is wrong\n", i);
+}
+
+static void random_op(unsigned i) {
+    uint8_t r[32];
+    if(atecc608a_random(r) < 0)
+        panic("random %d failed\n", i);
+}
+
+// average over <NOPS> runs of <op>.
+static cost_t measure(void (*op)(unsigned)) {
+    unsigned np = fake_nprintk();
+    uint64_t u = fake_uart_ns();
+    unsigned s = cycle_cnt_read();
+    for(unsigned i = 0; i < NOPS; i++)
+        op(i);
+    unsigned cyc = cycle_cnt_read() - s;
+    return (cost_t) {
+        .cyc = cyc / NOPS,
+        .uart_cyc = ns_to_cyc(fake_uart_ns() - u) / NOPS,
+        .nprintk = (fake_nprintk() - np) / NOPS,
+    };
+}
+
+static void report(const char *name, cost_t c) {
+    // printing after a send overlaps the chip's execution, so the
+    // two builds' totals differ by less than <uart_cyc>.
+    printk("  %s: %d cycles (%d usec), %d printks, %d cycles of them printing\n",
+        name, c.cyc, c.cyc / 700, c.nprintk, c.uart_cyc);
+}
+
+void notmain(void) {
+    fake_i2c_slave_t *chip = fake_atecc(ATECC608A_ADDR);
+    fake_atecc_exec_usec_set(chip, ATECC_CMD_NONCE, 150);
+    fake_atecc_exec_usec_set(chip, ATECC_CMD_SIGN, 38000);
+    fake_atecc_exec_usec_set(chip, ATECC_CMD_RANDOM, 2000);
+    fake_bsc_attach(chip);
+    i2c_init();
+
+    // one untimed sign so both runs start from a learned exec table.
+    sign_op(0);
+    random_op(0);
+
+    fake_uart_baud_set(BAUD);
+    cost_t sign = measure(sign_op);
+    cost_t rand = measure(random_op);
+    fake_uart_baud_set(0);
+
+    printk("log level %d, UART at %d baud, per operation:\n", I2C_LOG_LEVEL, BAUD);
+    report("sign", sign);
+    report("random", rand);
+
+    if(!I2C_LOG_ON(I2C_LOG_INFO)) {
+        if(sign.nprintk || rand.nprintk)
+            panic("release build printed in the command path\n");
+        printk("SUCCESS: no printk on the way through a sign (%d cycles)\n", sign.cyc);
+    } else {
+        if(!sign.nprintk)
+            panic("level %d printed nothing\n", I2C_LOG_LEVEL);
+        printk("SUCCESS: logging at level %d costs %d cycles (%d usec) per sign\n",
+            I2C_LOG_LEVEL, sign.uart_cyc, sign.uart_cyc / 700);
+    }
+}
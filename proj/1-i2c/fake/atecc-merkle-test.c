@@ -0,0 +1,176 @@
+// Merkle batch signing: one SIGN per batch whatever its size, every
+// receipt leading back to the signed root, receipts surviving the
+// wire format, and any change to a digest, path, index or count
+// leading somewhere else.  then the cost per digest against
+// atecc608a_sign one at a time and atecc608a_sign_batch.
+#include "rpi.h"
+#include "i2c.h"
+#include "atecc608a.h"
+#include "atecc-merkle.h"
+#include "fake-atecc.h"
+
+enum { NMAX = ATECC_MERKLE_MAX };
+
+static atecc_merkle_t batch;
+static uint8_t digest[NMAX][32], sig[NMAX][64];
+static int status[NMAX];
+
+// the root of the first 5 digests, from proj/2-py-util/merkle-verify.py's
+// build(): the host side agrees on the tree.
+static const uint8_t root5[32] = {
+    0xc6, 0x1a, 0xff, 0xfa, 0xe2, 0xff, 0xee, 0x36, 0x50, 0x2e, 0xb7, 0x2f, 0x4f, 0x82, 0x7e, 0x58,
+    0x7f, 0xb1, 0x0b, 0x88, 0x24, 0x7e, 0xa6, 0x89, 0x0d, 0x44, 0xf2, 0x44, 0x86, 0xf0, 0x76, 0x3e,
+};
+
+static void fill(void) {
+    for(unsigned i = 0; i < NMAX; i++)
+        for(unsigned j = 0; j < 32; j++)
+            digest[i][j] = i * 131 + j * 7;
+}
+
+// fill, add and sign <n> digests: usec of fake time for the signing.
+static unsigned sign_batch(unsigned n) {
+    atecc_merkle_init(&batch);
+    for(unsigned i = 0; i < n; i++)
+        if(atecc_merkle_add(&batch, digest[i]) != i)
+            panic("batch of %d: digest %d not taken\n", n, i);
+    uint64_t s = fake_time_ns();
+    if(atecc_merkle_sign(&batch, 0) < 0)
+        panic("batch of %d: signing failed\n", n);
+    return (fake_time_ns() - s) / 1000;
+}
+
+// every receipt of the batch leads to its root and survives the wire;
+// nothing else does.  returns how many forgeries were tried.
+static unsigned check_batch(unsigned n) {
+    uint8_t expect[64], root[32], wire[ATECC_MERKLE_PROOF_BYTES(ATECC_MERKLE_DEPTH)];
+    unsigned nforged = 0;
+
+    fake_atecc_sig(ATECC608A_ADDR, batch.root, expect);
+    for(unsigned i = 0; i < n; i++) {
+        atecc_merkle_proof_t p, q;
+        atecc_merkle_proof(&batch, i, &p);
+        if(memcmp(p.root_sig, expect, 64) != 0)
+            panic("batch of %d: receipt %d carries the wrong signature\n", n, i);
+        if(atecc_merkle_root(root, digest[i], &p) < 0 || memcmp(root, batch.root, 32) != 0)
+            panic("batch of %d: receipt %d does not lead to the root\n", n, i);
+        if(p.npath > ATECC_MERKLE_DEPTH || (n > 1 && !p.npath))
+            panic("batch of %d: receipt %d has a %d-hash path\n", n, i, p.npath);
+
+        unsigned len = atecc_merkle_proof_pack(wire, &p);
+        if(atecc_merkle_proof_unpack(&q, wire, len) != len
+        || atecc_merkle_root(root, digest[i], &q) < 0 || memcmp(root, batch.root, 32) != 0)
+            panic("batch of %d: receipt %d did not survive the wire\n", n, i);
+        if(atecc_merkle_proof_unpack(&q, wire, len - 1) != -1)
+            panic("batch of %d: short receipt %d parsed\n", n, i);
+
+        // a changed digest or path hash.
+        uint8_t d[32];
+        memcpy(d, digest[i], 32);
+        d[i % 32] ^= 1;
+        atecc_merkle_root(root, d, &p);
+        nforged++;
+        if(memcmp(root, batch.root, 32) == 0)
+            panic("batch of %d: receipt %d accepts another digest\n", n, i);
+        for(unsigned k = 0; k < p.npath; k++, nforged++) {
+            q = p;
+            q.path[k][k] ^= 0x80;
+            atecc_merkle_root(root, digest[i], &q);
+            if(memcmp(root, batch.root, 32) == 0)
+                panic("batch of %d: receipt %d path hash %d not checked\n", n, i, k);
+        }
+        // another digest's place, or another batch size.
+        if(n > 1) {
+            q = p;
+            q.index = (i + 1) % n;
+            nforged++;
+            if(atecc_merkle_root(root, digest[i], &q) == 0 && memcmp(root, batch.root, 32) == 0)
+                panic("batch of %d: receipt %d moved to %d\n", n, i, q.index);
+        }
+        q = p;
+        q.n = n + 1;
+        nforged++;
+        if(n < NMAX && atecc_merkle_root(root, digest[i], &q) == 0
+        && memcmp(root, batch.root, 32) == 0)
+            panic("batch of %d: receipt %d passes for a batch of %d\n", n, i, n + 1);
+    }
+    return nforged;
+}
+
+void notmain(void) {
+    fake_i2c_slave_t *chip = fake_atecc(ATECC608A_ADDR);
+    fake_atecc_exec_usec_set(chip, ATECC_CMD_NONCE, 150);
+    fake_atecc_exec_usec_set(chip, ATECC_CMD_SIGN, 38000);
+    fake_bsc_attach(chip);
+    i2c_init();
+    i2c_set_speed(I2C_FAST);
+    fill();
+
+    // one SIGN whatever the size, odd levels and all.
+    static const unsigned sizes[] = { 1, 2, 3, 4, 5, 7, 8, 9, 33, 64, 100, 255, NMAX };
+    unsigned nforged = 0;
+    for(unsigned k = 0; k < sizeof sizes / sizeof sizes[0]; k++) {
+        unsigned n = sizes[k];
+        fake_atecc_stats_t st = fake_atecc_stats(chip);
+        sign_batch(n);
+        unsigned ncmds = fake_atecc_stats(chip).ncmds - st.ncmds;
+        if(ncmds != 2)
+            panic("batch of %d: %d commands, not one NONCE + SIGN\n", n, ncmds);
+        nforged += check_batch(n);
+    }
+
+    // every size fits the node array (atecc_merkle_sign asserts it),
+    // the odd carries of n = 2^k + 1 included.
+    for(unsigned n = 1; n <= NMAX; n++)
+        sign_batch(n);
+
+    // full, signed, or empty.
+    uint8_t d[32] = {0};
+    if(atecc_merkle_add(&batch, d) != -1 || atecc_merkle_sign(&batch, 0) != -1)
+        panic("signed batch still open\n");
+    atecc_merkle_init(&batch);
+    if(atecc_merkle_sign(&batch, 0) != -1)
+        panic("empty batch signed\n");
+    // a failed SIGN leaves the batch unsigned, to sign again.
+    atecc_merkle_add(&batch, d);
+    fake_atecc_fail_next(chip, ATECC_CMD_SIGN, 0x0f);
+    if(atecc_merkle_sign(&batch, 0) != -1 || atecc_merkle_sign(&batch, 0) != 0)
+        panic("failed root signature not reported or not retried\n");
+
+    // two batches of the same digests differing in size: different
+    // roots, so no receipt moves between them.
+    uint8_t root4[32];
+    sign_batch(4);
+    memcpy(root4, batch.root, 32);
+    sign_batch(5);
+    if(memcmp(root4, batch.root, 32) == 0)
+        panic("batches of 4 and 5 share a root\n");
+    if(memcmp(root5, batch.root, 32) != 0)
+        panic("root of 5 differs from merkle-verify.py's\n");
+
+    // what a digest costs in chip and bus time (the tree's ~2 hashes
+    // per digest are cpu time: tests/18 has those).
+    uint64_t s = fake_time_ns();
+    for(unsigned i = 0; i < 16; i++)
+        if(atecc608a_sign(0, digest[i], sig[i]) < 0)
+            panic("sign %d failed\n", i);
+    unsigned single = (fake_time_ns() - s) / 1000 / 16;
+    s = fake_time_ns();
+    if(atecc608a_sign_batch(0, digest, 32, sig, status) != 32)
+        panic("sign_batch failed\n");
+    unsigned batched = (fake_time_ns() - s) / 1000 / 32;
+    printk("atecc608a_sign: %d usec/digest, atecc608a_sign_batch of 32: %d usec/digest\n",
+        single, batched);
+
+    unsigned merkle = 0;
+    for(unsigned n = 16; n <= NMAX; n *= 2) {
+        unsigned usec = sign_batch(n);
+        merkle = usec / n;
+        printk("merkle batch %d: %d usec, %d usec/digest\n", n, usec, merkle);
+    }
+    if(merkle * 100 > single)
+        panic("a batch of %d is not 100x cheaper per digest\n", NMAX);
+
+    printk("SUCCESS: merkle batches sign once (%d usec/digest at %d vs %d singly), "
+        "%d forged receipts refused\n", merkle, NMAX, single, nforged);
+}
@@ -0,0 +1,84 @@
+// response integrity: a SIGN whose response is garbled on the wire
+// is read again, not signed again, and costs about one extra read; a
+// response that stays garbled fails with ATECC_ERR_CRC; a command the
+// chip saw with a bad CRC is sent again; status bytes decode.
+#include "rpi.h"
+#include "i2c.h"
+#include "atecc608a.h"
+#include "fake-atecc.h"
+
+static uint8_t digest[32], expect[64];
+
+// one sign: returns usec, <ret> gets its result.
+static unsigned sign_once(int *ret, uint8_t sig[64]) {
+    uint64_t s = fake_time_ns();
+    *ret = atecc608a_sign(0, digest, sig);
+    return (fake_time_ns() - s) / 1000;
+}
+
+void notmain(void) {
+    fake_i2c_slave_t *chip = fake_atecc(ATECC608A_ADDR);
+    fake_atecc_exec_usec_set(chip, ATECC_CMD_NONCE, 150);
+    fake_atecc_exec_usec_set(chip, ATECC_CMD_SIGN, 38000);
+    fake_bsc_attach(chip);
+    i2c_init();
+
+    for(unsigned i = 0; i < 32; i++)
+        digest[i] = i * 7 + 1;
+    fake_atecc_sig(ATECC608A_ADDR, digest, expect);
+
+    uint8_t sig[64];
+    int ret;
+    // warm the exec table so the timings compare.
+    for(unsigned i = 0; i < 8; i++)
+        sign_once(&ret, sig);
+    unsigned clean = sign_once(&ret, sig);
+    if(ret < 0 || memcmp(sig, expect, 64) != 0)
+        panic("clean sign failed\n");
+
+    // noise on both responses: one re-read each, no second SIGN.
+    fake_atecc_stats_t st = fake_atecc_stats(chip);
+    unsigned rr = atecc_resp_nrereads();
+    fake_atecc_corrupt_next(chip, 2);
+    unsigned noisy = sign_once(&ret, sig);
+    fake_atecc_stats_t st2 = fake_atecc_stats(chip);
+    unsigned ncmds = st2.ncmds - st.ncmds;
+    rr = atecc_resp_nrereads() - rr;
+    printk("clean sign: %d usec; two garbled responses: %d usec (+%d), %d re-reads, %d commands\n",
+        clean, noisy, noisy - clean, rr, ncmds);
+    if(ret < 0 || memcmp(sig, expect, 64) != 0)
+        panic("garbled response was not recovered\n");
+    if(ncmds != 2 || rr != 2)
+        panic("expected 2 commands and 2 re-reads, got %d and %d\n", ncmds, rr);
+    if((int)(noisy - clean) > 2 * 1500)
+        panic("re-reads cost %d usec\n", noisy - clean);
+
+    // stays garbled past ATECC_RESP_REREADS: a clean error, not a
+    // bad signature.
+    fake_atecc_corrupt_next(chip, 1 + 1 + ATECC_RESP_REREADS);
+    sign_once(&ret, sig);
+    if(ret == 0)
+        panic("persistently garbled response reported success\n");
+    if(atecc_strerror(ATECC_ERR_CRC) == i2c_strerror(ATECC_ERR_CRC))
+        panic("ATECC_ERR_CRC has no message\n");
+    fake_atecc_corrupt_next(chip, 0);
+
+    // the chip got a garbled SIGN: it ran nothing, so it is resent.
+    unsigned rs = atecc_cmd_nresends();
+    fake_atecc_fail_next(chip, ATECC_CMD_SIGN, ATECC_ST_CRC);
+    sign_once(&ret, sig);
+    if(ret < 0 || memcmp(sig, expect, 64) != 0 || atecc_cmd_nresends() - rs != 1)
+        panic("command CRC error was not resent\n");
+
+    // a real error status is reported, not retried.
+    fake_atecc_fail_next(chip, ATECC_CMD_SIGN, ATECC_ST_EXEC);
+    rs = atecc_cmd_nresends();
+    sign_once(&ret, sig);
+    if(ret == 0 || atecc_cmd_nresends() != rs)
+        panic("execution error was retried or ignored\n");
+    printk("status %x: %s, %x: %s\n", ATECC_ST_EXEC, atecc_strstatus(ATECC_ST_EXEC),
+        ATECC_ST_CRC, atecc_strstatus(ATECC_ST_CRC));
+
+    printk("SUCCESS: garbled responses cost a re-read (+%d usec), never a re-sign\n",
+        noisy - clean);
+}
@@ -0,0 +1,71 @@
+// what a session (atecc_session_begin/end) saves over waking and
+// sleeping the chip around every operation, and that a session
+// longer than the chip's 1.3s watchdog survives it.
+#include "rpi.h"
+#include "i2c.h"
+#include "atecc608a.h"
+#include "fake-atecc.h"
+
+enum { NSIGN = 10, NLONG = 40 };
+
+static void sign_one(unsigned i) {
+    uint8_t digest[32], sig[64], expect[64];
+    for(unsigned j = 0; j < 32; j++)
+        digest[j] = i * 5 + j;
+    if(atecc608a_sign(0, digest, sig) < 0)
+        panic("sign %d failed\n", i);
+    fake_atecc_sig(ATECC608A_ADDR, digest, expect);
+    if(memcmp(sig, expect, sizeof sig) != 0)
+        panic("signature %d is wrong\n", i);
+}
+
+// <n> signs, in a session or not: returns usec.
+static unsigned sign_n(unsigned n, int session) {
+    uint64_t s = fake_time_ns();
+    if(session && atecc_session_begin() < 0)
+        panic("session did not start\n");
+    for(unsigned i = 0; i < n; i++)
+        sign_one(i);
+    if(session)
+        atecc_session_end(0);
+    return (fake_time_ns() - s) / 1000;
+}
+
+void notmain(void) {
+    fake_i2c_slave_t *chip = fake_atecc(ATECC608A_ADDR);
+    fake_atecc_exec_usec_set(chip, ATECC_CMD_NONCE, 150);
+    fake_atecc_exec_usec_set(chip, ATECC_CMD_SIGN, 38000);
+    fake_bsc_attach(chip);
+    i2c_init();
+
+    // warm the exec table so both runs wait the same.
+    sign_n(4, 0);
+
+    unsigned w = fake_atecc_stats(chip).nwakes;
+    unsigned t_each = sign_n(NSIGN, 0);
+    unsigned wakes_each = fake_atecc_stats(chip).nwakes - w;
+
+    w = fake_atecc_stats(chip).nwakes;
+    unsigned t_sess = sign_n(NSIGN, 1);
+    unsigned wakes_sess = fake_atecc_stats(chip).nwakes - w;
+
+    printk("%d signs, wake/sleep each: %d usec, %d wakes\n", NSIGN, t_each, wakes_each);
+    printk("%d signs, one session:     %d usec, %d wakes\n", NSIGN, t_sess, wakes_sess);
+    printk("saved %d usec per sign\n", (t_each - t_sess) / NSIGN);
+    if(wakes_each != NSIGN || wakes_sess != 1)
+        panic("expected %d wakes without a session and 1 with\n", NSIGN);
+    if(t_sess >= t_each)
+        panic("session was not faster\n");
+
+    // longer than the watchdog: the session has to idle+wake on its
+    // own before the chip drops off.
+    unsigned r = atecc_session_nrefreshes();
+    unsigned t_long = sign_n(NLONG, 1);
+    r = atecc_session_nrefreshes() - r;
+    printk("%d signs in one session: %d usec, %d watchdog refreshes\n", NLONG, t_long, r);
+    if(!r || fake_atecc_stats(chip).nwatchdogs)
+        panic("watchdog: %d refreshes, %d expiries\n", r, fake_atecc_stats(chip).nwatchdogs);
+
+    printk("SUCCESS: sessions save %d usec per sign and outlive the watchdog\n",
+        (t_each - t_sess) / NSIGN);
+}
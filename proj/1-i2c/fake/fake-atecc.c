@@ -0,0 +1,325 @@
+// simulated ATECC608A: see <fake-atecc.h>.
+#include "rpi.h"
+#include "atecc608a.h"
+#include "fake-atecc.h"
+#include "fake-sha256.h"
+
+enum { CMD_MAX = 160, RESP_MAX = 80 };
+
+// tWATCHDOG: asleep this long after the wake, busy or not.
+#define WATCHDOG_NS (1300 * 1000 * 1000ULL)
+
+// status codes (datasheet table 9-4).
+enum {
+    ST_OK       = 0x00,
+    ST_PARSE    = 0x03,
+    ST_EXEC     = 0x0f,
+    ST_WAKE     = 0x11,
+    ST_CRC      = 0xff,
+};
+
+typedef struct {
+    uint8_t addr;
+    int awake;
+    uint64_t woke_ns;
+    // not listening before this.
+    uint64_t busy_until_ns;
+    unsigned exec_usec[256];
+    // the next <fail_op> answers <fail_status> (0 = none).
+    uint8_t fail_op, fail_status;
+    // the next <ncorrupt> reads of a command response's last byte get
+    // a bit flipped on the wire.  not the wake token.
+    unsigned ncorrupt;
+    int cmd_resp;
+
+    // current transfer: we ACKed it, and its word address.
+    int active, first;
+    uint8_t word;
+
+    uint8_t cmd[CMD_MAX];
+    unsigned ncmd;
+    uint8_t resp[RESP_MAX];
+    unsigned nresp, rptr;
+
+    uint8_t tempkey[32];
+    int tempkey_valid;
+    // SHA context between Start and End.
+    fake_sha256_t sha;
+    int sha_active;
+    uint32_t rng;
+
+    fake_atecc_stats_t stats;
+} atecc_t;
+
+void fake_atecc_sig(uint8_t addr, const uint8_t digest[32], uint8_t sig[64]) {
+    for(unsigned i = 0; i < 64; i++)
+        sig[i] = digest[i % 32] ^ (addr + i * 13);
+}
+
+void fake_atecc_ecdh(uint8_t addr, uint16_t slot, const uint8_t point[64], uint8_t secret[32]) {
+    uint8_t m[3 + 64];
+    m[0] = addr;
+    m[1] = slot;
+    m[2] = slot >> 8;
+    memcpy(&m[3], point, 64);
+    fake_sha256(m, sizeof m, secret);
+}
+
+// response packet: count, data, CRC.
+static void respond(atecc_t *a, const uint8_t *data, unsigned n) {
+    assert(n + 3 <= RESP_MAX);
+    a->resp[0] = n + 3;
+    memcpy(&a->resp[1], data, n);
+    uint16_t crc = calculate_crc16(n + 1, a->resp);
+    a->resp[n+1] = crc & 0xff;
+    a->resp[n+2] = crc >> 8;
+    a->nresp = n + 3;
+    a->rptr = 0;
+}
+static void respond_status(atecc_t *a, uint8_t status) {
+    respond(a, &status, 1);
+}
+
+static void execute(atecc_t *a) {
+    unsigned count = a->cmd[0];
+    a->cmd_resp = 1;
+    if(count < 7 || count != a->ncmd) {
+        a->stats.ncrc_errs++;
+        respond_status(a, ST_CRC);
+        return;
+    }
+    uint16_t crc = calculate_crc16(count - 2, a->cmd);
+    if(a->cmd[count-2] != (crc & 0xff) || a->cmd[count-1] != (crc >> 8)) {
+        a->stats.ncrc_errs++;
+        respond_status(a, ST_CRC);
+        return;
+    }
+
+    uint8_t op = a->cmd[1], p1 = a->cmd[2];
+    uint16_t p2 = a->cmd[3] | a->cmd[4] << 8;
+    const uint8_t *data = &a->cmd[5];
+    unsigned ndata = count - 7;
+    uint8_t out[64];
+
+    a->stats.ncmds++;
+    a->busy_until_ns = fake_time_ns() + a->exec_usec[op] * 1000ULL;
+
+    if(a->fail_op && op == a->fail_op) {
+        a->fail_op = 0;
+        respond_status(a, a->fail_status);
+        return;
+    }
+
+    switch(op) {
+    case ATECC_CMD_INFO: {
+        uint8_t rev[4] = { 0x00, 0x00, 0x60, 0x02 };
+        respond(a, rev, sizeof rev);
+        break;
+    }
+    case ATECC_CMD_RANDOM:
+        for(unsigned i = 0; i < 32; i++) {
+            a->rng = a->rng * 1103515245 + 12345;
+            out[i] = a->rng >> 16;
+        }
+        respond(a, out, 32);
+        break;
+    case ATECC_CMD_NONCE:
+        if(p1 != 0x03 || ndata != 32) {
+            respond_status(a, ST_PARSE);
+            break;
+        }
+        memcpy(a->tempkey, data, 32);
+        a->tempkey_valid = 1;
+        respond_status(a, ST_OK);
+        break;
+    case ATECC_CMD_SIGN:
+        if(p1 != 0x80) {
+            respond_status(a, ST_PARSE);
+            break;
+        }
+        if(!a->tempkey_valid) {
+            respond_status(a, ST_EXEC);
+            break;
+        }
+        fake_atecc_sig(a->addr, a->tempkey, out);
+        // SIGN uses up TempKey.
+        a->tempkey_valid = 0;
+        respond(a, out, 64);
+        break;
+    case ATECC_CMD_SHA:
+        switch(p1 & 0x07) {
+        case 0x00:  // start
+            fake_sha256_init(&a->sha);
+            a->sha_active = 1;
+            respond_status(a, ST_OK);
+            break;
+        case 0x01:  // update: exactly one block
+            if(!a->sha_active || ndata != 64) {
+                respond_status(a, a->sha_active ? ST_PARSE : ST_EXEC);
+                break;
+            }
+            fake_sha256_block(&a->sha, data);
+            a->stats.nsha_blocks++;
+            respond_status(a, ST_OK);
+            break;
+        case 0x02:  // end: the last 0..63 bytes, param2 says how many
+            if(!a->sha_active || ndata > 63 || p2 != ndata) {
+                respond_status(a, a->sha_active ? ST_PARSE : ST_EXEC);
+                break;
+            }
+            fake_sha256_end(&a->sha, data, ndata, out);
+            a->sha_active = 0;
+            // mode 7:6 = 00: the digest goes to TempKey as well.
+            if((p1 & 0xc0) == 0x00) {
+                memcpy(a->tempkey, out, 32);
+                a->tempkey_valid = 1;
+            }
+            respond(a, out, 32);
+            break;
+        default:
+            respond_status(a, ST_PARSE);
+            break;
+        }
+        break;
+    case ATECC_CMD_ECDH:
+        // mode 0x0C: the shared secret out in the clear.
+        if(p1 != 0x0C || ndata != 64) {
+            respond_status(a, ST_PARSE);
+            break;
+        }
+        fake_atecc_ecdh(a->addr, p2, data, out);
+        respond(a, out, 32);
+        break;
+    default:
+        respond_status(a, ST_PARSE);
+        break;
+    }
+}
+
+static int atecc_start(fake_i2c_slave_t *s, int read_p) {
+    atecc_t *a = s->data;
+    a->active = 0;
+    if(a->awake && fake_time_ns() - a->woke_ns >= WATCHDOG_NS) {
+        a->awake = 0;
+        a->tempkey_valid = 0;
+        a->sha_active = 0;
+        a->stats.nwatchdogs++;
+    }
+    if(!a->awake)
+        return 0;
+    if(fake_time_ns() < a->busy_until_ns) {
+        a->stats.nbusy_nacks++;
+        return 0;
+    }
+    a->active = 1;
+    if(!read_p) {
+        a->first = 1;
+        a->ncmd = 0;
+    } else if(a->rptr == 0 && a->nresp)
+        a->stats.nresp_reads++;
+    return 1;
+}
+
+static int atecc_write(fake_i2c_slave_t *s, uint8_t b) {
+    atecc_t *a = s->data;
+    if(a->first) {
+        a->first = 0;
+        a->word = b;
+        if(b == 0x00)
+            a->rptr = 0;
+    } else if(a->word == 0x03 && a->ncmd < CMD_MAX)
+        a->cmd[a->ncmd++] = b;
+    return 1;
+}
+
+static uint8_t atecc_read(fake_i2c_slave_t *s) {
+    atecc_t *a = s->data;
+    if(a->rptr >= a->nresp)
+        return 0xff;
+    uint8_t b = a->resp[a->rptr++];
+    if(a->rptr == a->nresp && a->cmd_resp && a->ncorrupt) {
+        a->ncorrupt--;
+        a->stats.ncorrupted++;
+        b ^= 0x01;
+    }
+    return b;
+}
+
+static void atecc_stop(fake_i2c_slave_t *s) {
+    atecc_t *a = s->data;
+    if(!a->active)
+        return;
+    a->active = 0;
+
+    switch(a->word) {
+    case 0x01:  // sleep: loses TempKey and the SHA context.
+        a->tempkey_valid = 0;
+        a->sha_active = 0;
+        a->awake = 0;
+        break;
+    case 0x02:  // idle: keeps TempKey.
+        a->awake = 0;
+        break;
+    case 0x03:
+        if(a->ncmd)
+            execute(a);
+        break;
+    }
+    a->word = 0;
+    a->ncmd = 0;
+}
+
+static void atecc_wake(fake_i2c_slave_t *s) {
+    atecc_t *a = s->data;
+    if(a->awake)
+        return;
+    a->awake = 1;
+    a->woke_ns = fake_time_ns();
+    a->stats.nwakes++;
+    // 04 11 33 43: the status and its CRC.
+    respond_status(a, ST_WAKE);
+    a->cmd_resp = 0;
+}
+
+fake_i2c_slave_t *fake_atecc(uint8_t addr) {
+    atecc_t *a = calloc(1, sizeof *a);
+    a->addr = addr;
+    a->rng = addr;
+    a->exec_usec[ATECC_CMD_INFO] = 1000;
+    a->exec_usec[ATECC_CMD_RANDOM] = 20000;
+    a->exec_usec[ATECC_CMD_NONCE] = 1000;
+    a->exec_usec[ATECC_CMD_SIGN] = 50000;
+    a->exec_usec[ATECC_CMD_SHA] = 1000;
+    a->exec_usec[ATECC_CMD_ECDH] = 38000;
+
+    fake_i2c_slave_t *s = calloc(1, sizeof *s);
+    *s = (fake_i2c_slave_t) {
+        .name = "atecc608a",
+        .addr = addr,
+        .start = atecc_start,
+        .write = atecc_write,
+        .read = atecc_read,
+        .stop = atecc_stop,
+        .wake = atecc_wake,
+        .data = a
+    };
+    return s;
+}
+
+void fake_atecc_exec_usec_set(fake_i2c_slave_t *s, uint8_t opcode, unsigned usec) {
+    ((atecc_t *)s->data)->exec_usec[opcode] = usec;
+}
+
+void fake_atecc_fail_next(fake_i2c_slave_t *s, uint8_t opcode, uint8_t status) {
+    atecc_t *a = s->data;
+    a->fail_op = opcode;
+    a->fail_status = status;
+}
+
+void fake_atecc_corrupt_next(fake_i2c_slave_t *s, unsigned n) {
+    ((atecc_t *)s->data)->ncorrupt = n;
+}
+
+fake_atecc_stats_t fake_atecc_stats(fake_i2c_slave_t *s) {
+    return ((atecc_t *)s->data)->stats;
+}
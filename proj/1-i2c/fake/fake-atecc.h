@@ -0,0 +1,55 @@
+#ifndef __FAKE_ATECC_H__
+#define __FAKE_ATECC_H__
+// simulated ATECC608A on the fake BSC bus.
+//
+// models enough of the datasheet's I2C protocol to run the real
+// atecc608a.c / atecc-bus.c code: asleep until an SDA wake pulse,
+// word addresses (0x00 reset, 0x01 sleep, 0x02 idle, 0x03 command),
+// the watchdog (asleep 1.3s after the wake), the command CRC,
+// NACKing its address while a command executes, and response
+// packets with count and CRC.
+//
+// commands: INFO, RANDOM, NONCE pass-through (mode 3), SHA-256
+// start / update / end (end leaves the digest in TempKey) and SIGN
+// of TempKey (mode 0x80), ECDH with the secret out in the clear (mode
+// 0x0C).  anything else gets a parse error (0x03).  the "signature" is
+// not ECDSA, nor the "shared secret" ECDH: see fake_atecc_sig() and
+// fake_atecc_ecdh().
+#include "fake-bsc.h"
+
+fake_i2c_slave_t *fake_atecc(uint8_t addr);
+
+// how long <opcode> executes (usec).
+void fake_atecc_exec_usec_set(fake_i2c_slave_t *s, uint8_t opcode, unsigned usec);
+
+// the next <opcode> fails with chip status <status> (e.g. 0x0f).
+void fake_atecc_fail_next(fake_i2c_slave_t *s, uint8_t opcode, uint8_t status);
+
+// the next <n> responses read out arrive with their last CRC byte
+// garbled (the chip's copy stays good, so a re-read fixes it).
+void fake_atecc_corrupt_next(fake_i2c_slave_t *s, unsigned n);
+
+// what SIGN returns for <digest> on the chip at <addr>: a
+// deterministic mix of both, so tests can check which chip signed
+// what.
+void fake_atecc_sig(uint8_t addr, const uint8_t digest[32], uint8_t sig[64]);
+
+// what ECDH with key <slot> on the chip at <addr> returns for
+// <point>: a hash of all three, so a different chip or slot derives a
+// different secret.
+void fake_atecc_ecdh(uint8_t addr, uint16_t slot, const uint8_t point[64], uint8_t secret[32]);
+
+typedef struct {
+    unsigned nwakes,
+             ncmds,         // commands executed (good CRC).
+             ncrc_errs,
+             nbusy_nacks,   // addressed while executing.
+             nwatchdogs,    // put to sleep by the watchdog.
+             nresp_reads,   // reads starting at a response's count byte.
+             ncorrupted,    // responses garbled by fake_atecc_corrupt_next.
+             nsha_blocks;   // SHA updates.
+} fake_atecc_stats_t;
+
+fake_atecc_stats_t fake_atecc_stats(fake_i2c_slave_t *s);
+
+#endif
@@ -0,0 +1,420 @@
+// simulated BSC1: see <fake-bsc.h>.
+#include "rpi.h"
+#include "i2c.h"
+#include "fake-bsc.h"
+
+enum { FIFO_N = 16, MAX_SLAVES = 8 };
+#define NEVER   (~0ULL)
+
+// where the transfer is.
+enum { BUS_IDLE, BUS_ADDR, BUS_DATA, BUS_STOP };
+
+static struct {
+    uint32_t c, dlen, a, div, del, clkt;
+    // DONE/ERR/CLKT: set by the model, cleared by writing 1.
+    uint32_t sticky;
+
+    uint8_t fifo[FIFO_N];
+    unsigned fhead, fn;
+
+    int state, read_p;
+    // ST was written while a transfer was running: start the next
+    // one with a repeated START instead of a STOP.
+    int restart;
+    unsigned remaining;
+    // a byte is being shifted (write) or waiting for FIFO space (read).
+    int byte_busy;
+    uint8_t shift;
+    // when the current bus phase finishes.
+    uint64_t next_ns;
+    uint64_t start_ns;
+
+    fake_i2c_slave_t *slave;
+} bsc = { .div = 0x5dc, .del = 0x00300030, .clkt = 0x40 };
+
+// core clock the divider divides.
+static unsigned core_hz = 250 * 1000 * 1000;
+
+static fake_i2c_slave_t *slaves[MAX_SLAVES];
+static unsigned nslaves;
+static fake_bsc_stats_t stats;
+// a slave holds SDA low until it has seen this many more clocks
+// (see fake_bsc_stick_sda()).
+static unsigned sda_stuck_clocks;
+
+void fake_bsc_attach(fake_i2c_slave_t *s) {
+    assert(nslaves < MAX_SLAVES);
+    slaves[nslaves++] = s;
+}
+
+fake_bsc_stats_t fake_bsc_stats(void) { return stats; }
+void fake_bsc_stats_reset(void) { memset(&stats, 0, sizeof stats); }
+
+void fake_bsc_core_hz_set(unsigned hz) { core_hz = hz; }
+unsigned fake_bsc_core_hz(void) { return core_hz; }
+
+static fake_i2c_slave_t *slave_lookup(unsigned addr) {
+    for(unsigned i = 0; i < nslaves; i++)
+        if(slaves[i]->addr == addr)
+            return slaves[i];
+    return 0;
+}
+
+// DIV=0 means 32768 (p34).
+static uint64_t bus_div(void) {
+    uint64_t div = bsc.div & 0xfffe;
+    return div ? div : 32768;
+}
+// one scl period in ns.
+static uint64_t bit_ns(void) {
+    return (bus_div() * 1000000000ULL) / core_hz;
+}
+static unsigned bus_hz(void) {
+    return core_hz / bus_div();
+}
+
+/***********************************************************
+ * fifo.
+ */
+static void fifo_push(uint8_t b) {
+    if(bsc.fn == FIFO_N)
+        return;
+    bsc.fifo[(bsc.fhead + bsc.fn++) % FIFO_N] = b;
+}
+static uint8_t fifo_pop(void) {
+    if(!bsc.fn)
+        return 0;
+    uint8_t b = bsc.fifo[bsc.fhead];
+    bsc.fhead = (bsc.fhead + 1) % FIFO_N;
+    bsc.fn--;
+    return b;
+}
+static void fifo_clear(void) { bsc.fhead = bsc.fn = 0; }
+
+/***********************************************************
+ * bus state machine.
+ */
+static void bus_stop(uint64_t t) {
+    bsc.state = BUS_STOP;
+    bsc.byte_busy = 0;
+    bsc.restart = 0;
+    bsc.next_ns = t + bit_ns();
+}
+
+static void bus_restart(uint64_t t);
+
+// start shifting the next byte at time <t> if we can.
+static void byte_next(uint64_t t) {
+    if(!bsc.remaining) {
+        if(bsc.restart)
+            bus_restart(t);
+        else
+            bus_stop(t);
+        return;
+    }
+    if(bsc.read_p) {
+        bsc.byte_busy = 1;
+        bsc.next_ns = t + 9 * bit_ns();
+    } else if(bsc.fn) {
+        bsc.shift = fifo_pop();
+        bsc.byte_busy = 1;
+        bsc.next_ns = t + 9 * bit_ns();
+    } else {
+        // FIFO ran dry: controller waits for more data.
+        bsc.byte_busy = 0;
+        bsc.next_ns = NEVER;
+    }
+}
+
+static void bus_start(uint64_t t) {
+    bsc.read_p = bsc.c & I2C_C_READ;
+    bsc.remaining = bsc.dlen;
+    bsc.slave = slave_lookup(bsc.a & 0x7f);
+    bsc.state = BUS_ADDR;
+    bsc.byte_busy = 0;
+    bsc.restart = 0;
+    bsc.start_ns = t;
+    // start bit + 7 address bits + r/w + ack.
+    bsc.next_ns = t + 10 * bit_ns();
+    stats.ntransfers++;
+}
+
+// repeated START: the controller latches A/DLEN/READ again but the
+// bus stays ours, so no STOP, no DONE and no slave stop().
+static void bus_restart(uint64_t t) {
+    uint64_t start_ns = bsc.start_ns;
+    bus_start(t);
+    bsc.start_ns = start_ns;
+    stats.nrestarts++;
+}
+
+// finish the phase that ends at <bsc.next_ns>.
+static void bus_step(void) {
+    uint64_t t = bsc.next_ns;
+    fake_i2c_slave_t *s = bsc.slave;
+
+    switch(bsc.state) {
+    case BUS_ADDR:
+        // too fast for the device: it misses its address.  with SDA
+        // held low there is no START at all.
+        if(!s || sda_stuck_clocks || (s->max_hz && bus_hz() > s->max_hz)
+        || (s->start && !s->start(s, bsc.read_p))) {
+            stats.nacks++;
+            bsc.sticky |= I2C_S_ERR;
+            bus_stop(t);
+        } else if(s->stretch_ns) {
+            // CLKT counts bus clocks; 0 disables the check.
+            uint64_t limit = bsc.clkt * bit_ns();
+            bsc.state = BUS_DATA;
+            if(bsc.clkt && s->stretch_ns > limit) {
+                bsc.sticky |= I2C_S_CLKT;
+                bus_stop(t + limit);
+            } else if(s->stretch_ns == FAKE_STRETCH_FOREVER) {
+                bsc.next_ns = NEVER;
+                bsc.byte_busy = 1;
+            } else
+                byte_next(t + s->stretch_ns);
+        } else {
+            bsc.state = BUS_DATA;
+            byte_next(t);
+        }
+        break;
+    case BUS_DATA:
+        if(bsc.read_p) {
+            // no room: hold the clock until the FIFO is read.
+            if(bsc.fn == FIFO_N) {
+                bsc.next_ns = NEVER;
+                return;
+            }
+            fifo_push(s->read ? s->read(s) : 0xff);
+        } else if(s->write && !s->write(s, bsc.shift)) {
+            stats.nacks++;
+            bsc.sticky |= I2C_S_ERR;
+            bsc.remaining--;
+            stats.nbytes++;
+            bus_stop(t);
+            return;
+        }
+        bsc.remaining--;
+        stats.nbytes++;
+        byte_next(t);
+        break;
+    case BUS_STOP:
+        bsc.state = BUS_IDLE;
+        bsc.next_ns = NEVER;
+        bsc.sticky |= I2C_S_DONE;
+        stats.busy_ns += t - bsc.start_ns;
+        if(s && s->stop)
+            s->stop(s);
+        break;
+    default:
+        panic("bad bus state %d\n", bsc.state);
+    }
+}
+
+void fake_bsc_advance(uint64_t now_ns) {
+    while(bsc.state != BUS_IDLE && bsc.next_ns <= now_ns)
+        bus_step();
+}
+
+/***********************************************************
+ * registers.
+ */
+static uint32_t status(void) {
+    int active = bsc.state != BUS_IDLE;
+    uint32_t s = bsc.sticky;
+
+    if(active)
+        s |= I2C_S_TA;
+    if(bsc.fn < FIFO_N)
+        s |= I2C_S_TXD;
+    if(bsc.fn)
+        s |= I2C_S_RXD;
+    if(!bsc.fn)
+        s |= I2C_S_TXE;
+    if(bsc.fn == FIFO_N)
+        s |= I2C_S_RXF;
+    if(active && !bsc.read_p && bsc.fn < FIFO_N)
+        s |= I2C_S_TXW;
+    // "needs reading": 3/4 full.
+    if(active && bsc.read_p && bsc.fn >= (FIFO_N*3)/4)
+        s |= I2C_S_RXR;
+    return s;
+}
+
+int fake_bsc_irq(void) {
+    uint32_t s = status();
+    return ((bsc.c & I2C_C_INTD) && (s & I2C_S_DONE))
+        || ((bsc.c & I2C_C_INTT) && (s & I2C_S_TXW))
+        || ((bsc.c & I2C_C_INTR) && (s & I2C_S_RXR));
+}
+
+int fake_bsc_is_addr(uint32_t addr) {
+    return addr >= I2C_C && addr <= I2C_CLKT;
+}
+
+uint32_t fake_bsc_get32(uint32_t addr) {
+    switch(addr) {
+    case I2C_C:     return bsc.c;
+    case I2C_S:
+        stats.nstatus_reads++;
+        return status();
+    // reads back the bytes left while a transfer is running.
+    case I2C_DLEN:  return bsc.state != BUS_IDLE ? bsc.remaining : bsc.dlen;
+    case I2C_A:     return bsc.a;
+    case I2C_FIFO: {
+        stats.nfifo_reads++;
+        uint8_t b = fifo_pop();
+        // a stalled read can finish its byte now.
+        if(bsc.state == BUS_DATA && bsc.read_p && bsc.next_ns == NEVER)
+            bsc.next_ns = fake_time_ns();
+        return b;
+    }
+    case I2C_DIV:   return bsc.div;
+    case I2C_DEL:   return bsc.del;
+    case I2C_CLKT:  return bsc.clkt;
+    default: panic("bad BSC register %x\n", addr);
+    }
+}
+
+void fake_bsc_put32(uint32_t addr, uint32_t v) {
+    uint64_t now = fake_time_ns();
+
+    switch(addr) {
+    case I2C_C:
+        // CLEAR is bits 5:4, one-shot.
+        if(v & (3 << 4))
+            fifo_clear();
+        bsc.c = v & ~(I2C_C_ST | (3 << 4));
+        // disabling the controller drops whatever was on the bus.
+        if(!(v & I2C_C_I2CEN) && bsc.state != BUS_IDLE) {
+            stats.busy_ns += now - bsc.start_ns;
+            bsc.state = BUS_IDLE;
+            bsc.next_ns = NEVER;
+            bsc.restart = 0;
+            stats.naborts++;
+        }
+        if((v & I2C_C_ST) && (v & I2C_C_I2CEN)) {
+            if(bsc.state == BUS_IDLE)
+                bus_start(now);
+            else if(bsc.state != BUS_STOP)
+                bsc.restart = 1;
+        }
+        break;
+    case I2C_S:
+        bsc.sticky &= ~(v & (I2C_S_DONE | I2C_S_ERR | I2C_S_CLKT));
+        break;
+    case I2C_DLEN:  bsc.dlen = v & 0xffff; break;
+    case I2C_A:     bsc.a = v & 0x7f; break;
+    case I2C_FIFO:
+        stats.nfifo_writes++;
+        fifo_push(v);
+        // a write that was waiting on data can go.
+        if(bsc.state == BUS_DATA && !bsc.read_p && !bsc.byte_busy)
+            byte_next(now);
+        break;
+    case I2C_DIV:   bsc.div = v & 0xffff; break;
+    case I2C_DEL:   bsc.del = v; break;
+    case I2C_CLKT:  bsc.clkt = v & 0xffff; break;
+    default: panic("bad BSC register %x\n", addr);
+    }
+}
+
+/***********************************************************
+ * the SDA/SCL wires, as gpio sees them.
+ */
+
+// ATECC608A tWLO.
+#define WAKE_LOW_NS (60 * 1000)
+
+// pulled low by the pins in gpio mode.
+static int sda_gpio_low, scl_gpio_low;
+static uint64_t sda_low_ns = NEVER;
+void fake_bsc_stick_sda(unsigned nclocks) { sda_stuck_clocks = nclocks; }
+
+int fake_bsc_is_pin(unsigned pin) {
+    return pin == I2C_SDA || pin == I2C_SCL;
+}
+
+int fake_bsc_line(unsigned pin) {
+    if(pin == I2C_SDA)
+        return !(sda_gpio_low || sda_stuck_clocks);
+    return !scl_gpio_low;
+}
+
+void fake_bsc_gpio_drive(unsigned pin, int low) {
+    if(pin == I2C_SCL) {
+        // a rising edge clocks the stuck slave along.
+        if(scl_gpio_low && !low && sda_stuck_clocks)
+            sda_stuck_clocks--;
+        scl_gpio_low = low;
+        return;
+    }
+    if(pin != I2C_SDA)
+        return;
+
+    sda_gpio_low = low;
+    if(low) {
+        if(sda_low_ns == NEVER)
+            sda_low_ns = fake_time_ns();
+        return;
+    }
+    if(sda_low_ns != NEVER && fake_time_ns() - sda_low_ns >= WAKE_LOW_NS)
+        for(unsigned i = 0; i < nslaves; i++)
+            if(slaves[i]->wake)
+                slaves[i]->wake(slaves[i]);
+    sda_low_ns = NEVER;
+}
+
+/***********************************************************
+ * memory slave.
+ */
+typedef struct {
+    uint8_t *buf;
+    unsigned n, ptr;
+    int first;
+} mem_t;
+
+static int mem_start(fake_i2c_slave_t *s, int read_p) {
+    mem_t *m = s->data;
+    m->first = !read_p;
+    return 1;
+}
+static int mem_write(fake_i2c_slave_t *s, uint8_t b) {
+    mem_t *m = s->data;
+    if(m->first) {
+        m->ptr = b % m->n;
+        m->first = 0;
+    } else {
+        m->buf[m->ptr] = b;
+        m->ptr = (m->ptr + 1) % m->n;
+    }
+    return 1;
+}
+static uint8_t mem_read(fake_i2c_slave_t *s) {
+    mem_t *m = s->data;
+    uint8_t b = m->buf[m->ptr];
+    m->ptr = (m->ptr + 1) % m->n;
+    return b;
+}
+
+fake_i2c_slave_t *fake_i2c_mem_slave(uint8_t addr, unsigned nbytes) {
+    mem_t *m = calloc(1, sizeof *m);
+    m->buf = calloc(1, nbytes);
+    m->n = nbytes;
+
+    fake_i2c_slave_t *s = calloc(1, sizeof *s);
+    *s = (fake_i2c_slave_t) {
+        .name = "mem",
+        .addr = addr,
+        .start = mem_start,
+        .write = mem_write,
+        .read = mem_read,
+        .data = m
+    };
+    return s;
+}
+
+uint8_t *fake_i2c_mem_slave_buf(fake_i2c_slave_t *s) {
+    return ((mem_t *)s->data)->buf;
+}
@@ -0,0 +1,96 @@
+#ifndef __FAKE_BSC_H__
+#define __FAKE_BSC_H__
+// simulated BSC1 i2c master (bcm2835 p28) and the slave devices
+// on its bus.
+//
+// the model keeps the 16-byte FIFO and the DONE/TA/RXD/TXD/TXW/RXR/ERR
+// status bits, and moves one byte every 9 scl periods, where the
+// scl period is <I2C_DIV> core-clock cycles.  writing ST while a
+// transfer is active queues a repeated START for when it ends.
+
+// a slave device.  callbacks run at the bus time the event
+// happens.
+typedef struct fake_i2c_slave {
+    const char *name;
+    uint8_t addr;
+    // fastest bus the device keeps up with (0 = any): faster
+    // than this and it NACKs its address.
+    unsigned max_hz;
+    // holds SCL low this long after ACKing its address (clock
+    // stretching).  past I2C_CLKT bit periods the BSC flags CLKT;
+    // with CLKT=0 and FAKE_STRETCH_FOREVER the bus hangs.
+    uint64_t stretch_ns;
+
+    // master addressed us: return 0 to NACK.
+    int (*start)(struct fake_i2c_slave *s, int read_p);
+    // master wrote <b>: return 0 to NACK.
+    int (*write)(struct fake_i2c_slave *s, uint8_t b);
+    // master clocks in a byte.
+    uint8_t (*read)(struct fake_i2c_slave *s);
+    // stop condition.  can be 0.
+    void (*stop)(struct fake_i2c_slave *s);
+    // SDA was held low long enough to wake a sleeping device
+    // (see fake_bsc_gpio_write()).  can be 0.
+    void (*wake)(struct fake_i2c_slave *s);
+
+    void *data;
+} fake_i2c_slave_t;
+
+#define FAKE_STRETCH_FOREVER (~0ULL)
+
+// put <s> on the bus.
+void fake_bsc_attach(fake_i2c_slave_t *s);
+
+// plain memory device: the first byte of a write sets the
+// address pointer, the rest are stored.  reads return from the
+// pointer on.
+fake_i2c_slave_t *fake_i2c_mem_slave(uint8_t addr, unsigned nbytes);
+uint8_t *fake_i2c_mem_slave_buf(fake_i2c_slave_t *s);
+
+typedef struct {
+    unsigned ntransfers,        // START conditions (incl. repeated).
+             nrestarts,         // repeated STARTs.
+             nbytes,            // data bytes moved (excluding address).
+             nacks,
+             naborts;           // transfers dropped by clearing I2CEN.
+    uint64_t busy_ns;           // time the bus was not idle.
+
+    // what the driver did: how often it polled the status
+    // register and touched the FIFO.
+    unsigned nstatus_reads,
+             nfifo_reads,
+             nfifo_writes;
+} fake_bsc_stats_t;
+
+fake_bsc_stats_t fake_bsc_stats(void);
+void fake_bsc_stats_reset(void);
+
+// a slave holds SDA low, as if the master vanished mid-byte: every
+// BSC transfer fails until SDA has been clocked <nclocks> times by
+// hand (gpio), as bus recovery does.
+void fake_bsc_stick_sda(unsigned nclocks);
+
+// core clock the BSC divides (default 250MHz): what the mailbox
+// reports.
+void fake_bsc_core_hz_set(unsigned hz);
+unsigned fake_bsc_core_hz(void);
+
+/***********************************************************
+ * used by <fake-pi.c>
+ */
+int fake_bsc_is_addr(uint32_t addr);
+uint32_t fake_bsc_get32(uint32_t addr);
+void fake_bsc_put32(uint32_t addr, uint32_t v);
+// run the bus up to <now_ns>.
+void fake_bsc_advance(uint64_t now_ns);
+// 1 if the BSC interrupt line is asserted.
+int fake_bsc_irq(void);
+// SDA/SCL in gpio mode: <low> if the pin pulls its line low.  SDA
+// held low for the wake time (60us) wakes every device on the bus;
+// SCL edges clock a stuck slave.
+int fake_bsc_is_pin(unsigned pin);
+void fake_bsc_gpio_drive(unsigned pin, int low);
+// level of the line on <pin>.
+int fake_bsc_line(unsigned pin);
+
+#endif
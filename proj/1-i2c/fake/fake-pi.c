@@ -0,0 +1,309 @@
+// unix implementation of the libpi routines the drivers use.
+//
+// time only moves when the program touches a device or delays,
+// so a busy-wait loop costs exactly (iterations * mmio cost) and
+// a <delay_us> is free cpu time for interrupts to run in.
+#include <stdarg.h>
+#include "rpi.h"
+#include "rpi-interrupts.h"
+#include "rpi-inline-asm.h"
+#include "cycle-count.h"
+#include "mbox.h"
+#include "fake-bsc.h"
+#include "fake-sw-i2c.h"
+
+static uint64_t now_ns;
+static uint64_t irq_ns;
+static unsigned mmio_ns = 50;
+static unsigned nput32, nget32;
+
+// pi boots with interrupts off.
+static int irq_off = 1;
+static int in_irq;
+static uint32_t irq_enable_1, irq_enable_2, irq_enable_basic;
+
+// the program overrides this: same as the staff default handler.
+void WEAK(interrupt_vector)(unsigned pc) {
+    panic("unhandled interrupt: pc=%x\n", pc);
+}
+
+static uint32_t irq_pending_2(void) {
+    return fake_bsc_irq() ? (1 << (53 - 32)) : 0;
+}
+
+// level-triggered: keep taking the interrupt until the handler
+// clears the source.
+static void irq_check(void) {
+    if(irq_off || in_irq)
+        return;
+    for(unsigned n = 0; irq_pending_2() & irq_enable_2; n++) {
+        if(n > 10000)
+            panic("interrupt storm: handler is not clearing the source\n");
+        in_irq = 1;
+        uint64_t s = now_ns;
+        interrupt_vector(0);
+        irq_ns += now_ns - s;
+        in_irq = 0;
+    }
+}
+
+static void time_inc(uint64_t ns) {
+    now_ns += ns;
+    fake_bsc_advance(now_ns);
+}
+
+uint64_t fake_time_ns(void) { return now_ns; }
+uint64_t fake_irq_ns(void) { return irq_ns; }
+void fake_mmio_ns_set(unsigned ns) { mmio_ns = ns; }
+unsigned fake_nput32(void) { return nput32; }
+unsigned fake_nget32(void) { return nget32; }
+
+void fake_time_inc_ns(uint64_t ns) {
+    time_inc(ns);
+    irq_check();
+}
+
+/***********************************************************
+ * device access.
+ */
+
+void PUT32(unsigned addr, unsigned v) {
+    nput32++;
+    time_inc(mmio_ns);
+
+    if(fake_bsc_is_addr(addr))
+        fake_bsc_put32(addr, v);
+    else switch(addr) {
+    case IRQ_Enable_1:      irq_enable_1 |= v; break;
+    case IRQ_Enable_2:      irq_enable_2 |= v; break;
+    case IRQ_Enable_Basic:  irq_enable_basic |= v; break;
+    case IRQ_Disable_1:     irq_enable_1 &= ~v; break;
+    case IRQ_Disable_2:     irq_enable_2 &= ~v; break;
+    case IRQ_Disable_Basic: irq_enable_basic &= ~v; break;
+    default: panic("PUT32 to unmodelled address %x\n", addr);
+    }
+    irq_check();
+}
+
+unsigned GET32(unsigned addr) {
+    nget32++;
+    time_inc(mmio_ns);
+
+    uint32_t v;
+    if(fake_bsc_is_addr(addr))
+        v = fake_bsc_get32(addr);
+    else switch(addr) {
+    case IRQ_pending_2:     v = irq_pending_2(); break;
+    case IRQ_Enable_1:      v = irq_enable_1; break;
+    case IRQ_Enable_2:      v = irq_enable_2; break;
+    case IRQ_Enable_Basic:  v = irq_enable_basic; break;
+    default: panic("GET32 from unmodelled address %x\n", addr);
+    }
+    irq_check();
+    return v;
+}
+
+void put32(volatile void *addr, unsigned v) { PUT32((uintptr_t)addr, v); }
+unsigned get32(const volatile void *addr) { return GET32((uintptr_t)addr); }
+
+uint32_t DEV_VAL32(uint32_t x) { return x; }
+
+void dev_barrier(void) {}
+void dmb(void) {}
+void dsb(void) {}
+
+/***********************************************************
+ * interrupts: we only track the cpsr I bit.
+ */
+uint32_t cpsr_get(void) { return irq_off << 7; }
+void cpsr_set(uint32_t cpsr) {
+    irq_off = (cpsr >> 7) & 1;
+    irq_check();
+}
+int cpsr_int_enabled(void) { return !irq_off; }
+uint32_t cpsr_int_enable(void) {
+    uint32_t cpsr = cpsr_get();
+    cpsr_set(cpsr & ~(1<<7));
+    return cpsr;
+}
+uint32_t cpsr_int_disable(void) {
+    uint32_t cpsr = cpsr_get();
+    cpsr_set(cpsr | (1<<7));
+    return cpsr;
+}
+uint32_t cpsr_int_reset(uint32_t cpsr) {
+    if(cpsr & (1<<7))
+        return cpsr_int_disable();
+    else
+        return cpsr_int_enable();
+}
+void enable_interrupts(void) { cpsr_int_enable(); }
+void disable_interrupts(void) { cpsr_int_disable(); }
+
+/***********************************************************
+ * time.
+ */
+
+// 700MHz arm1176.  a read costs about what a tight polling loop
+// iteration does, so cycle-timed spins make progress.
+void cycle_cnt_init(void) {}
+unsigned cycle_cnt_read(void) {
+    fake_time_inc_ns(10);
+    return (now_ns * 7) / 10;
+}
+
+uint32_t timer_get_usec_raw(void) {
+    fake_time_inc_ns(mmio_ns);
+    return now_ns / 1000;
+}
+uint32_t timer_get_usec(void) {
+    return timer_get_usec_raw();
+}
+
+// step a microsecond at a time so interrupts are delivered
+// close to when they would fire.
+void delay_us(uint32_t us) {
+    for(uint32_t i = 0; i < us; i++)
+        fake_time_inc_ns(1000);
+}
+void delay_ms(uint32_t ms) { delay_us(ms * 1000); }
+void delay_cycles(uint32_t ticks) { fake_time_inc_ns((ticks * 10ULL) / 7); }
+
+// what a spin-loop iteration costs.
+void WEAK(rpi_wait)(void) { fake_time_inc_ns(mmio_ns); }
+
+/***********************************************************
+ * gpio: just remember what was set, except for the BSC pins
+ * and pins on a simulated open-drain bus (<fake-sw-i2c.c>),
+ * which the models see change and read back from the wire.  each call costs
+ * one device access.
+ */
+enum { NPINS = 54 };
+static gpio_func_t pin_func[NPINS];
+static uint8_t pin_val[NPINS], pin_pull[NPINS];
+
+static void pin_changed(unsigned pin) {
+    int out = pin_func[pin] == GPIO_FUNC_OUTPUT;
+    if(fake_bsc_is_pin(pin))
+        fake_bsc_gpio_drive(pin, out && !pin_val[pin]);
+    else if(fake_sw_i2c_is_pin(pin))
+        fake_sw_i2c_drive(pin, out, out && !pin_val[pin]);
+}
+
+void gpio_set_function(unsigned pin, gpio_func_t function) {
+    assert(pin < NPINS);
+    fake_time_inc_ns(mmio_ns);
+    pin_func[pin] = function;
+    pin_changed(pin);
+}
+void gpio_set_input(unsigned pin) { gpio_set_function(pin, GPIO_FUNC_INPUT); }
+void gpio_set_output(unsigned pin) { gpio_set_function(pin, GPIO_FUNC_OUTPUT); }
+void gpio_write(unsigned pin, unsigned val) {
+    assert(pin < NPINS);
+    fake_time_inc_ns(mmio_ns);
+    pin_val[pin] = val != 0;
+    pin_changed(pin);
+}
+void gpio_set_on(unsigned pin) { gpio_write(pin, 1); }
+void gpio_set_off(unsigned pin) { gpio_write(pin, 0); }
+int gpio_read(unsigned pin) {
+    assert(pin < NPINS);
+    fake_time_inc_ns(mmio_ns);
+    if(fake_bsc_is_pin(pin))
+        return fake_bsc_line(pin);
+    if(fake_sw_i2c_is_pin(pin))
+        return fake_sw_i2c_level(pin);
+    if(pin_func[pin] == GPIO_FUNC_OUTPUT)
+        return pin_val[pin];
+    // nothing is driving it: the pullup wins.
+    return pin_pull[pin] == 1;
+}
+void gpio_set_pullup(unsigned pin) { assert(pin < NPINS); pin_pull[pin] = 1; }
+void gpio_set_pulldown(unsigned pin) { assert(pin < NPINS); pin_pull[pin] = 2; }
+void gpio_pud_off(unsigned pin) { assert(pin < NPINS); pin_pull[pin] = 0; }
+
+/***********************************************************
+ * mailbox: only the core clock.
+ */
+uint32_t mbox_get_clock_rate(uint32_t clock_id) {
+    if(clock_id == MBOX_CLK_CORE)
+        return fake_bsc_core_hz();
+    panic("mailbox clock %d not modelled\n", clock_id);
+}
+
+/***********************************************************
+ * output, memory and reboot.
+ */
+// printk on the pi spins until the UART has taken every character.
+static unsigned uart_char_ns;
+static uint64_t uart_ns;
+static unsigned nprintk;
+
+void fake_uart_baud_set(unsigned baud) {
+    // 8N1: ten bits on the wire a character.
+    uart_char_ns = baud ? 10ULL * 1000 * 1000 * 1000 / baud : 0;
+}
+uint64_t fake_uart_ns(void) { return uart_ns; }
+unsigned fake_nprintk(void) { return nprintk; }
+
+static void uart_charge(int n) {
+    nprintk++;
+    if(n > 0 && uart_char_ns) {
+        uart_ns += (uint64_t)n * uart_char_ns;
+        fake_time_inc_ns((uint64_t)n * uart_char_ns);
+    }
+}
+
+int printk(const char *fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vprintf(fmt, ap);
+    va_end(ap);
+    uart_charge(n);
+    return n;
+}
+int putk(const char *msg) {
+    uart_charge(strlen(msg));
+    return fputs(msg, stdout);
+}
+
+void uart_init(void) {}
+int uart_put8(uint8_t c) { return putchar(c); }
+void uart_flush_tx(void) { fflush(stdout); }
+
+// libc underneath, but like the pi's there is no heap until
+// kmalloc_init: kmalloc panics and kmalloc_heap_ptr is 0.
+static void *heap_start;
+
+static void kmalloc_check(void) {
+    if(!heap_start)
+        panic("did not initialize kmalloc\n");
+}
+void *kmalloc(unsigned nbytes) { kmalloc_check(); return calloc(1, nbytes); }
+void *kmalloc_notzero(unsigned nbytes) { kmalloc_check(); return malloc(nbytes); }
+void *kmalloc_aligned(unsigned nbytes, unsigned alignment) {
+    void *p;
+    kmalloc_check();
+    if(posix_memalign(&p, alignment < sizeof(void*) ? sizeof(void*) : alignment, nbytes))
+        panic("out of memory\n");
+    memset(p, 0, nbytes);
+    return p;
+}
+void kmalloc_init_set_start(void *addr, unsigned max_nbytes) { heap_start = addr; }
+void *kmalloc_heap_ptr(void) { return heap_start; }
+
+void rpi_reboot(void) {
+    fflush(stdout);
+    exit(0);
+}
+void clean_reboot(void) {
+    putk("DONE!!!\n");
+    rpi_reboot();
+}
+
+int main(void) {
+    // so a hung program still shows how far it got.
+    setvbuf(stdout, 0, _IONBF, 0);
+    notmain();
+    clean_reboot();
+}
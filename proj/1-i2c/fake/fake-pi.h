@@ -0,0 +1,36 @@
+#ifndef __FAKE_PI_H__
+#define __FAKE_PI_H__
+// pulled in by <rpi.h> when compiled with -DRPI_UNIX.
+//
+// fake-pi lets us run the real pi drivers (i2c.c, i2c-async.c, ...)
+// as a unix process.  every PUT32/GET32 goes through <fake-pi.c>
+// which routes it to a device model (see <fake-bsc.c>).  time is
+// virtual: each device access and each delay advances a nanosecond
+// clock, so timings are deterministic and we can measure bus time
+// and cpu time without a pi attached.
+#include <stdio.h>
+
+// current virtual time.
+uint64_t fake_time_ns(void);
+// advance virtual time by <ns>: runs the device models and
+// delivers any pending interrupt.
+void fake_time_inc_ns(uint64_t ns);
+
+// virtual cost of a single PUT32/GET32 (default 50ns).
+void fake_mmio_ns_set(unsigned ns);
+
+// total virtual time spent inside <interrupt_vector>.
+uint64_t fake_irq_ns(void);
+
+// number of PUT32 / GET32 calls so far.
+unsigned fake_nput32(void);
+unsigned fake_nget32(void);
+
+// make printk/putk block like the pi's UART at <baud>; 0 (the
+// default) makes printing free.
+void fake_uart_baud_set(unsigned baud);
+// virtual time spent printing, and the number of printk/putk calls.
+uint64_t fake_uart_ns(void);
+unsigned fake_nprintk(void);
+
+#endif
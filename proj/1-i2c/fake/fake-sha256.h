@@ -0,0 +1,22 @@
+#ifndef __FAKE_SHA256_H__
+#define __FAKE_SHA256_H__
+// plain FIPS 180-4 SHA-256: what the fake ATECC's SHA engine runs,
+// and the reference the driver's digests are checked against.  one
+// block at a time, the way the chip takes them.
+#include <stdint.h>
+
+typedef struct {
+    uint32_t h[8];
+    uint64_t nbytes;    // hashed so far.
+} fake_sha256_t;
+
+void fake_sha256_init(fake_sha256_t *s);
+// one 64-byte block.
+void fake_sha256_block(fake_sha256_t *s, const uint8_t block[64]);
+// the last <n> (< 64) bytes, then the digest.
+void fake_sha256_end(fake_sha256_t *s, const uint8_t *tail, unsigned n, uint8_t digest[32]);
+
+// all at once.
+void fake_sha256(const void *msg, unsigned n, uint8_t digest[32]);
+
+#endif
@@ -0,0 +1,237 @@
+// open-drain i2c bus model: see <fake-sw-i2c.h>.
+#include "rpi.h"
+#include "fake-sw-i2c.h"
+
+enum { MAX_BUSES = 4, MAX_SLAVES = 8 };
+#define NEVER   (~0ULL)
+
+// what the slaves are doing.
+enum { SW_IDLE, SW_ADDR, SW_WRITE, SW_READ, SW_IGNORE };
+
+struct fake_sw_i2c {
+    unsigned scl, sda;
+    fake_i2c_slave_t *slaves[MAX_SLAVES];
+    unsigned nslaves;
+
+    // master: pulling low / driving high (push-pull).
+    int m_scl_low, m_sda_low, m_scl_high, m_sda_high;
+    // slave: pulling SDA low, holding SCL low until.
+    int s_sda_low;
+    uint64_t stretch_until;
+
+    // levels as of the last update, and when SCL last changed.
+    int scl_level, sda_level;
+    uint64_t scl_edge_ns;
+
+    int mode, nbits, ack_phase, acked, read_p, master_nack;
+    uint8_t shift, out;
+    fake_i2c_slave_t *s;
+
+    fake_sw_i2c_stats_t stats;
+};
+
+static fake_sw_i2c_t buses[MAX_BUSES];
+static unsigned nbuses;
+
+fake_sw_i2c_t *fake_sw_i2c_bus(unsigned scl, unsigned sda) {
+    assert(nbuses < MAX_BUSES);
+    assert(!fake_sw_i2c_is_pin(scl) && !fake_sw_i2c_is_pin(sda));
+    fake_sw_i2c_t *b = &buses[nbuses++];
+    *b = (fake_sw_i2c_t) {
+        .scl = scl,
+        .sda = sda,
+        .scl_level = 1,
+        .sda_level = 1,
+        .stats = { .min_high_ns = NEVER, .min_low_ns = NEVER },
+    };
+    return b;
+}
+
+void fake_sw_i2c_attach(fake_sw_i2c_t *b, fake_i2c_slave_t *s) {
+    assert(b->nslaves < MAX_SLAVES);
+    b->slaves[b->nslaves++] = s;
+}
+
+fake_sw_i2c_stats_t fake_sw_i2c_stats(fake_sw_i2c_t *b) { return b->stats; }
+
+static fake_i2c_slave_t *slave_lookup(fake_sw_i2c_t *b, unsigned addr) {
+    for(unsigned i = 0; i < b->nslaves; i++)
+        if(b->slaves[i]->addr == addr)
+            return b->slaves[i];
+    return 0;
+}
+
+static int scl_wire(fake_sw_i2c_t *b) {
+    int stretched = fake_time_ns() < b->stretch_until;
+    if(stretched && b->m_scl_high)
+        panic("SCL: master drives high while the slave stretches\n");
+    return !(b->m_scl_low || stretched);
+}
+static int sda_wire(fake_sw_i2c_t *b) {
+    if(b->s_sda_low && b->m_sda_high)
+        panic("SDA: master drives high while the slave pulls low\n");
+    return !(b->m_sda_low || b->s_sda_low);
+}
+
+// slave puts the next bit of <out> on SDA.
+static void drive_bit(fake_sw_i2c_t *b, unsigned bit) {
+    b->s_sda_low = !((b->out >> bit) & 1);
+}
+static void load_byte(fake_sw_i2c_t *b) {
+    b->out = b->s->read ? b->s->read(b->s) : 0xff;
+    drive_bit(b, 7);
+}
+
+// SCL went high: everyone samples SDA.
+static void scl_rise(fake_sw_i2c_t *b) {
+    switch(b->mode) {
+    case SW_ADDR:
+    case SW_WRITE:
+        if(b->nbits < 8)
+            b->shift = (b->shift << 1) | b->sda_level;
+        b->nbits++;
+        break;
+    case SW_READ:
+        // 9th clock: the master's ACK.
+        if(++b->nbits == 9)
+            b->master_nack = b->sda_level;
+        break;
+    }
+}
+
+// SCL went low: slaves change what they drive.
+static void scl_fall(fake_sw_i2c_t *b) {
+    fake_i2c_slave_t *s = b->s;
+
+    switch(b->mode) {
+    case SW_ADDR:
+    case SW_WRITE:
+        if(b->nbits == 8 && !b->ack_phase) {
+            b->ack_phase = 1;
+            if(b->mode == SW_ADDR) {
+                b->read_p = b->shift & 1;
+                s = b->s = slave_lookup(b, b->shift >> 1);
+                b->acked = s && (!s->start || s->start(s, b->read_p));
+            } else {
+                b->acked = !s->write || s->write(s, b->shift);
+                b->stats.nbytes++;
+            }
+            if(!b->acked)
+                b->stats.nacks++;
+            b->s_sda_low = b->acked;
+        } else if(b->nbits == 9) {
+            b->s_sda_low = 0;
+            b->ack_phase = 0;
+            b->nbits = 0;
+            b->shift = 0;
+            if(!b->acked)
+                b->mode = SW_IGNORE;
+            else if(b->mode == SW_ADDR) {
+                if(s->stretch_ns) {
+                    b->stats.nstretches++;
+                    b->stretch_until = s->stretch_ns == FAKE_STRETCH_FOREVER ?
+                        NEVER : fake_time_ns() + s->stretch_ns;
+                }
+                b->mode = b->read_p ? SW_READ : SW_WRITE;
+                if(b->read_p)
+                    load_byte(b);
+            }
+        }
+        break;
+    case SW_READ:
+        if(b->nbits >= 1 && b->nbits <= 7)
+            drive_bit(b, 7 - b->nbits);
+        else if(b->nbits == 8) {
+            // let the master ACK.
+            b->s_sda_low = 0;
+            b->stats.nbytes++;
+        } else if(b->nbits == 9) {
+            b->nbits = 0;
+            if(b->master_nack)
+                b->mode = SW_IGNORE;
+            else
+                load_byte(b);
+        }
+        break;
+    }
+}
+
+// SDA changed while SCL was high.
+static void start_cond(fake_sw_i2c_t *b) {
+    b->stats.nstarts++;
+    b->mode = SW_ADDR;
+    b->nbits = b->ack_phase = 0;
+    b->shift = 0;
+    b->s_sda_low = 0;
+}
+static void stop_cond(fake_sw_i2c_t *b) {
+    b->stats.nstops++;
+    if(b->mode != SW_IDLE && b->s && b->s->stop)
+        b->s->stop(b->s);
+    b->mode = SW_IDLE;
+    b->s = 0;
+    b->s_sda_low = 0;
+}
+
+// run the slaves over whatever changed since last time.
+static void update(fake_sw_i2c_t *b) {
+    uint64_t now = fake_time_ns();
+
+    int scl = scl_wire(b);
+    if(scl != b->scl_level) {
+        uint64_t dt = now - b->scl_edge_ns;
+        if(b->scl_level && dt < b->stats.min_high_ns)
+            b->stats.min_high_ns = dt;
+        if(!b->scl_level && dt < b->stats.min_low_ns)
+            b->stats.min_low_ns = dt;
+        b->scl_edge_ns = now;
+
+        b->scl_level = scl;
+        b->sda_level = sda_wire(b);
+        if(scl)
+            scl_rise(b);
+        else
+            scl_fall(b);
+    }
+
+    int sda = sda_wire(b);
+    if(sda != b->sda_level) {
+        b->sda_level = sda;
+        if(b->scl_level) {
+            if(sda)
+                stop_cond(b);
+            else
+                start_cond(b);
+        }
+    }
+}
+
+static fake_sw_i2c_t *pin_bus(unsigned pin) {
+    for(unsigned i = 0; i < nbuses; i++)
+        if(buses[i].scl == pin || buses[i].sda == pin)
+            return &buses[i];
+    return 0;
+}
+
+int fake_sw_i2c_is_pin(unsigned pin) { return pin_bus(pin) != 0; }
+
+void fake_sw_i2c_drive(unsigned pin, int driven, int low) {
+    fake_sw_i2c_t *b = pin_bus(pin);
+    assert(b);
+    if(pin == b->scl) {
+        b->m_scl_low = driven && low;
+        b->m_scl_high = driven && !low;
+    } else {
+        b->m_sda_low = driven && low;
+        b->m_sda_high = driven && !low;
+    }
+    update(b);
+}
+
+int fake_sw_i2c_level(unsigned pin) {
+    fake_sw_i2c_t *b = pin_bus(pin);
+    assert(b);
+    // a stretch may have ended since.
+    update(b);
+    return pin == b->scl ? b->scl_level : b->sda_level;
+}
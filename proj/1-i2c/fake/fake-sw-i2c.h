@@ -0,0 +1,48 @@
+#ifndef __FAKE_SW_I2C_H__
+#define __FAKE_SW_I2C_H__
+// open-drain i2c bus on two fake gpio pins, for testing a bit-banged
+// master (libpi/src/sw-i2c.c).
+//
+// each line is high unless someone pulls it low: the master (pin is
+// a gpio output driving 0) or a slave.  the slaves watch the lines
+// edge by edge: START/STOP, address and data bits on SCL rising,
+// ACK and read bits driven after SCL falls.  they are the same
+// <fake_i2c_slave_t> devices the BSC model uses, so a memory or
+// ATECC model can sit on either kind of bus.  <stretch_ns> holds
+// SCL low after the address ACK.
+//
+// the master driving a line high while a slave pulls it low is a
+// short on a real board: we panic.
+#include "fake-bsc.h"
+
+typedef struct fake_sw_i2c fake_sw_i2c_t;
+
+// a bus on <scl>,<sda>.
+fake_sw_i2c_t *fake_sw_i2c_bus(unsigned scl, unsigned sda);
+void fake_sw_i2c_attach(fake_sw_i2c_t *b, fake_i2c_slave_t *s);
+
+typedef struct {
+    unsigned nstarts,       // incl. repeated.
+             nstops,
+             nbytes,        // data bytes ACKed or read.
+             nacks,
+             nstretches;
+    // shortest SCL high and low time seen (ns).
+    uint64_t min_high_ns, min_low_ns;
+} fake_sw_i2c_stats_t;
+
+fake_sw_i2c_stats_t fake_sw_i2c_stats(fake_sw_i2c_t *b);
+
+/***********************************************************
+ * used by <fake-pi.c>
+ */
+
+// 1 if <pin> belongs to a bus.
+int fake_sw_i2c_is_pin(unsigned pin);
+// master now drives <pin> low (<low>=1), high (push-pull, <low>=0,
+// <driven>=1) or not at all (<driven>=0).
+void fake_sw_i2c_drive(unsigned pin, int driven, int low);
+// level on the wire.
+int fake_sw_i2c_level(unsigned pin);
+
+#endif
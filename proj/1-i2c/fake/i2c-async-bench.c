@@ -0,0 +1,164 @@
+// compare the polled driver against the interrupt-driven engine on
+// the simulated BSC: same transfers, how much of the cpu is left?
+// then failed transfers: the one queued behind a NACK still goes
+// through, and a done callback can queue the next transfer.
+#include "rpi.h"
+#include "rpi-interrupts.h"
+#include "rpi-inline-asm.h"
+#include "i2c-async.h"
+#include "fake-bsc.h"
+
+enum { SLAVE_ADDR = 0x50, NTXN = 64, NBYTES = 32 };
+
+static uint8_t wbuf[NTXN][NBYTES + 1], rbuf[NTXN][NBYTES];
+static i2c_txn_t txns[NTXN];
+
+void interrupt_vector(unsigned pc) {
+    if(i2c_async_has_interrupt())
+        i2c_async_int_handler();
+}
+
+static void fill(uint8_t *b, unsigned i) {
+    // first byte sets the memory pointer.
+    b[0] = 0;
+    for(unsigned j = 0; j < NBYTES; j++)
+        b[j+1] = i * 7 + j;
+}
+
+static void polled(void) {
+    uint64_t s = fake_time_ns();
+    for(unsigned i = 0; i < NTXN; i++) {
+        fill(wbuf[i], i);
+        if(i2c_write(SLAVE_ADDR, wbuf[i], NBYTES + 1) != NBYTES + 1)
+            panic("polled write %d failed\n", i);
+    }
+    uint64_t t = fake_time_ns() - s;
+    printk("polled: %d x %d byte writes: %d usec, cpu idle = 0%%\n",
+        NTXN, NBYTES, (unsigned)(t / 1000));
+}
+
+// submit everything, doing "useful work" (1us at a time) whenever
+// the queue is full and until the last transaction finishes.
+static void async(void) {
+    i2c_async_init();
+    enable_interrupts();
+
+    uint64_t s = fake_time_ns();
+    unsigned work_us = 0;
+    for(unsigned i = 0; i < NTXN; i++) {
+        fill(wbuf[i], i + 1);
+        i2c_txn_t *t = &txns[i];
+        *t = (i2c_txn_t) { .addr = SLAVE_ADDR, .data = wbuf[i], .nbytes = NBYTES + 1 };
+        while(!i2c_async_submit(t)) {
+            delay_us(1);
+            work_us++;
+        }
+    }
+    while(i2c_async_busy()) {
+        delay_us(1);
+        work_us++;
+    }
+    uint64_t t = fake_time_ns() - s;
+
+    for(unsigned i = 0; i < NTXN; i++)
+        if(txns[i].status != NBYTES + 1)
+            panic("txn %d: status=%d\n", i, txns[i].status);
+
+    // read the last one back.
+    uint8_t ptr = 0;
+    i2c_txn_t w = { .addr = SLAVE_ADDR, .data = &ptr, .nbytes = 1 };
+    i2c_txn_t r = { .addr = SLAVE_ADDR, .read_p = 1, .data = rbuf[0], .nbytes = NBYTES };
+    i2c_async_submit(&w);
+    i2c_async_submit(&r);
+    if(i2c_async_wait(&r) != NBYTES)
+        panic("read back failed: %d\n", r.status);
+    if(memcmp(rbuf[0], &wbuf[NTXN-1][1], NBYTES) != 0)
+        panic("read back mismatch\n");
+
+    i2c_async_stats_t st = i2c_async_stats();
+    // cpu time = time in the handler: the submits are noise.
+    uint64_t irq = fake_irq_ns();
+    printk("async: %d x %d byte writes: %d usec, %d interrupts, queue hiwater=%d, full=%d\n",
+        NTXN, NBYTES, (unsigned)(t / 1000), st.nints, st.q_hiwater, st.q_full);
+    unsigned idle = 1000 - (irq * 1000) / t;
+    printk("async: handler=%d usec, free cpu=%d usec: cpu idle = %d.%d%%\n",
+        (unsigned)(irq / 1000), work_us, idle / 10, idle % 10);
+}
+
+// resubmit <t->arg> when <t> is done.
+static void chain(i2c_txn_t *t) {
+    if(!i2c_async_submit(t->arg))
+        panic("submit from the done callback failed\n");
+}
+
+// ACKs its address, then NACKs a data byte.
+enum { PICKY_ADDR = 0x51, PICKY_NBYTES = 4 };
+static unsigned picky_n;
+static int picky_start(fake_i2c_slave_t *s, int read_p) {
+    picky_n = 0;
+    return 1;
+}
+static int picky_write(fake_i2c_slave_t *s, uint8_t b) {
+    return ++picky_n < PICKY_NBYTES;
+}
+static fake_i2c_slave_t picky = {
+    .name = "picky", .addr = PICKY_ADDR, .start = picky_start, .write = picky_write
+};
+
+static void errors(void) {
+    unsigned nints = i2c_async_stats().nints;
+
+    fill(wbuf[0], 99);
+    fill(wbuf[1], 100);
+    i2c_txn_t bad = { .addr = PICKY_ADDR, .data = wbuf[0], .nbytes = NBYTES + 1 };
+    i2c_txn_t good = { .addr = SLAVE_ADDR, .data = wbuf[1], .nbytes = NBYTES + 1 };
+    // the handler is late (interrupts off), so it first sees the
+    // NACK while the STOP is still going out: TA set, DONE to come.
+    uint32_t cpsr = cpsr_int_disable();
+    i2c_async_submit(&bad);
+    i2c_async_submit(&good);
+    while(!(GET32(I2C_S) & I2C_S_ERR))
+        ;
+    if(!(GET32(I2C_S) & I2C_S_TA))
+        panic("STOP already sent: not testing anything\n");
+    cpsr_int_reset(cpsr);
+    if(i2c_async_wait(&bad) != I2C_ERR_NACK)
+        panic("NACKed write: status=%d\n", bad.status);
+    if(i2c_async_wait(&good) != NBYTES + 1)
+        panic("write queued behind a NACK: status=%d\n", good.status);
+
+    // read it back through a pointer write whose callback queues the read.
+    uint8_t ptr = 0;
+    i2c_txn_t r = { .addr = SLAVE_ADDR, .read_p = 1, .data = rbuf[0], .nbytes = NBYTES };
+    i2c_txn_t w = { .addr = SLAVE_ADDR, .data = &ptr, .nbytes = 1, .done = chain, .arg = &r };
+    i2c_async_submit(&w);
+    if(i2c_async_wait(&w) != 1 || i2c_async_wait(&r) != NBYTES)
+        panic("chained read failed: %d %d\n", w.status, r.status);
+    if(memcmp(rbuf[0], &wbuf[1][1], NBYTES) != 0)
+        panic("write behind a NACK wrote the wrong bytes\n");
+
+    // a slave holding SDA: that transfer fails, the bus is recovered
+    // and the next one goes through.
+    unsigned nrecover = i2c_bus_recoveries();
+    fake_bsc_stick_sda(3);
+    i2c_async_submit(&bad);
+    i2c_async_submit(&good);
+    if(i2c_async_wait(&bad) >= 0 || i2c_async_wait(&good) != NBYTES + 1)
+        panic("stuck bus: %d then %d\n", bad.status, good.status);
+    if(i2c_bus_recoveries() != nrecover + 1)
+        panic("stuck bus not recovered\n");
+    printk("async: NACK, stuck bus, good writes after each and a chained read: "
+        "%d interrupts\n", i2c_async_stats().nints - nints);
+}
+
+void notmain(void) {
+    fake_i2c_slave_t *mem = fake_i2c_mem_slave(SLAVE_ADDR, 256);
+    fake_bsc_attach(mem);
+    fake_bsc_attach(&picky);
+
+    i2c_init();
+    polled();
+    async();
+    errors();
+    printk("SUCCESS: async engine moved %d bytes\n", NTXN * NBYTES);
+}
@@ -0,0 +1,53 @@
+// a slave left holding SDA low (reset or aborted transfer) used to
+// fail every transfer until a power cycle.  now the failing transfer
+// recovers the bus and the next one goes through.
+#include "rpi.h"
+#include "i2c.h"
+#include "fake-bsc.h"
+
+enum { SLAVE_ADDR = 0x50 };
+
+static uint8_t msg[] = { 0x00, 1, 2, 3 };
+
+static void write_ok(const char *what) {
+    int r = i2c_write(SLAVE_ADDR, msg, sizeof msg);
+    if(r != sizeof msg)
+        panic("%s: write failed: %s\n", what, i2c_strerror(r));
+}
+
+void notmain(void) {
+    fake_i2c_slave_t *mem = fake_i2c_mem_slave(SLAVE_ADDR, 256);
+    fake_bsc_attach(mem);
+
+    // stuck before we even start: i2c_init clears it.
+    fake_bsc_stick_sda(3);
+    i2c_init();
+    if(i2c_bus_recoveries() != 1)
+        panic("i2c_init did not recover the bus\n");
+    write_ok("after init");
+
+    // stuck mid-run: one transfer lost, and it costs little.
+    fake_bsc_stick_sda(7);
+    uint64_t s = fake_time_ns();
+    int r = i2c_write(SLAVE_ADDR, msg, sizeof msg);
+    unsigned cost = (fake_time_ns() - s) / 1000;
+    printk("stuck SDA: %s, recovery took the transfer %d usec\n", i2c_strerror(r), cost);
+    if(r >= 0 || i2c_bus_recoveries() != 2)
+        panic("expected a failed transfer and a recovery\n");
+    if(i2c_bus_stuck())
+        panic("bus still stuck\n");
+    write_ok("after recovery");
+
+    // longer than 9 clocks: the first recovery cannot finish it, the
+    // next failure's does.
+    fake_bsc_stick_sda(15);
+    r = i2c_write(SLAVE_ADDR, msg, sizeof msg);
+    if(r >= 0 || !i2c_bus_stuck())
+        panic("15 clocks should outlast one recovery\n");
+    r = i2c_write(SLAVE_ADDR, msg, sizeof msg);
+    if(r >= 0 || i2c_bus_stuck())
+        panic("second recovery should have cleared it\n");
+    write_ok("after two recoveries");
+
+    printk("SUCCESS: %d recoveries, bus usable after each\n", i2c_bus_recoveries());
+}
@@ -0,0 +1,64 @@
+// bus speed profiles and the auto-probe against the simulated BSC:
+// a device rated for 400kHz behind a 400MHz core clock (pi zero
+// default) has to end up at 400kHz, and moving the same bytes has
+// to get ~4x faster.
+#include "rpi.h"
+#include "i2c.h"
+#include "fake-bsc.h"
+
+enum { SLAVE_ADDR = 0x50, NBYTES = 64 };
+
+static uint8_t wbuf[NBYTES + 1], rbuf[NBYTES];
+
+// probe check: write a pattern and read it back.
+static int loopback(void *arg) {
+    for(unsigned i = 0; i < NBYTES; i++)
+        wbuf[i+1] = i ^ 0x5a;
+    wbuf[0] = 0;
+    if(i2c_write(SLAVE_ADDR, wbuf, NBYTES + 1) != NBYTES + 1)
+        return 0;
+    if(i2c_write_read(SLAVE_ADDR, wbuf, 1, rbuf, NBYTES) != NBYTES)
+        return 0;
+    return memcmp(rbuf, wbuf + 1, NBYTES) == 0;
+}
+
+static unsigned time_usec(void) {
+    uint64_t s = fake_time_ns();
+    if(!loopback(0))
+        panic("loopback failed at %d hz\n", i2c_get_speed());
+    return (fake_time_ns() - s) / 1000;
+}
+
+void notmain(void) {
+    fake_bsc_core_hz_set(400 * 1000 * 1000);
+    fake_i2c_slave_t *mem = fake_i2c_mem_slave(SLAVE_ADDR, 256);
+    mem->max_hz = I2C_FAST;
+    fake_bsc_attach(mem);
+
+    // DIV=0 is the slowest divider, not a divide by zero.
+    PUT32(I2C_DIV, 0);
+    if(i2c_get_speed() != 400 * 1000 * 1000 / 32768)
+        panic("DIV=0 reads as %d hz\n", i2c_get_speed());
+
+    i2c_init();
+
+    unsigned hz = i2c_get_speed();
+    if(hz > I2C_STANDARD || hz < I2C_STANDARD * 95 / 100)
+        panic("default speed is %d hz\n", hz);
+    unsigned t_std = time_usec();
+    printk("%d hz: %d usec for a %d byte write + read back\n", hz, t_std, NBYTES);
+
+    hz = i2c_speed_probe(loopback, 0);
+    if(hz > I2C_FAST || hz < I2C_FAST * 95 / 100)
+        panic("probe picked %d hz, expected ~%d\n", hz, I2C_FAST);
+    unsigned t_fast = time_usec();
+    printk("%d hz: %d usec for a %d byte write + read back\n", hz, t_fast, NBYTES);
+
+    // speed sticks across a re-init (e.g., atecc wakeup).
+    i2c_init();
+    if(i2c_get_speed() != hz)
+        panic("i2c_init reset the speed to %d\n", i2c_get_speed());
+
+    printk("SUCCESS: probe picked %d hz, %d.%dx faster\n",
+        hz, t_std / t_fast, (t_std * 10 / t_fast) % 10);
+}
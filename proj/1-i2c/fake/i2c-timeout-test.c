@@ -0,0 +1,51 @@
+// every failure mode has to come back as its own error, and a stuck
+// slave must cost no more than the deadline.
+#include "rpi.h"
+#include "i2c.h"
+#include "fake-bsc.h"
+
+enum { MEM_ADDR = 0x50, SLOW_ADDR = 0x51, STUCK_ADDR = 0x52, MISSING_ADDR = 0x53 };
+
+static int expect(const char *what, int got, int want) {
+    printk("%s: %d (%s)\n", what, got, i2c_strerror(got));
+    if(got != want)
+        panic("%s: expected %d (%s)\n", what, want, i2c_strerror(want));
+    return got;
+}
+
+void notmain(void) {
+    fake_bsc_attach(fake_i2c_mem_slave(MEM_ADDR, 256));
+
+    // stretches longer than CLKT allows.
+    fake_i2c_slave_t *slow = fake_i2c_mem_slave(SLOW_ADDR, 256);
+    slow->stretch_ns = 10 * 1000 * 1000;
+    fake_bsc_attach(slow);
+
+    // holds SCL forever.
+    fake_i2c_slave_t *stuck = fake_i2c_mem_slave(STUCK_ADDR, 256);
+    stuck->stretch_ns = FAKE_STRETCH_FOREVER;
+    fake_bsc_attach(stuck);
+
+    i2c_init();
+
+    uint8_t buf[4] = { 0, 1, 2, 3 };
+    expect("good write", i2c_write(MEM_ADDR, buf, sizeof buf), sizeof buf);
+    expect("missing device", i2c_write(MISSING_ADDR, buf, sizeof buf), I2C_ERR_NACK);
+    expect("clock stretch", i2c_read(SLOW_ADDR, buf, sizeof buf), I2C_ERR_CLKT);
+
+    // turn the BSC's own CLKT check off: only the deadline is left.
+    PUT32(I2C_CLKT, 0);
+    uint64_t s = fake_time_ns();
+    expect("stuck slave", i2c_read(STUCK_ADDR, buf, sizeof buf), I2C_ERR_TIMEOUT);
+    unsigned usec = (fake_time_ns() - s) / 1000;
+    // deadline + STOP grace + wire time for 4 bytes at 100kHz, rounded up.
+    unsigned budget = i2c_get_timeout_usec() + I2C_STOP_USEC + 2000;
+    printk("stuck slave cost %d usec (budget %d)\n", usec, budget);
+    if(usec > budget)
+        panic("stuck slave took longer than the deadline\n");
+
+    // the bus has to be usable again.
+    expect("write after timeout", i2c_write(MEM_ADDR, buf, sizeof buf), sizeof buf);
+
+    printk("SUCCESS: NACK, CLKT and deadline all reported\n");
+}
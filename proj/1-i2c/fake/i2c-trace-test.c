@@ -0,0 +1,44 @@
+// run the tracer over a mix of transfers on the simulated BSC and
+// decode the dump with the libunix decoder.  build with
+// "make TRACE=1".
+#include "rpi.h"
+#include "i2c.h"
+#include "i2c-trace.h"
+#include "fake-bsc.h"
+#include "libunix.h"
+
+#if !I2C_TRACE
+#error "build with make TRACE=1"
+#endif
+
+enum { SLAVE_ADDR = 0x50, MISSING_ADDR = 0x51 };
+
+static uint8_t dump[16 + I2C_TRACE_N * 12];
+static unsigned ndump;
+
+static void dump_put8(void *arg, uint8_t b) {
+    assert(ndump < sizeof dump);
+    dump[ndump++] = b;
+}
+
+void notmain(void) {
+    fake_bsc_attach(fake_i2c_mem_slave(SLAVE_ADDR, 256));
+    i2c_init();
+    i2c_trace_reset();
+
+    uint8_t buf[41] = { 0 };
+    for(unsigned n = 1; n <= 40; n += 3) {
+        if(i2c_write(SLAVE_ADDR, buf, n) != n)
+            panic("write of %d failed\n", n);
+        if(i2c_write_read(SLAVE_ADDR, buf, 1, buf + 1, n) != n)
+            panic("write_read of %d failed\n", n);
+    }
+    if(i2c_write(MISSING_ADDR, buf, 4) >= 0)
+        panic("write to missing device worked\n");
+
+    unsigned nrec = i2c_trace_dump_fn(dump_put8, 0);
+    int ndec = i2c_trace_decode(dump, ndump, 700);
+    if(ndec != nrec)
+        panic("dumped %d records, decoded %d\n", nrec, ndec);
+    printk("SUCCESS: %d trace records in %d bytes\n", nrec, ndump);
+}
@@ -0,0 +1,76 @@
+// write-then-read with a repeated START against the simulated BSC:
+// check the bytes, that no STOP was issued in between, and what
+// it saves over a separate write and read.
+#include "rpi.h"
+#include "i2c.h"
+#include "fake-bsc.h"
+
+enum { SLAVE_ADDR = 0x50, MISSING_ADDR = 0x51, NBYTES = 8, NITER = 16 };
+
+static void check(const uint8_t *got, const uint8_t *mem, unsigned off) {
+    if(memcmp(got, mem + off, NBYTES) != 0)
+        panic("read at offset %d does not match\n", off);
+}
+
+void notmain(void) {
+    fake_i2c_slave_t *mem = fake_i2c_mem_slave(SLAVE_ADDR, 256);
+    fake_bsc_attach(mem);
+    uint8_t *buf = fake_i2c_mem_slave_buf(mem);
+    for(unsigned i = 0; i < 256; i++)
+        buf[i] = i * 13 + 1;
+
+    i2c_init();
+
+    uint8_t rbuf[NBYTES];
+
+    // separate write (sets the pointer), STOP, then read.
+    uint64_t s = fake_time_ns();
+    for(unsigned i = 0; i < NITER; i++) {
+        uint8_t off = i * NBYTES;
+        if(i2c_write(SLAVE_ADDR, &off, 1) != 1)
+            panic("write %d failed\n", i);
+        if(i2c_read(SLAVE_ADDR, rbuf, NBYTES) != NBYTES)
+            panic("read %d failed\n", i);
+        check(rbuf, buf, off);
+    }
+    uint64_t t_sep = fake_time_ns() - s;
+
+    fake_bsc_stats_t st0 = fake_bsc_stats();
+    s = fake_time_ns();
+    for(unsigned i = 0; i < NITER; i++) {
+        uint8_t off = i * NBYTES + 3;
+        if(i2c_write_read(SLAVE_ADDR, &off, 1, rbuf, NBYTES) != NBYTES)
+            panic("write_read %d failed\n", i);
+        check(rbuf, buf, off);
+    }
+    uint64_t t_rs = fake_time_ns() - s;
+    fake_bsc_stats_t st1 = fake_bsc_stats();
+
+    unsigned nrs = st1.nrestarts - st0.nrestarts;
+    if(nrs != NITER)
+        panic("expected %d repeated starts, saw %d\n", NITER, nrs);
+    printk("separate write+read: %d usec for %d reads\n", (unsigned)(t_sep/1000), NITER);
+    printk("repeated start:      %d usec for %d reads (%d restarts)\n",
+        (unsigned)(t_rs/1000), NITER, nrs);
+
+    // vectored: pointer write + read, then a plain write.
+    uint8_t off = 0x40, out[3] = { 0x80, 0xaa, 0xbb };
+    i2c_msg_t msgs[] = {
+        { .addr = SLAVE_ADDR, .data = &off, .nbytes = 1 },
+        { .addr = SLAVE_ADDR, .read_p = 1, .data = rbuf, .nbytes = NBYTES },
+        { .addr = SLAVE_ADDR, .data = out, .nbytes = sizeof out },
+    };
+    int n = i2c_transfer(msgs, 3);
+    if(n != 1 + NBYTES + sizeof out)
+        panic("transfer returned %d\n", n);
+    check(rbuf, buf, off);
+    if(buf[0x80] != 0xaa || buf[0x81] != 0xbb)
+        panic("transfer write did not land\n");
+
+    // nobody home: the write phase NACKs.
+    if(i2c_write_read(MISSING_ADDR, &off, 1, rbuf, NBYTES) >= 0)
+        panic("write_read to a missing device succeeded\n");
+
+    printk("SUCCESS: repeated start saves %d usec per read\n",
+        (unsigned)((t_sep - t_rs) / NITER / 1000));
+}
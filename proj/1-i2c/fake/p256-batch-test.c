@@ -0,0 +1,125 @@
+// p256_verify_batch gives p256_verify's answer for every item: good
+// and bad signatures, with right, wrong and missing recovery ids,
+// more keys than cache slots, and forged items bisected out of an
+// otherwise good batch.  then verifies per second (host wall clock)
+// by batch size: tests/16 prints the same table in cycles on the pi,
+// and the same checksum.
+#include "rpi.h"
+#include "p256.h"
+#include "fast-hash32.h"
+#include "libunix.h"
+#include "../tests/p256-vectors.h"
+
+enum { NVEC = sizeof p256_vectors / sizeof p256_vectors[0], NI = 512 };
+
+static p256_batch_item_t items[NI];
+static uint8_t ok[NI], forged[NI][64];
+
+// the valid vectors signed by the first <nkeys> keys.
+static unsigned good_vectors(const p256_vector_t **good, unsigned nkeys) {
+    const uint8_t *keys[16];
+    unsigned nk = 0, n = 0;
+    for(unsigned i = 0; i < NVEC; i++) {
+        const p256_vector_t *v = &p256_vectors[i];
+        if(!v->ok)
+            continue;
+        unsigned k;
+        for(k = 0; k < nk; k++)
+            if(memcmp(keys[k], v->pubkey, 64) == 0)
+                break;
+        if(k == nk) {
+            if(nk == nkeys)
+                continue;
+            keys[nk++] = v->pubkey;
+        }
+        good[n++] = v;
+    }
+    return n;
+}
+
+static void check(unsigned n, const char *what) {
+    unsigned nok = p256_verify_batch(items, n, ok), want = 0;
+    for(unsigned i = 0; i < n; i++) {
+        int v = p256_verify(items[i].pubkey, items[i].digest, items[i].sig);
+        if(ok[i] != v)
+            panic("%s: item %d: batch says %d, p256_verify %d\n", what, i, ok[i], v);
+        want += v;
+    }
+    if(nok != want)
+        panic("%s: returned %d, %d verify\n", what, nok, want);
+}
+
+void notmain(void) {
+    kmalloc_init(1);
+
+    // every vector, each with its recovery id, then with none.
+    for(unsigned i = 0; i < NI; i++) {
+        const p256_vector_t *v = &p256_vectors[i % NVEC];
+        items[i] = (p256_batch_item_t){ v->pubkey, v->digest, v->sig,
+            p256_verify_recid(v->pubkey, v->digest, v->sig) };
+    }
+    check(NI, "all vectors");
+    for(unsigned i = 0; i < NI; i++)
+        items[i].recid = -1;
+    check(NI, "no recovery ids");
+
+    // good signatures from four keys; then a few forged in: the same
+    // recovery id, one bit of s off.
+    const p256_vector_t *good[NVEC];
+    unsigned ngood = good_vectors(good, 4);
+    for(unsigned i = 0; i < NI; i++) {
+        const p256_vector_t *v = good[i % ngood];
+        items[i] = (p256_batch_item_t){ v->pubkey, v->digest, v->sig,
+            p256_verify_recid(v->pubkey, v->digest, v->sig) };
+    }
+    check(NI, "good");
+    p256_batch_stats_t st = p256_batch_stats();
+    check(P256_BATCH_MAX, "good, one batch");
+    p256_batch_stats_t st2 = p256_batch_stats();
+    if(st2.naggregate - st.naggregate != 1 || st2.nsingle != st.nsingle)
+        panic("a good batch took %d aggregates and %d single verifies\n",
+            st2.naggregate - st.naggregate, st2.nsingle - st.nsingle);
+
+    static const unsigned bad[] = { 5, 77, 78, 120 };
+    for(unsigned i = 0; i < sizeof bad / sizeof bad[0]; i++) {
+        memcpy(forged[i], items[bad[i]].sig, 64);
+        forged[i][40] ^= 0x10;
+        items[bad[i]].sig = forged[i];
+    }
+    st = p256_batch_stats();
+    check(P256_BATCH_MAX, "forged");
+    st2 = p256_batch_stats();
+    printk("4 forged in %d: %d aggregates, %d splits, %d single verifies\n",
+        P256_BATCH_MAX, st2.naggregate - st.naggregate, st2.nsplits - st.nsplits,
+        st2.nsingle - st.nsingle);
+    if(st2.nsingle - st.nsingle >= P256_BATCH_MAX / 2)
+        panic("bisection verified most of the batch one at a time\n");
+    uint32_t sum = fast_hash32(ok, P256_BATCH_MAX);
+
+    // a wrong recovery id on a good signature costs time, not truth.
+    items[bad[0]].sig = good[bad[0] % ngood]->sig;
+    items[bad[0]].recid ^= 1;
+    check(P256_BATCH_MAX, "wrong recovery id");
+    items[bad[0]].recid ^= 1;
+    for(unsigned i = 1; i < sizeof bad / sizeof bad[0]; i++)
+        items[bad[i]].sig = good[bad[i] % ngood]->sig;
+
+    // rate by batch size, on the good items.
+    for(unsigned i = 0; i < 64; i++)
+        p256_verify(items[i].pubkey, items[i].digest, items[i].sig);
+    time_usec_t s = time_get_usec();
+    for(unsigned i = 0; i < NI; i++)
+        p256_verify(items[i].pubkey, items[i].digest, items[i].sig);
+    unsigned one = time_get_usec() - s;
+    printk("one at a time: %d verifies/sec\n", (unsigned)(NI * 1000000ULL / one));
+    for(unsigned b = 1; b <= P256_BATCH_MAX; b *= 2) {
+        s = time_get_usec();
+        for(unsigned i = 0; i + b <= NI; i += b)
+            if(p256_verify_batch(items + i, b, ok + i) != b)
+                panic("good batch of %d failed\n", b);
+        unsigned t = time_get_usec() - s;
+        printk("batch %d: %d verifies/sec\n", b, (unsigned)(NI * 1000000ULL / t));
+    }
+
+    printk("SUCCESS: batch verify agrees with p256_verify, checksum %x\n", sum);
+}
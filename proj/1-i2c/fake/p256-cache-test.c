@@ -0,0 +1,57 @@
+// p256_verify's key cache: it gives the same answer as the uncached
+// verifier on every vector, in an order that keeps more keys live
+// than there are slots; a repeated key hits; off-curve keys are never
+// cached; a flush makes every key cold again.
+#include "rpi.h"
+#include "p256.h"
+#include "../tests/p256-vectors.h"
+
+enum { NVEC = sizeof p256_vectors / sizeof p256_vectors[0] };
+
+static void check(const p256_vector_t *v) {
+    int ok = p256_verify(v->pubkey, v->digest, v->sig);
+    if(ok != v->ok || ok != p256_verify_uncached(v->pubkey, v->digest, v->sig))
+        panic("vector <%s>: cached %d, expected %d\n", v->name, ok, v->ok);
+}
+
+void notmain(void) {
+    kmalloc_init(1);
+
+    // forwards, backwards and strided: keys come and go.
+    for(unsigned i = 0; i < NVEC; i++)
+        check(&p256_vectors[i]);
+    for(unsigned i = NVEC; i-- > 0; )
+        check(&p256_vectors[i]);
+    for(unsigned i = 0; i < 3 * NVEC; i++)
+        check(&p256_vectors[(i * 7) % NVEC]);
+    p256_cache_stats_t st = p256_cache_stats();
+    printk("%d verifies: %d hits, %d misses, %d evictions (%d slots)\n",
+        5 * NVEC, st.hits, st.misses, st.evictions, P256_KEY_CACHE_N);
+    if(st.evictions == 0)
+        panic("more keys than slots but nothing was evicted\n");
+
+    // one key over and over: one miss, then hits.
+    const p256_vector_t *v = &p256_vectors[0];
+    p256_cache_flush();
+    st = p256_cache_stats();
+    for(unsigned i = 0; i < 10; i++)
+        check(v);
+    p256_cache_stats_t st2 = p256_cache_stats();
+    if(st2.misses - st.misses != 1 || st2.hits - st.hits != 9)
+        panic("repeated key: %d misses, %d hits\n",
+            st2.misses - st.misses, st2.hits - st.hits);
+
+    // a bad key is rejected every time and takes no slot.
+    uint8_t bad[64];
+    memcpy(bad, v->pubkey, 64);
+    bad[63] ^= 1;
+    st = p256_cache_stats();
+    for(unsigned i = 0; i < 3; i++)
+        if(p256_verify(bad, v->digest, v->sig))
+            panic("off-curve key verified\n");
+    st2 = p256_cache_stats();
+    if(st2.misses != st.misses || st2.hits != st.hits)
+        panic("off-curve key was cached\n");
+
+    printk("SUCCESS: cached verify agrees with uncached on %d verifies\n", 5 * NVEC + 13);
+}
@@ -0,0 +1,75 @@
+// libpi's P-256 verifier against the generated vectors
+// (proj/2-py-util/p256-vectors.py), every single-bit corruption of
+// one good signature, and atecc608a_verify going through it without
+// touching the bus.  no kmalloc_init: with no heap, as on a pi that
+// never set one up, verify still works, just without its key cache.
+#include "rpi.h"
+#include "i2c.h"
+#include "atecc608a.h"
+#include "p256.h"
+#include "fake-atecc.h"
+#include "../tests/p256-vectors.h"
+
+enum { NVEC = sizeof p256_vectors / sizeof p256_vectors[0] };
+
+void notmain(void) {
+    unsigned nok = 0;
+    for(unsigned i = 0; i < NVEC; i++) {
+        const p256_vector_t *v = &p256_vectors[i];
+        int ok = p256_verify(v->pubkey, v->digest, v->sig);
+        if(ok != v->ok)
+            panic("vector <%s>: got %d, expected %d\n", v->name, ok, v->ok);
+        nok += ok;
+    }
+    // a batch big enough to aggregate goes one at a time instead.
+    static p256_batch_item_t items[NVEC];
+    static uint8_t ok[NVEC];
+    for(unsigned i = 0; i < NVEC; i++) {
+        const p256_vector_t *v = &p256_vectors[i];
+        items[i] = (p256_batch_item_t){ v->pubkey, v->digest, v->sig,
+            p256_verify_recid(v->pubkey, v->digest, v->sig) };
+    }
+    if(p256_verify_batch(items, NVEC, ok) != nok)
+        panic("batch verify with no heap disagrees\n");
+    for(unsigned i = 0; i < NVEC; i++)
+        if(ok[i] != p256_vectors[i].ok)
+            panic("vector <%s>: batch says %d\n", p256_vectors[i].name, ok[i]);
+    if(p256_cache_stats().misses != 0 || p256_batch_stats().naggregate != 0)
+        panic("key tables built with no heap\n");
+    if(p256_pubkey_valid(p256_vectors[0].pubkey) != 1)
+        panic("good key rejected\n");
+
+    // every bit of the signature and the digest matters.
+    const p256_vector_t *v = &p256_vectors[0];
+    uint8_t sig[64], digest[32];
+    unsigned nflips = 0;
+    for(unsigned bit = 0; bit < 64 * 8; bit++, nflips++) {
+        memcpy(sig, v->sig, 64);
+        sig[bit / 8] ^= 1 << (bit % 8);
+        if(p256_verify(v->pubkey, v->digest, sig))
+            panic("signature bit %d flipped still verifies\n", bit);
+    }
+    for(unsigned bit = 0; bit < 32 * 8; bit++, nflips++) {
+        memcpy(digest, v->digest, 32);
+        digest[bit / 8] ^= 1 << (bit % 8);
+        if(p256_verify(v->pubkey, digest, v->sig))
+            panic("digest bit %d flipped still verifies\n", bit);
+    }
+
+    // the driver verifies in software: no commands reach the chip.
+    fake_i2c_slave_t *chip = fake_atecc(ATECC608A_ADDR);
+    fake_bsc_attach(chip);
+    i2c_init();
+    unsigned ncmds = fake_atecc_stats(chip).ncmds;
+    if(atecc608a_verify(v->digest, v->sig, v->pubkey) != 0)
+        panic("atecc608a_verify rejected a good signature\n");
+    memcpy(sig, v->sig, 64);
+    sig[0] ^= 1;
+    if(atecc608a_verify(v->digest, sig, v->pubkey) != 1)
+        panic("atecc608a_verify accepted a bad signature\n");
+    if(fake_atecc_stats(chip).ncmds != ncmds)
+        panic("software verify sent %d commands\n", fake_atecc_stats(chip).ncmds - ncmds);
+
+    printk("SUCCESS: p256 verify matches %d vectors (%d valid), rejects %d bit flips\n",
+        NVEC, nok, nflips);
+}
@@ -0,0 +1,137 @@
+// libpi's secp256k1 signer against the generated vectors
+// (proj/2-py-util/secp256k1-vectors.py): every signature byte for
+// byte with its recovery id, verify accepting those and high-S twins
+// and rejecting bit flips, and a key sealed under the (fake) chip's
+// ECDH opening only there, only unchanged.
+#include "rpi.h"
+#include "i2c.h"
+#include "atecc608a.h"
+#include "atecc-seal.h"
+#include "secp256k1.h"
+#include "sha256.h"
+#include "fake-atecc.h"
+#include "../tests/secp256k1-vectors.h"
+
+enum { NVEC = sizeof secp256k1_vectors / sizeof secp256k1_vectors[0] };
+
+// the curve order, big-endian: n - s is the high-S twin.
+static const uint8_t n_be[32] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xba, 0xae, 0xdc, 0xe6, 0xaf, 0x48, 0xa0, 0x3b, 0xbf, 0xd2, 0x5e, 0x8c, 0xd0, 0x36, 0x41, 0x41,
+};
+
+static void negate_s(uint8_t sig[64]) {
+    int borrow = 0;
+    for(int i = 31; i >= 0; i--) {
+        int d = n_be[i] - sig[32 + i] - borrow;
+        borrow = d < 0;
+        sig[32 + i] = d;
+    }
+}
+
+void notmain(void) {
+    secp256k1_key_t key;
+    uint8_t sig[64];
+
+    for(unsigned i = 0; i < NVEC; i++) {
+        const secp256k1_vector_t *v = &secp256k1_vectors[i];
+        if(!secp256k1_key_init(&key, v->priv))
+            panic("vector <%s>: key rejected\n", v->name);
+        if(memcmp(key.pubkey, v->pubkey, 64) != 0)
+            panic("vector <%s>: wrong public key\n", v->name);
+        int recid = secp256k1_sign(&key, v->digest, sig);
+        if(recid != v->recid || memcmp(sig, v->sig, 64) != 0)
+            panic("vector <%s>: signature differs (recid %d, expected %d)\n",
+                v->name, recid, v->recid);
+        if(!secp256k1_verify(v->pubkey, v->digest, sig))
+            panic("vector <%s>: own signature does not verify\n", v->name);
+        negate_s(sig);
+        if(!secp256k1_verify(v->pubkey, v->digest, sig))
+            panic("vector <%s>: high-S twin does not verify\n", v->name);
+    }
+
+    uint8_t zero[32] = {0};
+    if(secp256k1_key_init(&key, zero) || secp256k1_key_init(&key, n_be))
+        panic("0 or n accepted as a private key\n");
+
+    // every bit of the signature and the digest matters.
+    const secp256k1_vector_t *v = &secp256k1_vectors[NVEC - 1];
+    uint8_t digest[32];
+    unsigned nflips = 0;
+    for(unsigned bit = 0; bit < 64 * 8; bit++, nflips++) {
+        memcpy(sig, v->sig, 64);
+        sig[bit / 8] ^= 1 << (bit % 8);
+        if(secp256k1_verify(v->pubkey, v->digest, sig))
+            panic("signature bit %d flipped still verifies\n", bit);
+    }
+    for(unsigned bit = 0; bit < 32 * 8; bit++, nflips++) {
+        memcpy(digest, v->digest, 32);
+        digest[bit / 8] ^= 1 << (bit % 8);
+        if(secp256k1_verify(v->pubkey, digest, v->sig))
+            panic("digest bit %d flipped still verifies\n", bit);
+    }
+
+    // sealed under the chip: ECDH with ATECC_SEAL_SLOT and the seal
+    // point, a nonce from RANDOM.
+    fake_i2c_slave_t *chip = fake_atecc(ATECC608A_ADDR);
+    fake_bsc_attach(chip);
+    i2c_init();
+
+    secp256k1_sealed_t sealed, sealed2, bad;
+    if(atecc_seal_k1(v->priv, &sealed) < 0 || atecc_seal_k1(v->priv, &sealed2) < 0)
+        panic("sealing failed\n");
+    if(memcmp(sealed.ct, v->priv, 32) == 0)
+        panic("sealed key is in the clear\n");
+    if(memcmp(sealed.nonce, sealed2.nonce, sizeof sealed.nonce) == 0)
+        panic("two seals share a nonce\n");
+
+    unsigned ncmds = fake_atecc_stats(chip).ncmds;
+    memset(&key, 0xff, sizeof key);
+    if(atecc_unseal_k1(&sealed2, &key) != 0)
+        panic("sealed key does not open\n");
+    if(fake_atecc_stats(chip).ncmds - ncmds != 1)
+        panic("unseal took %d commands, not one ECDH\n", fake_atecc_stats(chip).ncmds - ncmds);
+    if(memcmp(key.priv, v->priv, 32) != 0 || memcmp(key.pubkey, v->pubkey, 64) != 0)
+        panic("unsealed the wrong key\n");
+    if(secp256k1_sign(&key, v->digest, sig) != v->recid || memcmp(sig, v->sig, 64) != 0)
+        panic("unsealed key signs differently\n");
+    secp256k1_key_wipe(&key);
+
+    // any bit of the blob changed: it does not open.
+    unsigned ntamper = 0;
+    for(unsigned bit = 0; bit < sizeof sealed * 8; bit += 7, ntamper++) {
+        bad = sealed;
+        ((uint8_t *)&bad)[bit / 8] ^= 1 << (bit % 8);
+        if(secp256k1_unseal(key.priv, zero, &bad) || atecc_unseal_k1(&bad, &key) != 1)
+            panic("blob with bit %d flipped opened\n", bit);
+    }
+
+    // the kek is ECDH with this chip's seal slot: another chip's (or
+    // another slot's) does not open the blob.
+    uint8_t kek[32], expect[32], secret[32];
+    static const char label[] = "raspberry-tee secp256k1 kek";
+    if(atecc_seal_kek(kek) < 0)
+        panic("no kek\n");
+    fake_atecc_ecdh(ATECC608A_ADDR, ATECC_SEAL_SLOT, atecc_seal_point, secret);
+    hmac_sha256(secret, 32, label, sizeof label - 1, expect);
+    if(memcmp(kek, expect, 32) != 0)
+        panic("kek is not from ECDH with slot %d\n", ATECC_SEAL_SLOT);
+    fake_atecc_ecdh(ATECC608A_ADDR + 1, ATECC_SEAL_SLOT, atecc_seal_point, secret);
+    hmac_sha256(secret, 32, label, sizeof label - 1, kek);
+    if(secp256k1_unseal(key.priv, kek, &sealed))
+        panic("another chip's kek opened the blob\n");
+    fake_atecc_ecdh(ATECC608A_ADDR, 0, atecc_seal_point, secret);
+    hmac_sha256(secret, 32, label, sizeof label - 1, kek);
+    if(secp256k1_unseal(key.priv, kek, &sealed))
+        panic("slot 0's kek opened the blob\n");
+
+    // ECDH refused (a slot without ECDH permission): an error, not a
+    // wrong key.
+    fake_atecc_fail_next(chip, ATECC_CMD_ECDH, 0x0f);
+    if(atecc_unseal_k1(&sealed, &key) != -1)
+        panic("failed ECDH was not reported\n");
+
+    printk("SUCCESS: secp256k1 signs %d vectors byte for byte, rejects %d bit flips; "
+        "sealed key opens only unchanged (%d tampered blobs refused)\n",
+        NVEC, nflips, ntamper);
+}
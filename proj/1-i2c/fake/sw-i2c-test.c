@@ -0,0 +1,100 @@
+// the bit-banged master (libpi/src/sw-i2c.c) against the open-drain
+// bus model: two separate buses with a device at the same address
+// on each, clock stretching, NACK and a slave that never lets go.
+#include "rpi.h"
+#include "sw-i2c.h"
+#include "fake-sw-i2c.h"
+
+enum {
+    A_SCL = 20, A_SDA = 21,
+    B_SCL = 22, B_SDA = 23,
+    MEM_ADDR = 0x50, SLOW_ADDR = 0x51, STUCK_ADDR = 0x52,
+    NBYTES = 16,
+};
+
+// write <NBYTES> at offset 0 and read them back.
+static void round_trip(sw_i2c_t *h, uint8_t addr, uint8_t seed) {
+    uint8_t w[NBYTES + 1], r[NBYTES];
+    w[0] = 0;
+    for(unsigned i = 0; i < NBYTES; i++)
+        w[i+1] = seed + i * 3;
+
+    int n = sw_i2c_write(h, addr, w, sizeof w);
+    if(n != sizeof w)
+        panic("write to %x on scl=%d: %d\n", addr, h->scl, n);
+    uint8_t ptr = 0;
+    n = sw_i2c_write_read(h, addr, &ptr, 1, r, sizeof r);
+    if(n != sizeof r)
+        panic("write-read from %x on scl=%d: %d\n", addr, h->scl, n);
+    if(memcmp(r, &w[1], NBYTES) != 0)
+        panic("read back mismatch from %x on scl=%d\n", addr, h->scl);
+}
+
+static void speed(fake_sw_i2c_t *bus, unsigned hz) {
+    sw_i2c_t h = sw_i2c_init(A_SCL, A_SDA, hz);
+
+    uint64_t s = fake_time_ns();
+    round_trip(&h, MEM_ADDR, hz >> 10);
+    uint64_t t = fake_time_ns() - s;
+
+    // 17 + 1 + 16 data bytes and 3 address bytes, 9 clocks each.
+    unsigned nclk = (NBYTES + 2 + NBYTES + 3) * 9;
+    unsigned wire_us = (nclk * 1000000ULL) / hz;
+    fake_sw_i2c_stats_t st = fake_sw_i2c_stats(bus);
+    printk("%dkHz: round trip %d usec (%d usec of clocks), "
+        "min scl high=%dns low=%dns\n",
+        hz / 1000, (unsigned)(t / 1000), wire_us,
+        (unsigned)st.min_high_ns, (unsigned)st.min_low_ns);
+
+    // the slave must never see a clock faster than asked.
+    uint64_t half_ns = 1000000000ULL / (2 * hz);
+    if(st.min_high_ns < half_ns * 9 / 10)
+        panic("SCL high for %dns, want %dns\n", (unsigned)st.min_high_ns, (unsigned)half_ns);
+}
+
+void notmain(void) {
+    fake_sw_i2c_t *bus_a = fake_sw_i2c_bus(A_SCL, A_SDA);
+    fake_sw_i2c_t *bus_b = fake_sw_i2c_bus(B_SCL, B_SDA);
+
+    fake_i2c_slave_t *mem_a = fake_i2c_mem_slave(MEM_ADDR, 256);
+    fake_i2c_slave_t *mem_b = fake_i2c_mem_slave(MEM_ADDR, 256);
+    fake_i2c_slave_t *slow = fake_i2c_mem_slave(SLOW_ADDR, 256);
+    fake_i2c_slave_t *stuck = fake_i2c_mem_slave(STUCK_ADDR, 256);
+    slow->stretch_ns = 200 * 1000;
+    stuck->stretch_ns = FAKE_STRETCH_FOREVER;
+    fake_sw_i2c_attach(bus_a, mem_a);
+    fake_sw_i2c_attach(bus_a, slow);
+    fake_sw_i2c_attach(bus_a, stuck);
+    fake_sw_i2c_attach(bus_b, mem_b);
+
+    speed(bus_a, 100 * 1000);
+    speed(bus_a, 400 * 1000);
+
+    // same address, different buses: each device only sees its own.
+    sw_i2c_t a = sw_i2c_init(A_SCL, A_SDA, 400 * 1000);
+    sw_i2c_t b = sw_i2c_init(B_SCL, B_SDA, 400 * 1000);
+    round_trip(&a, MEM_ADDR, 0x10);
+    round_trip(&b, MEM_ADDR, 0x80);
+    if(fake_i2c_mem_slave_buf(mem_a)[0] != 0x10 || fake_i2c_mem_slave_buf(mem_b)[0] != 0x80)
+        panic("buses are not independent\n");
+    printk("two buses, one address: ok\n");
+
+    int r = sw_i2c_write(&a, 0x33, (uint8_t[]){ 0 }, 1);
+    printk("missing device: %d\n", r);
+    if(r != SW_I2C_ERR_NACK)
+        panic("expected a NACK\n");
+
+    round_trip(&a, SLOW_ADDR, 0x40);
+    printk("200us clock stretch: ok (%d stretches)\n", fake_sw_i2c_stats(bus_a).nstretches);
+
+    uint8_t buf[4];
+    r = sw_i2c_read(&a, STUCK_ADDR, buf, sizeof buf);
+    printk("stuck slave: %d\n", r);
+    if(r != SW_I2C_ERR_CLKT)
+        panic("expected a clock stretch timeout\n");
+
+    fake_sw_i2c_stats_t st = fake_sw_i2c_stats(bus_a);
+    printk("bus a: %d starts, %d stops, %d bytes, %d nacks\n",
+        st.nstarts, st.nstops, st.nbytes, st.nacks);
+    printk("SUCCESS: bit-banged i2c works on two buses\n");
+}
@@ -0,0 +1,190 @@
+#include "i2c-async.h"
+#include "rpi-interrupts.h"
+#include "rpi-inline-asm.h"
+#include "cycle-count.h"
+#include "circular-T.h"
+#include "timeout.h"
+
+// queue of pending transactions: <i2c_async_submit> is the only
+// producer, the interrupt handler (or a submit with interrupts off)
+// the only consumer.  submit pushes with interrupts off, so a <done>
+// callback submitting from the handler cannot interleave with a
+// submit it interrupted.
+gen_circular_T(txq, txq_t, i2c_txn_t *, I2C_ASYNC_QN)
+
+static txq_t txq;
+// transaction currently on the bus: only touched with interrupts off.
+static i2c_txn_t *volatile cur;
+static i2c_async_stats_t stats;
+
+// push as many bytes as the FIFO will take.
+static void tx_fill(i2c_txn_t *t) {
+    while(t->ndone < t->nbytes && (GET32(I2C_S) & I2C_S_TXD))
+        PUT32(I2C_FIFO, t->data[t->ndone++]);
+}
+
+// pull everything the FIFO has.
+static void rx_drain(i2c_txn_t *t) {
+    while(t->ndone < t->nbytes && (GET32(I2C_S) & I2C_S_RXD))
+        t->data[t->ndone++] = GET32(I2C_FIFO) & 0xFF;
+}
+
+static void txn_start(i2c_txn_t *t) {
+    dev_barrier();
+
+    // clear FIFO and any stale status.
+    PUT32(I2C_C, I2C_C_I2CEN | I2C_C_CLEAR);
+    PUT32(I2C_S, I2C_S_CLKT | I2C_S_ERR | I2C_S_DONE);
+    PUT32(I2C_A, t->addr);
+    PUT32(I2C_DLEN, t->nbytes);
+
+    uint32_t c = I2C_C_I2CEN | I2C_C_ST | I2C_C_INTD;
+    if(t->read_p)
+        c |= I2C_C_READ | I2C_C_INTR;
+    else {
+        // prime the FIFO: only ask for TX interrupts if it
+        // didn't all fit.
+        tx_fill(t);
+        if(t->ndone < t->nbytes)
+            c |= I2C_C_INTT;
+    }
+    PUT32(I2C_C, c);
+    dev_barrier();
+}
+
+// pop the next transaction and put it on the bus.
+// must be called with interrupts off.
+static void txn_next(void) {
+    i2c_txn_t *t;
+    if(!txq_pop_nonblk(&txq, &t)) {
+        cur = 0;
+        return;
+    }
+    cur = t;
+    txn_start(t);
+}
+
+// ERR/CLKT end the transfer but the BSC is still sending its STOP
+// (TA set, DONE to come): starting the next one now would have that
+// DONE complete it.  wait the STOP out, as i2c_fail does for the
+// polled path, dropping the transfer if it never ends, and unstick a
+// slave left holding SDA.  bounded, so fine in the handler.
+static void txn_abort(void) {
+    timeout_t t = timeout_start();
+    while(GET32(I2C_S) & I2C_S_TA) {
+        if(timeout_usec(&t, I2C_STOP_USEC)) {
+            PUT32(I2C_C, 0);
+            break;
+        }
+    }
+    PUT32(I2C_C, I2C_C_I2CEN | I2C_C_CLEAR);
+    PUT32(I2C_S, I2C_S_CLKT | I2C_S_ERR | I2C_S_DONE);
+    dev_barrier();
+    if(i2c_bus_stuck())
+        i2c_bus_recover();
+}
+
+static void txn_finish(i2c_txn_t *t, int status) {
+    // quiesce: interrupts off, status cleared.
+    PUT32(I2C_C, I2C_C_I2CEN);
+    PUT32(I2C_S, I2C_S_CLKT | I2C_S_ERR | I2C_S_DONE);
+    dev_barrier();
+
+    stats.completed++;
+    if(status < 0)
+        stats.errors++;
+
+    t->status = status;
+    if(t->done)
+        t->done(t);
+    txn_next();
+}
+
+void i2c_async_int_handler(void) {
+    uint32_t s_cyc = cycle_cnt_read();
+    dev_barrier();
+    stats.nints++;
+
+    i2c_txn_t *t = cur;
+    uint32_t s = GET32(I2C_S);
+    if(!t) {
+        // nothing in flight: shut it up.
+        PUT32(I2C_C, I2C_C_I2CEN);
+        PUT32(I2C_S, I2C_S_CLKT | I2C_S_ERR | I2C_S_DONE);
+    } else if(s & (I2C_S_ERR | I2C_S_CLKT)) {
+        txn_abort();
+        txn_finish(t, (s & I2C_S_CLKT) ? I2C_ERR_CLKT : I2C_ERR_NACK);
+    } else {
+        if(t->read_p)
+            rx_drain(t);
+        else {
+            tx_fill(t);
+            // everything is in the FIFO: stop TXW interrupts or
+            // we'll take one per byte until DONE.
+            if(t->ndone == t->nbytes)
+                PUT32(I2C_C, I2C_C_I2CEN | I2C_C_INTD);
+        }
+        // <s> was read before we drained, so if DONE was set
+        // then every byte was already in the FIFO.
+        if(s & I2C_S_DONE)
+            txn_finish(t, t->ndone == t->nbytes ? t->nbytes : I2C_ERR_UNDERRUN);
+    }
+
+    dev_barrier();
+    stats.isr_cyc += cycle_cnt_read() - s_cyc;
+}
+
+int i2c_async_has_interrupt(void) {
+    dev_barrier();
+    int p = (GET32(IRQ_pending_2) & I2C_IRQ_BIT) != 0;
+    dev_barrier();
+    return p;
+}
+
+void i2c_async_init(void) {
+    i2c_init();
+    txq = txq_mk();
+    cur = 0;
+    memset(&stats, 0, sizeof stats);
+
+    dev_barrier();
+    PUT32(IRQ_Enable_2, I2C_IRQ_BIT);
+    dev_barrier();
+}
+
+int i2c_async_submit(i2c_txn_t *t) {
+    assert(t->data || !t->nbytes);
+    t->status = I2C_TXN_PENDING;
+    t->ndone = 0;
+
+    uint32_t cpsr = cpsr_int_disable();
+    if(!txq_push(&txq, t)) {
+        stats.q_full++;
+        cpsr_int_reset(cpsr);
+        return 0;
+    }
+    stats.submitted++;
+
+    unsigned n = txq_cnt(&txq);
+    if(n > stats.q_hiwater)
+        stats.q_hiwater = n;
+    // bus is idle: the handler won't run, so we have to kick it.
+    if(!cur)
+        txn_next();
+    cpsr_int_reset(cpsr);
+    return 1;
+}
+
+int i2c_async_wait(i2c_txn_t *t) {
+    while(t->status == I2C_TXN_PENDING)
+        rpi_wait();
+    return t->status;
+}
+
+int i2c_async_busy(void) {
+    return cur != 0 || !txq_empty(&txq);
+}
+
+i2c_async_stats_t i2c_async_stats(void) {
+    return stats;
+}
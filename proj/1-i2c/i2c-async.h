@@ -0,0 +1,92 @@
+#ifndef __RPI_I2C_ASYNC_H__
+#define __RPI_I2C_ASYNC_H__
+// interrupt-driven BSC1 transfer engine.
+//
+// callers fill in an <i2c_txn_t> and submit it: the engine queues it
+// in a lock-free circular queue (<circular-T.h>) and the BSC
+// interrupt handler moves the bytes, so the cpu is free while the
+// bus runs.  when a transfer finishes the engine calls <done>
+// (from interrupt context!) and starts the next queued one.  a
+// transfer that fails (NACK, clock stretch timeout) is let finish its
+// STOP first, and a bus left stuck is recovered, as in the polled
+// driver.
+//
+// usage:
+//   - install interrupts (<interrupt_init>) and call
+//     <i2c_async_int_handler> from your <interrupt_vector>
+//     when <i2c_async_has_interrupt> is true.
+//   - <i2c_async_init>, then <enable_interrupts>.
+//
+// do not mix with the polled <i2c_read>/<i2c_write> while
+// transactions are in flight: they share the same registers.
+#include "i2c.h"
+
+// BSC0/1/2 share a single interrupt line: i2c_int = IRQ 53
+// (bcm2835 p113), which is bit 21 of <IRQ_pending_2>.
+#define I2C_IRQ         53
+#define I2C_IRQ_BIT     (1 << (I2C_IRQ - 32))
+
+// number of queue slots: one is always kept empty, so at most
+// <I2C_ASYNC_QN-1> transactions can be waiting.
+#ifndef I2C_ASYNC_QN
+#   define I2C_ASYNC_QN 16
+#endif
+
+// <status> while the transaction is queued or on the bus.
+#define I2C_TXN_PENDING  (-1000)
+
+struct i2c_txn;
+typedef void (*i2c_done_fn_t)(struct i2c_txn *t);
+
+typedef struct i2c_txn {
+    // filled in by the caller.
+    uint8_t addr;               // 7-bit slave address.
+    uint8_t read_p;             // 1 = read, 0 = write.
+    uint8_t *data;
+    unsigned nbytes;
+    i2c_done_fn_t done;         // can be 0.  runs in interrupt context,
+                                // and may i2c_async_submit (e.g., to
+                                // chain the next transfer).
+    void *arg;                  // for the caller: engine does not touch.
+
+    // filled in by the engine: <status> is <nbytes> on success,
+    // < 0 (I2C_ERR_*) on error and <I2C_TXN_PENDING> until then.
+    volatile int status;
+    unsigned ndone;             // bytes moved so far.
+} i2c_txn_t;
+
+// counters so we can see how deep the queue gets and how much
+// cpu the engine actually uses.
+typedef struct {
+    unsigned submitted,
+             completed,
+             errors,
+             q_full,            // submits rejected b/c the queue was full.
+             q_hiwater,         // max transactions waiting at once.
+             nints;             // handler invocations.
+    uint32_t isr_cyc;           // cycles spent in the handler.
+} i2c_async_stats_t;
+
+// reset BSC1, clear the queue and enable the BSC interrupt in the
+// interrupt controller.  does not enable global interrupts.
+void i2c_async_init(void);
+
+// queue <t>.  returns 1 if queued, 0 if the queue is full.  safe
+// from a <done> callback.
+int i2c_async_submit(i2c_txn_t *t);
+
+// spin until <t> completes: returns its status.
+int i2c_async_wait(i2c_txn_t *t);
+
+// 1 if a transaction is on the bus or queued.
+int i2c_async_busy(void);
+
+// 1 if BSC has an interrupt pending.
+int i2c_async_has_interrupt(void);
+
+// call from <interrupt_vector>.
+void i2c_async_int_handler(void);
+
+i2c_async_stats_t i2c_async_stats(void);
+
+#endif
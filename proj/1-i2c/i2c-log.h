@@ -0,0 +1,41 @@
+#ifndef __I2C_LOG_H__
+#define __I2C_LOG_H__
+// compile-time log levels for the i2c and atecc drivers.
+//
+// printk blocks on the UART: at 115200 baud a character is ~87usec,
+// so a hex dump of one command packet costs more than the chip takes
+// to run it.  each message has a level, and anything above
+// I2C_LOG_LEVEL compiles to nothing (the arguments are still type
+// checked, never evaluated).
+//
+//   ERROR  something failed: the caller is about to hear about it.
+//   INFO   once per operation: wakes, keys, signatures.
+//   TRACE  per command and per transfer: packets, waits, NACKed polls.
+//
+// the default is ERROR: no formatting at all on a command's way
+// through.  build with -DI2C_LOG_LEVEL=3 for everything.
+#include "rpi.h"
+
+#define I2C_LOG_NONE    0
+#define I2C_LOG_ERROR   1
+#define I2C_LOG_INFO    2
+#define I2C_LOG_TRACE   3
+
+#ifndef I2C_LOG_LEVEL
+#define I2C_LOG_LEVEL I2C_LOG_ERROR
+#endif
+
+// 1 if messages at <level> are compiled in: for one message built
+// out of several printks (a loop over bytes).
+#define I2C_LOG_ON(level) ((level) <= I2C_LOG_LEVEL)
+
+#define I2C_LOG(level, fmt, args...) do {       \
+    if (I2C_LOG_ON(level))                      \
+        printk(fmt, ##args);                    \
+} while (0)
+
+#define LOG_ERROR(fmt, args...) I2C_LOG(I2C_LOG_ERROR, fmt, ##args)
+#define LOG_INFO(fmt, args...)  I2C_LOG(I2C_LOG_INFO, fmt, ##args)
+#define LOG_TRACE(fmt, args...) I2C_LOG(I2C_LOG_TRACE, fmt, ##args)
+
+#endif
@@ -0,0 +1,60 @@
+// ring buffer and binary dump for <i2c-trace.h>.
+#include "rpi.h"
+#include "i2c-trace.h"
+
+#if I2C_TRACE
+i2c_trace_ev_t i2c_trace_buf[I2C_TRACE_N];
+unsigned i2c_trace_n;
+#endif
+
+void i2c_trace_reset(void) {
+#if I2C_TRACE
+    i2c_trace_n = 0;
+#endif
+}
+
+static void emit16(void (*put8)(void *, uint8_t), void *arg, uint16_t x) {
+    put8(arg, x);
+    put8(arg, x >> 8);
+}
+static void emit32(void (*put8)(void *, uint8_t), void *arg, uint32_t x) {
+    emit16(put8, arg, x);
+    emit16(put8, arg, x >> 16);
+}
+
+unsigned i2c_trace_dump_fn(void (*put8)(void *arg, uint8_t b), void *arg) {
+    unsigned n = 0, first = 0, dropped = 0;
+#if I2C_TRACE
+    n = i2c_trace_n;
+    if(n > I2C_TRACE_N) {
+        dropped = n - I2C_TRACE_N;
+        first = n - I2C_TRACE_N;
+        n = I2C_TRACE_N;
+    }
+#endif
+    emit32(put8, arg, I2C_TRACE_MAGIC);
+    emit32(put8, arg, n);
+    emit32(put8, arg, dropped);
+
+#if I2C_TRACE
+    for(unsigned i = 0; i < n; i++) {
+        i2c_trace_ev_t *e = &i2c_trace_buf[(first + i) & (I2C_TRACE_N - 1)];
+        emit32(put8, arg, e->cyc);
+        emit32(put8, arg, e->usec);
+        put8(arg, e->addr_dir);
+        put8(arg, e->phase);
+        emit16(put8, arg, e->arg);
+    }
+#endif
+    return n;
+}
+
+static void uart_put8_fn(void *arg, uint8_t b) {
+    uart_put8(b);
+}
+
+unsigned i2c_trace_dump(void) {
+    unsigned n = i2c_trace_dump_fn(uart_put8_fn, 0);
+    uart_flush_tx();
+    return n;
+}
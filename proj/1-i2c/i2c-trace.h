@@ -0,0 +1,84 @@
+#ifndef __I2C_TRACE_H__
+#define __I2C_TRACE_H__
+// compile-time i2c transaction tracer.
+//
+// build with -DI2C_TRACE=1 and every polled transfer in i2c.c logs
+// its phase boundaries (cycle counter + usec timer, device address,
+// direction) into a fixed ring buffer.  with I2C_TRACE=0 (default)
+// the hooks compile to nothing.
+//
+// <i2c_trace_dump> sends the buffer as a binary stream: the unix
+// side (libunix <i2c_trace_decode>, proj/1-i2c/trace) turns it into
+// per-phase latency histograms.  wire format, all little-endian:
+//
+//   header:  u32 I2C_TRACE_MAGIC, u32 nrecords, u32 ndropped
+//   record:  u32 cycles, u32 usec, u8 addr | dir<<7, u8 phase,
+//            u16 arg (byte count, or -error for I2C_PH_ERR)
+//
+// the dump does not say how fast the cycle counter runs: the decoder
+// is told (i2c_trace_decode's <cyc_per_usec>).
+#include "rpi.h"
+
+#ifndef I2C_TRACE
+#define I2C_TRACE 0
+#endif
+
+// log2 of the number of records kept.
+#ifndef I2C_TRACE_LOG2N
+#define I2C_TRACE_LOG2N 8
+#endif
+#define I2C_TRACE_N (1 << I2C_TRACE_LOG2N)
+
+// "I2CT"
+#define I2C_TRACE_MAGIC 0x54433249
+
+// phase boundaries, in the order a transfer hits them.
+enum {
+    I2C_PH_BEGIN = 1,   // call entered.
+    I2C_PH_START,       // registers set, FIFO primed, ST written.
+    I2C_PH_LAST,        // last byte into (write) or out of (read) the FIFO.
+    I2C_PH_DONE,        // DONE seen.
+    I2C_PH_ERR,         // failed: <arg> is -error.
+};
+
+typedef struct {
+    uint32_t cyc;
+    uint32_t usec;
+    uint8_t addr_dir;
+    uint8_t phase;
+    uint16_t arg;
+} i2c_trace_ev_t;
+
+#if I2C_TRACE
+#include "cycle-count.h"
+
+extern i2c_trace_ev_t i2c_trace_buf[I2C_TRACE_N];
+extern unsigned i2c_trace_n;
+
+// cheap enough to leave in the transfer path: two counter reads
+// and a store.
+static inline void i2c_trace(unsigned addr, unsigned read_p, unsigned phase, unsigned arg) {
+    i2c_trace_ev_t *e = &i2c_trace_buf[i2c_trace_n++ & (I2C_TRACE_N - 1)];
+    e->cyc = cycle_cnt_read();
+    e->usec = timer_get_usec_raw();
+    e->addr_dir = (addr & 0x7f) | (read_p << 7);
+    e->phase = phase;
+    e->arg = arg;
+}
+#define I2C_TRACE_EV(addr, read_p, phase, arg) \
+    i2c_trace(addr, read_p, phase, arg)
+#else
+#define I2C_TRACE_EV(addr, read_p, phase, arg) do { } while(0)
+#endif
+
+// forget everything recorded so far.
+void i2c_trace_reset(void);
+
+// send the buffer (oldest record first) one byte at a time through
+// <put8>.  returns the number of records sent.
+unsigned i2c_trace_dump_fn(void (*put8)(void *arg, uint8_t b), void *arg);
+
+// same, over the uart.
+unsigned i2c_trace_dump(void);
+
+#endif
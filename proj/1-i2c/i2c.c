@@ -1,4 +1,11 @@
 #include "i2c.h"
+#include "mbox.h"
+#include "timeout.h"
+#include "i2c-trace.h"
+#include "i2c-log.h"
+
+// bus speed i2c_init() programs: changed by i2c_set_speed().
+static unsigned i2c_hz = I2C_STANDARD;
 
 void i2c_init(void) {
     // Configure GPIO pins for I2C function
@@ -17,19 +24,299 @@ void i2c_init(void) {
     PUT32(I2C_S, I2C_S_CLKT | I2C_S_ERR | I2C_S_DONE);
     dev_barrier();
     
-    // Set clock divider for 100kHz (assuming 150MHz core clock)
-    PUT32(I2C_DIV, 1500);
-    dev_barrier();
+    // Set clock divider for the current speed (100kHz by default)
+    i2c_set_speed(i2c_hz);
     
     // Enable I2C
     PUT32(I2C_C, I2C_C_I2CEN);
     dev_barrier();
     
-    printk("I2C initialized\n");
+    // a slave left mid-byte by a reset can still be holding SDA.
+    if (i2c_bus_stuck())
+        i2c_bus_recover();
+
+    LOG_INFO("I2C initialized\n");
 }
 
-int i2c_write(unsigned addr, uint8_t data[], unsigned nbytes) {
+// the BSC ignores DIV bit 0; round up so we never run faster than
+// asked for.
+unsigned i2c_clk_div(unsigned core_hz, unsigned hz) {
+    unsigned div = (core_hz + hz - 1) / hz;
+    div = (div + 1) & ~1;
+    if (div < 2)
+        div = 2;
+    if (div > 0xfffe)
+        div = 0xfffe;
+    return div;
+}
+
+// the core clock is not fixed (config.txt, turbo), so ask for it.
+static unsigned i2c_core_hz(void) {
+    static unsigned core_hz;
+    if (!core_hz) {
+        core_hz = mbox_get_clock_rate(MBOX_CLK_CORE);
+        if (!core_hz) {
+            LOG_ERROR("I2C: could not read core clock, assuming 250MHz\n");
+            core_hz = 250 * 1000 * 1000;
+        }
+    }
+    return core_hz;
+}
+
+unsigned i2c_set_speed(unsigned hz) {
+    unsigned core_hz = i2c_core_hz();
+    unsigned div = i2c_clk_div(core_hz, hz);
+
+    PUT32(I2C_DIV, div);
+    // sample/launch delays scale with the clock: the 0x30 reset
+    // value is too long past 400kHz.
+    unsigned fedl = div / 16, redl = div / 4;
+    if (!fedl)
+        fedl = 1;
+    if (!redl)
+        redl = 1;
+    PUT32(I2C_DEL, (fedl << 16) | redl);
+    dev_barrier();
+
+    i2c_hz = hz;
+    return core_hz / div;
+}
+
+unsigned i2c_get_speed(void) {
+    // CDIV=0 means 32768 (p34).
+    unsigned div = GET32(I2C_DIV) & 0xfffe;
+    return i2c_core_hz() / (div ? div : 32768);
+}
+
+// a speed has to pass this many checks in a row.
+#define I2C_PROBE_TRIES 3
+
+unsigned i2c_speed_probe(int (*check)(void *arg), void *arg) {
+    static const unsigned profiles[] = { I2C_STANDARD, I2C_FAST, I2C_FAST_PLUS };
+    unsigned best = 0;
+
+    for (unsigned i = 0; i < sizeof profiles / sizeof profiles[0]; i++) {
+        unsigned hz = i2c_set_speed(profiles[i]);
+        int ok = 1;
+        for (unsigned t = 0; t < I2C_PROBE_TRIES && ok; t++)
+            ok = check(arg);
+        if (!ok) {
+            LOG_INFO("I2C: %d hz failed\n", hz);
+            break;
+        }
+        best = profiles[i];
+    }
+
+    // fall back to the last speed that worked.
+    if (!best) {
+        i2c_set_speed(I2C_STANDARD);
+        return 0;
+    }
+    return i2c_set_speed(best);
+}
+
+/***********************************************************
+ * bus recovery.
+ */
+
+static unsigned i2c_nrecover;
+
+// the level registers see the pins whatever their function, so this
+// works with the BSC in charge.  an idle bus has both lines high.
+int i2c_bus_stuck(void) {
+    return !gpio_read(I2C_SDA) || !gpio_read(I2C_SCL);
+}
+
+unsigned i2c_bus_recoveries(void) { return i2c_nrecover; }
+
+// open drain by hand: output latch 0, so "output" pulls the line low
+// and "input" lets the pullup have it.
+static inline void i2c_line_low(unsigned pin) { gpio_set_output(pin); }
+static inline void i2c_line_release(unsigned pin) { gpio_set_input(pin); }
+
+int i2c_bus_recover(void) {
+    i2c_nrecover++;
+    LOG_ERROR("I2C: bus stuck (sda=%d scl=%d), recovering\n",
+        gpio_read(I2C_SDA), gpio_read(I2C_SCL));
+
+    // take the pins away from the BSC.
+    PUT32(I2C_C, 0);
+    dev_barrier();
+    gpio_set_off(I2C_SCL);
+    gpio_set_off(I2C_SDA);
+    i2c_line_release(I2C_SDA);
+    i2c_line_release(I2C_SCL);
+    delay_us(I2C_RECOVER_HALF_USEC);
+
+    // a slave holding SCL is not something clocks can fix.
+    int err = 0;
+    if (!gpio_read(I2C_SCL))
+        err = I2C_ERR_CLKT;
+    else {
+        // clock until whoever has SDA finishes its byte and lets go:
+        // at most 8 data bits and an ACK.
+        for (unsigned i = 0; i < 9 && !gpio_read(I2C_SDA); i++) {
+            i2c_line_low(I2C_SCL);
+            delay_us(I2C_RECOVER_HALF_USEC);
+            i2c_line_release(I2C_SCL);
+            delay_us(I2C_RECOVER_HALF_USEC);
+        }
+
+        // STOP: SDA goes low then high while SCL is high, which
+        // resets every slave's state machine.
+        i2c_line_low(I2C_SCL);
+        delay_us(I2C_RECOVER_HALF_USEC);
+        i2c_line_low(I2C_SDA);
+        delay_us(I2C_RECOVER_HALF_USEC);
+        i2c_line_release(I2C_SCL);
+        delay_us(I2C_RECOVER_HALF_USEC);
+        i2c_line_release(I2C_SDA);
+        delay_us(I2C_RECOVER_HALF_USEC);
+
+        if (!gpio_read(I2C_SDA))
+            err = I2C_ERR_BUSY;
+    }
+
+    // give the pins back and restart the controller.
+    gpio_set_function(I2C_SDA, GPIO_FUNC_ALT0);
+    gpio_set_function(I2C_SCL, GPIO_FUNC_ALT0);
+    PUT32(I2C_S, I2C_S_CLKT | I2C_S_ERR | I2C_S_DONE);
+    PUT32(I2C_C, I2C_C_I2CEN | I2C_C_CLEAR);
+    dev_barrier();
+
+    if (err)
+        LOG_ERROR("I2C: recovery failed: %s\n", i2c_strerror(err));
+    return err;
+}
+
+/***********************************************************
+ * deadlines and errors.
+ */
+
+static unsigned i2c_timeout_us = I2C_TIMEOUT_USEC;
+
+void i2c_set_timeout_usec(unsigned usec) { i2c_timeout_us = usec; }
+unsigned i2c_get_timeout_usec(void) { return i2c_timeout_us; }
+
+typedef struct {
+    timeout_t t;
+    unsigned usec;
+} i2c_deadline_t;
+
+// budget for moving <nbytes>: the fixed timeout plus twice the wire
+// time (9 bits a byte, plus the address) so slow speeds and some
+// clock stretching fit.
+static i2c_deadline_t i2c_deadline(unsigned nbytes) {
+    unsigned byte_us = 9 * 1000 * 1000 / i2c_hz + 1;
+    return (i2c_deadline_t) {
+        .t = timeout_start(),
+        .usec = i2c_timeout_us + 2 * (nbytes + 1) * byte_us
+    };
+}
+static inline int i2c_expired(i2c_deadline_t *d) {
+    return timeout_usec(&d->t, d->usec);
+}
+
+// ERR and CLKT as an error code (0 if neither is set).
+static inline int i2c_status_err(uint32_t status) {
+    if (status & I2C_S_CLKT)
+        return I2C_ERR_CLKT;
+    if (status & I2C_S_ERR)
+        return I2C_ERR_NACK;
+    return 0;
+}
+
+const char *i2c_strerror(int err) {
+    switch (err) {
+    case I2C_ERR_NACK:      return "NACK";
+    case I2C_ERR_CLKT:      return "clock stretch timeout";
+    case I2C_ERR_UNDERRUN:  return "FIFO underrun";
+    case I2C_ERR_TIMEOUT:   return "deadline exceeded";
+    case I2C_ERR_BUSY:      return "bus busy";
+    case I2C_ERR_ARG:       return "bad argument";
+    default:                return err >= 0 ? "ok" : "unknown error";
+    }
+}
+
+// an error ends the transfer, but its STOP (and the DONE that comes
+// with it) is still on the way: let it finish so it cannot be taken
+// for the next transfer's, then clear everything.  if the bus stays
+// active (stuck slave), disable the controller to drop the transfer,
+// and if a line is still held low, recover the bus.
+static int i2c_fail(const char *msg, int err, uint32_t status) {
+    I2C_TRACE_EV(GET32(I2C_A), GET32(I2C_C) & I2C_C_READ, I2C_PH_ERR, -err);
+    // a NACK is how a busy ATECC answers an ACK poll: not news.
+    if (err == I2C_ERR_NACK)
+        LOG_TRACE("%s: %s (status=%x)\n", msg, i2c_strerror(err), status);
+    else
+        LOG_ERROR("%s: %s (status=%x)\n", msg, i2c_strerror(err), status);
+
+    timeout_t t = timeout_start();
+    while (GET32(I2C_S) & I2C_S_TA) {
+        if (timeout_usec(&t, I2C_STOP_USEC)) {
+            PUT32(I2C_C, 0);
+            break;
+        }
+    }
+    PUT32(I2C_C, I2C_C_I2CEN | I2C_C_CLEAR);
+    PUT32(I2C_S, I2C_S_CLKT | I2C_S_ERR | I2C_S_DONE);
+    dev_barrier();
+
+    // a slave still holding SDA will fail every transfer from now on:
+    // clear it so only this one is lost.
+    if (i2c_bus_stuck())
+        i2c_bus_recover();
+    return err;
+}
+
+// wait until one of <bits> is set in the status register.  returns
+// the status, or an error (< 0) on ERR/CLKT or when <d> runs out.
+static int i2c_wait(i2c_deadline_t *d, uint32_t bits, const char *msg) {
+    uint32_t status;
+    int err;
+
+    while (!((status = GET32(I2C_S)) & bits)) {
+        if ((err = i2c_status_err(status)))
+            return i2c_fail(msg, err, status);
+        if (i2c_expired(d))
+            return i2c_fail(msg, I2C_ERR_TIMEOUT, status);
+    }
+    if ((err = i2c_status_err(status)))
+        return i2c_fail(msg, err, status);
+    return status;
+}
+
+/***********************************************************
+ * transfers.
+ */
+
+// cursor over a segment list: skips empty segments.
+typedef struct {
+    const i2c_iovec_t *seg;
+    unsigned off;
+} i2c_iov_cursor_t;
+
+static inline uint8_t i2c_iov_next(i2c_iov_cursor_t *c) {
+    while (c->off == c->seg->nbytes) {
+        c->seg++;
+        c->off = 0;
+    }
+    return c->seg->data[c->off++];
+}
+
+int i2c_writev(unsigned addr, const i2c_iovec_t segs[], unsigned n) {
     uint32_t status;
+    unsigned nbytes = 0;
+    int err;
+
+    for (unsigned i = 0; i < n; i++)
+        nbytes += segs[i].nbytes;
+    if (!nbytes)
+        return 0;
+
+    I2C_TRACE_EV(addr, 0, I2C_PH_BEGIN, nbytes);
+    i2c_iov_cursor_t cur = { .seg = segs, .off = 0 };
+    i2c_deadline_t d = i2c_deadline(nbytes);
     
     // Clear FIFO first
     PUT32(I2C_C, GET32(I2C_C) | I2C_C_CLEAR);
@@ -47,55 +334,98 @@ int i2c_write(unsigned addr, uint8_t data[], unsigned nbytes) {
     PUT32(I2C_DLEN, nbytes);
     dev_barrier();
     
-    for (unsigned i = 0; i < nbytes && i < 16; i++) {  // 16 is FIFO size
-        PUT32(I2C_FIFO, data[i]);
+    unsigned bytes_sent = 0;
+    while (bytes_sent < nbytes && bytes_sent < I2C_FIFO_N) {
+        PUT32(I2C_FIFO, i2c_iov_next(&cur));
+        bytes_sent++;
     }
     
     // Start write transfer and set I2C_C_READ bit to 0 (write mode)
     PUT32(I2C_C, (GET32(I2C_C) & ~I2C_C_READ) | I2C_C_ST | I2C_C_I2CEN);
     dev_barrier();
+    I2C_TRACE_EV(addr, 0, I2C_PH_START, nbytes);
     
-    // Wait for transfer to complete or for more FIFO space
-    unsigned bytes_sent = (nbytes < 16) ? nbytes : 16;
-    
-    while (bytes_sent < nbytes || !(GET32(I2C_S) & I2C_S_DONE)) {
+    // Feed the FIFO as it drains
+    while (bytes_sent < nbytes) {
         status = GET32(I2C_S);
         
         // Check for errors
-        if (status & (I2C_S_ERR | I2C_S_CLKT)) {
-            printk("I2C error during write: %x\n", status);
-            return -1;
-        }
+        if ((err = i2c_status_err(status)))
+            return i2c_fail("I2C error during write", err, status);
+        // finished with bytes we never sent.
+        if (status & I2C_S_DONE)
+            return i2c_fail("I2C error during write", I2C_ERR_UNDERRUN, status);
+        if (i2c_expired(&d))
+            return i2c_fail("I2C error during write", I2C_ERR_TIMEOUT, status);
         
         // If FIFO can accept more data and we have more to send
-        if ((status & I2C_S_TXD) && bytes_sent < nbytes) {
-            PUT32(I2C_FIFO, data[bytes_sent++]);
+        if (status & I2C_S_TXD) {
+            PUT32(I2C_FIFO, i2c_iov_next(&cur));
+            bytes_sent++;
         }
     }
     
+    I2C_TRACE_EV(addr, 0, I2C_PH_LAST, nbytes);
+    
     // Wait for DONE flag
-    while (!(GET32(I2C_S) & I2C_S_DONE)) {
-    }
+    if ((err = i2c_wait(&d, I2C_S_DONE, "I2C error after write")) < 0)
+        return err;
+    I2C_TRACE_EV(addr, 0, I2C_PH_DONE, nbytes);
     
-    // Check for success
-    status = GET32(I2C_S);
-    if (status & (I2C_S_ERR | I2C_S_CLKT)) {
-        printk("I2C error after write: %x\n", status);
-        return -1;
+    return nbytes;
+}
+
+int i2c_write(unsigned addr, uint8_t data[], unsigned nbytes) {
+    i2c_iovec_t seg = { .data = data, .nbytes = nbytes };
+    return i2c_writev(addr, &seg, 1);
+}
+
+// drain <nbytes> from the FIFO of a read that is already running
+// into <segs> and wait for it to finish.
+static int i2c_read_fifo(i2c_deadline_t *d, unsigned addr, const i2c_rvec_t segs[], unsigned nbytes) {
+    int status;
+    unsigned s = 0, off = 0;
+
+    // Read data from FIFO
+    for (unsigned i = 0; i < nbytes; i++) {
+        // Wait for data (or the end of a short transfer)
+        if ((status = i2c_wait(d, I2C_S_RXD | I2C_S_DONE, "I2C error during read")) < 0)
+            return status;
+        if (!(status & I2C_S_RXD))
+            return i2c_fail("I2C error during read", I2C_ERR_UNDERRUN, status);
+        
+        while (off == segs[s].nbytes) {
+            s++;
+            off = 0;
+        }
+        segs[s].data[off++] = GET32(I2C_FIFO) & 0xFF;
     }
+    I2C_TRACE_EV(addr, 1, I2C_PH_LAST, nbytes);
+    
+    // Wait for transfer to complete
+    if ((status = i2c_wait(d, I2C_S_DONE, "I2C error after read")) < 0)
+        return status;
+    I2C_TRACE_EV(addr, 1, I2C_PH_DONE, nbytes);
     
     return nbytes;
 }
 
-int i2c_read(unsigned addr, uint8_t data[], unsigned nbytes) {
+int i2c_readv(unsigned addr, const i2c_rvec_t segs[], unsigned n) {
     uint32_t status;
+    unsigned nbytes = 0;
+
+    for (unsigned i = 0; i < n; i++)
+        nbytes += segs[i].nbytes;
     
     // Check if the bus is active
     status = GET32(I2C_S);
     if (status & I2C_S_TA) {
-        printk("I2C bus is still active\n");
-        return -1;
+        LOG_ERROR("I2C bus is still active\n");
+        return I2C_ERR_BUSY;
     }
+
+    I2C_TRACE_EV(addr, 1, I2C_PH_BEGIN, nbytes);
+    i2c_deadline_t d = i2c_deadline(nbytes);
     
     // Clear FIFO
     PUT32(I2C_C, GET32(I2C_C) | I2C_C_CLEAR);
@@ -116,43 +446,111 @@ int i2c_read(unsigned addr, uint8_t data[], unsigned nbytes) {
     // Start read transfer
     PUT32(I2C_C, GET32(I2C_C) | I2C_C_ST | I2C_C_READ);
     dev_barrier();
+    I2C_TRACE_EV(addr, 1, I2C_PH_START, nbytes);
     
-    // Read data from FIFO
-    for (unsigned i = 0; i < nbytes; i++) {
-        // printk("Reading data: %d\n", i);
-        // Wait for data
-        while (!(GET32(I2C_S) & I2C_S_RXD)) {
-            status = GET32(I2C_S);
-            // printk("Status: %x\n", status);
-            if (status & (I2C_S_ERR | I2C_S_CLKT)) {
-                printk("I2C error during read: %x\n", status);
-                return -1;
-            }
-        }
-        
-        data[i] = GET32(I2C_FIFO) & 0xFF;
-        // printk("Read data: %x\n", data[i]);
+    return i2c_read_fifo(&d, addr, segs, nbytes);
+}
+
+int i2c_read(unsigned addr, uint8_t data[], unsigned nbytes) {
+    i2c_rvec_t seg = { .data = data, .nbytes = nbytes };
+    return i2c_readv(addr, &seg, 1);
+}
+
+// write to <waddr> then read from <raddr> without a STOP in between.
+//
+// the BSC has no explicit repeated-start bit, but it latches A and
+// DLEN when a transfer starts.  so: fill the FIFO with the write,
+// start it, wait until TA says it is on the bus, then program the
+// read and set ST again.  when the write's last byte is acked the
+// controller issues a repeated START for the read instead of a STOP.
+// the whole write has to be in the FIFO before we switch, so it is
+// limited to <I2C_FIFO_N> bytes.
+static int i2c_write_read_rs(unsigned waddr, const uint8_t wdata[], unsigned wn,
+                             unsigned raddr, uint8_t rdata[], unsigned rn) {
+    int status;
+
+    if (wn > I2C_FIFO_N) {
+        LOG_ERROR("I2C write-read: write of %d bytes does not fit in FIFO\n", wn);
+        return I2C_ERR_ARG;
     }
-    
-    // Wait for transfer to complete
-    while (1) {
-        status = GET32(I2C_S);
-        if (status & I2C_S_DONE)
-            break;
-        
-        if (status & (I2C_S_ERR | I2C_S_CLKT)) {
-            printk("I2C error waiting for completion: %x\n", status);
-            return -1;
+
+    I2C_TRACE_EV(waddr, 0, I2C_PH_BEGIN, wn);
+    i2c_deadline_t d = i2c_deadline(wn + rn);
+
+    // Clear FIFO and status flags
+    PUT32(I2C_C, I2C_C_I2CEN | I2C_C_CLEAR);
+    PUT32(I2C_S, I2C_S_CLKT | I2C_S_ERR | I2C_S_DONE);
+    PUT32(I2C_A, waddr);
+    PUT32(I2C_DLEN, wn);
+    for (unsigned i = 0; i < wn; i++)
+        PUT32(I2C_FIFO, wdata[i]);
+
+    // Start the write
+    PUT32(I2C_C, I2C_C_I2CEN | I2C_C_ST);
+    dev_barrier();
+    I2C_TRACE_EV(waddr, 0, I2C_PH_START, wn);
+
+    // Wait for the write to be on the bus.
+    if ((status = i2c_wait(&d, I2C_S_TA | I2C_S_DONE, "I2C error during write-read")) < 0)
+        return status;
+    // already finished (with a STOP): too late to chain, do a
+    // normal read.
+    if (!(status & I2C_S_TA))
+        return i2c_read(raddr, rdata, rn);
+
+    // Queue the read: starts with a repeated START when the write ends.
+    PUT32(I2C_A, raddr);
+    PUT32(I2C_DLEN, rn);
+    PUT32(I2C_C, I2C_C_I2CEN | I2C_C_ST | I2C_C_READ);
+    dev_barrier();
+    I2C_TRACE_EV(raddr, 1, I2C_PH_START, rn);
+
+    // the FIFO is shared: RXD is also set by write bytes that have
+    // not gone out yet, so wait for it to drain before reading.
+    if ((status = i2c_wait(&d, I2C_S_TXE, "I2C error during write-read")) < 0)
+        return status;
+
+    i2c_rvec_t seg = { .data = rdata, .nbytes = rn };
+    return i2c_read_fifo(&d, raddr, &seg, rn);
+}
+
+int i2c_write_read(unsigned addr, const uint8_t wdata[], unsigned wn,
+                   uint8_t rdata[], unsigned rn) {
+    if (!rn)
+        return i2c_write(addr, (uint8_t *) wdata, wn);
+    if (!wn)
+        return i2c_read(addr, rdata, rn);
+    return i2c_write_read_rs(addr, wdata, wn, addr, rdata, rn);
+}
+
+int i2c_transfer(const i2c_msg_t msgs[], unsigned n) {
+    int total = 0;
+
+    for (unsigned i = 0; i < n; i++) {
+        const i2c_msg_t *m = &msgs[i];
+        const i2c_msg_t *next = (i + 1 < n) ? &msgs[i + 1] : 0;
+        int ret;
+
+        if (!m->read_p && next && next->read_p && m->nbytes
+        && m->nbytes <= I2C_FIFO_N && next->nbytes) {
+            ret = i2c_write_read_rs(m->addr, m->data, m->nbytes,
+                                    next->addr, next->data, next->nbytes);
+            if (ret < 0)
+                return ret;
+            total += m->nbytes + ret;
+            i++;
+            continue;
         }
+
+        if (m->read_p)
+            ret = i2c_read(m->addr, m->data, m->nbytes);
+        else
+            ret = i2c_write(m->addr, m->data, m->nbytes);
+        if (ret < 0)
+            return ret;
+        total += ret;
     }
-    
-    // Check for success
-    if (status & (I2C_S_ERR | I2C_S_CLKT)) {
-        printk("I2C error after read: %x\n", status);
-        return -1;
-    }
-    
-    return nbytes;
+    return total;
 }
 
 void i2c_init_clk_div(unsigned clk_div) {
@@ -172,7 +570,7 @@ void i2c_init_clk_div(unsigned clk_div) {
     PUT32(I2C_C, I2C_C_I2CEN);
     dev_barrier();
     
-    printk("I2C initialized with clock divider: %u\n", clk_div);
+    LOG_INFO("I2C initialized with clock divider: %u\n", clk_div);
 }
 
 // Track if I2C has been initialized
@@ -42,16 +42,121 @@
 #define I2C_S_DONE     (1 << 1)   // Transfer done
 #define I2C_S_TA       (1 << 0)   // Transfer active
 
+// standard bus speeds (hz).
+#define I2C_STANDARD   (100 * 1000)
+#define I2C_FAST       (400 * 1000)
+#define I2C_FAST_PLUS  (1000 * 1000)
+
+// errors: every call returns one of these (< 0) on failure.  NACK
+// stays -1, which is what callers have always checked for.
+enum {
+    I2C_ERR_NACK     = -1,  // no ACK for the address or a byte (S.ERR)
+    I2C_ERR_CLKT     = -2,  // slave stretched the clock too long (S.CLKT)
+    I2C_ERR_UNDERRUN = -3,  // transfer ended before all bytes moved
+    I2C_ERR_TIMEOUT  = -4,  // deadline passed
+    I2C_ERR_BUSY     = -5,  // a transfer was still active
+    I2C_ERR_ARG      = -6,
+};
+const char *i2c_strerror(int err);
+
+// fixed part of each transfer's deadline; the wire time for its
+// bytes at the current speed is added on top.
+#define I2C_TIMEOUT_USEC 10000
+// how long a failed transfer gets to put out its STOP.
+#define I2C_STOP_USEC    1000
+
+void i2c_set_timeout_usec(unsigned usec);
+unsigned i2c_get_timeout_usec(void);
+
+// 1 if SDA or SCL is low while nothing should be driving it (e.g., a
+// slave was mid-byte when we reset or aborted a transfer).
+int i2c_bus_stuck(void);
+
+// unstick the bus by hand: with the pins as GPIOs, clock SCL (up to 9
+// times) until SDA is released, send a STOP, then hand the pins back
+// to the BSC.  i2c_init() and every failed transfer do this when
+// i2c_bus_stuck(), so callers only need it to force a reset.
+// returns 0, I2C_ERR_CLKT (SCL held low) or I2C_ERR_BUSY (SDA still
+// low).
+int i2c_bus_recover(void);
+// how many times the bus has been recovered.
+unsigned i2c_bus_recoveries(void);
+
+// half an SCL period while recovering (100kHz).
+#define I2C_RECOVER_HALF_USEC 5
+
+// BSC FIFO depth (bytes)
+#define I2C_FIFO_N     16
+
 void i2c_init(void);
 
 // write <nbytes> of <datea> to i2c device address <addr>
+// every transfer is bounded by a deadline: returns <nbytes> or < 0
+// (I2C_ERR_*), never hangs.
 int i2c_write(unsigned addr, uint8_t data[], unsigned nbytes);
+// one piece of a gathered write.
+typedef struct {
+    const uint8_t *data;
+    unsigned nbytes;
+} i2c_iovec_t;
+
+// write the <n> segments in <segs> back to back as one transfer:
+// the FIFO is fed straight from each segment, nothing is copied.
+// returns the total bytes written or < 0 (I2C_ERR_*).
+int i2c_writev(unsigned addr, const i2c_iovec_t segs[], unsigned n);
+
 // read <nbytes> of <datea> from i2c device address <addr>
 int i2c_read(unsigned addr, uint8_t data[], unsigned nbytes);
 
+// one piece of a scattered read.
+typedef struct {
+    uint8_t *data;
+    unsigned nbytes;
+} i2c_rvec_t;
+
+// read into the <n> segments in <segs> as one transfer: the FIFO is
+// drained straight into each segment.  returns the total bytes read
+// or < 0 (I2C_ERR_*).
+int i2c_readv(unsigned addr, const i2c_rvec_t segs[], unsigned n);
+
+// write <wn> bytes of <wdata> then read <rn> bytes into <rdata> with a
+// repeated START (no STOP) in between.  <wn> must fit in the FIFO.
+// returns <rn> on success, < 0 on error.
+int i2c_write_read(unsigned addr, const uint8_t wdata[], unsigned wn,
+                   uint8_t rdata[], unsigned rn);
+
+// one segment of a combined transfer.
+typedef struct {
+    uint8_t addr;
+    uint8_t read_p;     // 1 = read, 0 = write.
+    uint8_t *data;
+    unsigned nbytes;
+} i2c_msg_t;
+
+// run <n> messages back to back.  a write (<= I2C_FIFO_N bytes)
+// followed by a read is joined with a repeated START; every other
+// boundary is a STOP/START.  returns total bytes moved or < 0.
+int i2c_transfer(const i2c_msg_t msgs[], unsigned n);
+
 
 void i2c_init_clk_div(unsigned clk_div);
 
+// divider for a <hz> bus from a <core_hz> core clock (rounded so the
+// bus is never faster than asked).
+unsigned i2c_clk_div(unsigned core_hz, unsigned hz);
+
+// run the bus at <hz> (I2C_STANDARD, I2C_FAST, I2C_FAST_PLUS), using
+// the core clock from the mailbox.  sticks across i2c_init().
+// returns the actual speed.
+unsigned i2c_set_speed(unsigned hz);
+unsigned i2c_get_speed(void);
+
+// step up through the speeds while <check(arg)> keeps returning 1
+// (e.g., a device command with a good CRC and no NACKs), then fall
+// back to the last one that worked.  returns the speed picked, or 0
+// if even 100kHz failed (the bus is left at 100kHz).
+unsigned i2c_speed_probe(int (*check)(void *arg), void *arg);
+
 // can call N times, will only initialize once (the first time)
 void i2c_init_once(void);
 
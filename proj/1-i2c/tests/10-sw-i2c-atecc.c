@@ -0,0 +1,53 @@
+#include "rpi.h"
+#include "sw-i2c.h"
+#include "atecc608a.h"
+
+// a second ATECC608A on its own bit-banged bus: SCL/SDA on any two
+// free pins, with 4.7k pullups to 3.3V.
+enum { SW_SCL = 20, SW_SDA = 21 };
+
+void notmain(void) {
+    uart_init();
+    printk("ATECC608A on a bit-banged bus (scl=%d, sda=%d)\n", SW_SCL, SW_SDA);
+
+    sw_i2c_t h = sw_i2c_init(SW_SCL, SW_SDA, 100 * 1000);
+
+    // wake: hold SDA low for tWLO, then tWHI before talking.
+    gpio_set_output(SW_SDA);
+    delay_us(80);
+    gpio_set_input(SW_SDA);
+    delay_us(150);
+
+    uint8_t wake[4];
+    int r = sw_i2c_read(&h, ATECC608A_ADDR, wake, sizeof wake);
+    if(r != sizeof wake)
+        panic("wake read failed: %d\n", r);
+    printk("wake response: %x %x %x %x\n", wake[0], wake[1], wake[2], wake[3]);
+
+    // INFO (revision) command, CRC precomputed.
+    uint8_t info[] = { 0x03, 0x07, ATECC_CMD_INFO, 0x00, 0x00, 0x00, 0x03, 0x5d };
+    if((r = sw_i2c_write(&h, ATECC608A_ADDR, info, sizeof info)) != sizeof info)
+        panic("INFO write failed: %d\n", r);
+    delay_ms(2);
+
+    uint8_t resp[7], reset_addr = 0x00;
+    unsigned s = timer_get_usec();
+    r = sw_i2c_write_read(&h, ATECC608A_ADDR, &reset_addr, 1, resp, sizeof resp);
+    unsigned t = timer_get_usec() - s;
+    if(r != sizeof resp)
+        panic("INFO read failed: %d\n", r);
+
+    printk("Revision (%d usec to read): ", t);
+    for(int i = 0; i < sizeof resp; i++)
+        printk("%x ", resp[i]);
+    printk("\n");
+
+    uint16_t crc = calculate_crc16(sizeof resp - 2, resp);
+    if(resp[5] != (crc & 0xff) || resp[6] != (crc >> 8))
+        panic("bad response CRC\n");
+
+    uint8_t sleep_cmd = 0x01;
+    sw_i2c_write(&h, ATECC608A_ADDR, &sleep_cmd, 1);
+    printk("SUCCESS: INFO over the bit-banged bus\n");
+    clean_reboot();
+}
@@ -0,0 +1,54 @@
+#include "rpi.h"
+#include "cycle-count.h"
+#include "atecc608a.h"
+
+// the framing CRC over a VERIFY packet: count, opcode, p1, p2 and
+// 128 bytes of signature + public key.
+enum { NPKT = 5 + 128 };
+
+static uint8_t pkt[NPKT];
+
+static void cross_check(void) {
+    // every length from 0 up, continued from a few starting values.
+    uint16_t start[] = { 0, 0x1234, 0xffff };
+    for(unsigned s = 0; s < sizeof start / sizeof start[0]; s++)
+        for(unsigned n = 0; n <= NPKT; n++) {
+            uint16_t a = atecc_crc16_update(start[s], pkt, n);
+            uint16_t b = atecc_crc16_update_bitwise(start[s], pkt, n);
+            if(a != b)
+                panic("crc mismatch: start=%x n=%d: table=%x bitwise=%x\n",
+                    start[s], n, a, b);
+        }
+
+    // INFO command: 07 30 00 00 00 -> 03 5d.
+    uint8_t info[] = { 0x07, ATECC_CMD_INFO, 0x00, 0x00, 0x00 };
+    if(calculate_crc16(sizeof info, info) != 0x5d03)
+        panic("INFO crc wrong: %x\n", calculate_crc16(sizeof info, info));
+}
+
+void notmain(void) {
+    uart_init();
+    caches_enable();
+    cycle_cnt_init();
+
+    for(unsigned i = 0; i < NPKT; i++)
+        pkt[i] = i * 37 + 11;
+    cross_check();
+    printk("table crc matches the bitwise one\n");
+
+    volatile uint16_t crc;
+    // warm the caches (and the table) first.
+    crc = atecc_crc16_update(0, pkt, NPKT);
+    crc = atecc_crc16_update_bitwise(0, pkt, NPKT);
+
+    unsigned bit = TIME_CYC(crc = atecc_crc16_update_bitwise(0, pkt, NPKT));
+    unsigned tab = TIME_CYC(crc = atecc_crc16_update(0, pkt, NPKT));
+    printk("%d-byte VERIFY packet: bitwise %d cycles, table %d cycles (%dx)\n",
+        NPKT, bit, tab, bit / tab);
+    (void)crc;
+
+    if(tab * 4 > bit)
+        panic("table version should be far faster\n");
+    printk("SUCCESS: crc %d cycles per VERIFY packet, was %d\n", tab, bit);
+    clean_reboot();
+}
@@ -0,0 +1,44 @@
+// cycles per ATECC operation at the driver's log level.  run it as
+// built (errors only), then again with
+//     CFLAGS_EXTRA += -DI2C_LOG_LEVEL=3
+// in the Makefile: the difference is what printing costs per command.
+#include "rpi.h"
+#include "cycle-count.h"
+#include "i2c-log.h"
+#include "atecc608a.h"
+
+enum { NOPS = 8 };
+
+void notmain(void) {
+    uart_init();
+    caches_enable();
+    cycle_cnt_init();
+    i2c_init();
+
+    uint8_t digest[32], sig[64], r[32];
+    for(unsigned j = 0; j < 32; j++)
+        digest[j] = j;
+
+    // the first of each learns the chip's exec times: not timed.
+    if(atecc608a_random(r) < 0 || atecc608a_sign(0, digest, sig) < 0)
+        panic("ATECC608A not answering\n");
+
+    unsigned rand_cyc = 0, sign_cyc = 0;
+    for(unsigned i = 0; i < NOPS; i++) {
+        digest[0] = i;
+        unsigned s = cycle_cnt_read();
+        if(atecc608a_random(r) < 0)
+            panic("random %d failed\n", i);
+        unsigned m = cycle_cnt_read();
+        if(atecc608a_sign(0, digest, sig) < 0)
+            panic("sign %d failed\n", i);
+        unsigned e = cycle_cnt_read();
+        rand_cyc += m - s;
+        sign_cyc += e - m;
+    }
+
+    printk("log level %d, per operation:\n", I2C_LOG_LEVEL);
+    printk("  random: %d cycles (%d usec)\n", rand_cyc / NOPS, rand_cyc / NOPS / 700);
+    printk("  sign:   %d cycles (%d usec)\n", sign_cyc / NOPS, sign_cyc / NOPS / 700);
+    printk("SUCCESS: timed %d randoms and %d signs\n", NOPS, NOPS);
+}
@@ -0,0 +1,51 @@
+#include "rpi.h"
+#include "cycle-count.h"
+#include "sha256.h"
+#include "atecc608a.h"
+
+// cycles per byte for SHA-256 in software (aligned and not) and on
+// the chip's SHA engine over the bus, by message length: the numbers
+// behind ATECC_SHA_SW_MIN.
+enum { NMAX = 1024 };
+
+static uint32_t buf[NMAX / 4 + 1];
+
+static unsigned chip_sha(const uint8_t *m, unsigned n, uint8_t d[32]) {
+    atecc_sha256_t h;
+    if(atecc_sha256_init(&h) != 0)
+        panic("SHA start failed\n");
+    atecc_sha256_update(&h, m, n);
+    return atecc_sha256_final(&h, d);
+}
+
+void notmain(void) {
+    uart_init();
+    caches_enable();
+    cycle_cnt_init();
+
+    uint8_t *m = (uint8_t *)buf;
+    for(unsigned i = 0; i < sizeof buf; i++)
+        m[i] = i * 29 + 3;
+
+    if(atecc_session_begin() < 0)
+        panic("ATECC608A did not wake\n");
+
+    static const unsigned lens[] = { 64, 256, 1024 };
+    uint8_t d_sw[32], d_chip[32];
+    for(unsigned i = 0; i < sizeof lens / sizeof lens[0]; i++) {
+        unsigned n = lens[i];
+        sha256(m, n, d_sw);     // warm the i-cache.
+        unsigned al = TIME_CYC(sha256(m, n, d_sw));
+        unsigned un = TIME_CYC(sha256(m + 1, n, d_sw));
+        sha256(m, n, d_sw);
+        unsigned ch = TIME_CYC(chip_sha(m, n, d_chip));
+        if(memcmp(d_sw, d_chip, 32) != 0)
+            panic("%d bytes: software and chip digests differ\n", n);
+        printk("%d bytes: software %d cyc/byte aligned, %d unaligned; chip %d cyc/byte\n",
+            n, al / n, un / n, ch / n);
+    }
+    atecc_session_end(0);
+
+    printk("SUCCESS: software sha256 agrees with the chip\n");
+    clean_reboot();
+}
@@ -0,0 +1,46 @@
+#include "rpi.h"
+#include "cycle-count.h"
+#include "p256.h"
+#include "atecc608a.h"
+#include "p256-vectors.h"
+
+// cycles per P-256 verify in software (libpi p256.c) against the
+// chip's NONCE + VERIFY, on the generated vectors: the numbers behind
+// atecc608a_verify defaulting to software.
+enum { NVEC = sizeof p256_vectors / sizeof p256_vectors[0] };
+
+void notmain(void) {
+    uart_init();
+    caches_enable();
+    cycle_cnt_init();
+    kmalloc_init(1);
+
+    // every vector, for correctness, on the pi's compiler and flags.
+    unsigned sw_total = 0, nok = 0;
+    for(unsigned i = 0; i < NVEC; i++) {
+        const p256_vector_t *v = &p256_vectors[i];
+        int ok;
+        sw_total += TIME_CYC(ok = p256_verify(v->pubkey, v->digest, v->sig));
+        if(ok != v->ok)
+            panic("vector <%s>: got %d, expected %d\n", v->name, ok, v->ok);
+        nok += ok;
+    }
+    printk("software: %d vectors (%d valid), %d cycles per verify on average\n",
+        NVEC, nok, sw_total / NVEC);
+
+    // one valid signature, warm.
+    const p256_vector_t *v = &p256_vectors[0];
+    p256_verify(v->pubkey, v->digest, v->sig);
+    unsigned sw = TIME_CYC(p256_verify(v->pubkey, v->digest, v->sig));
+
+    int ret;
+    unsigned chip = TIME_CYC(ret = atecc608a_verify_chip(v->digest, v->sig, v->pubkey));
+    if(ret != 0)
+        panic("chip rejected a vector that verifies in software: %d\n", ret);
+
+    printk("verify: software %d cycles (%d usec), chip %d cycles (%d usec)\n",
+        sw, sw / 700, chip, chip / 700);
+    printk("SUCCESS: software p256 verify agrees with the chip, %dx its speed\n",
+        chip / sw);
+    clean_reboot();
+}
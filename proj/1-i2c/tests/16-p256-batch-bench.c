@@ -0,0 +1,83 @@
+#include "rpi.h"
+#include "cycle-count.h"
+#include "p256.h"
+#include "fast-hash32.h"
+#include "p256-vectors.h"
+
+// verifies per second by batch size with p256_verify_batch, against
+// p256_verify one at a time, on good signatures from four keys.  the
+// checksum over a batch with forged items in it must match the one
+// fake/p256-batch-test prints.
+enum { NVEC = sizeof p256_vectors / sizeof p256_vectors[0], NI = 256 };
+
+static p256_batch_item_t items[NI];
+static uint8_t ok[NI], forged[4][64];
+
+static unsigned per_sec(unsigned n, unsigned cyc) {
+    return n * 700 * 1000 / (cyc / 1000);
+}
+
+void notmain(void) {
+    uart_init();
+    caches_enable();
+    cycle_cnt_init();
+    kmalloc_init(1);
+
+    // the valid vectors of the first four keys, as the fake test picks them.
+    const p256_vector_t *good[NVEC];
+    const uint8_t *keys[4];
+    unsigned ngood = 0, nk = 0;
+    for(unsigned i = 0; i < NVEC; i++) {
+        const p256_vector_t *v = &p256_vectors[i];
+        if(!v->ok)
+            continue;
+        unsigned k;
+        for(k = 0; k < nk; k++)
+            if(memcmp(keys[k], v->pubkey, 64) == 0)
+                break;
+        if(k == nk) {
+            if(nk == 4)
+                continue;
+            keys[nk++] = v->pubkey;
+        }
+        good[ngood++] = v;
+    }
+    for(unsigned i = 0; i < NI; i++) {
+        const p256_vector_t *v = good[i % ngood];
+        items[i] = (p256_batch_item_t){ v->pubkey, v->digest, v->sig,
+            p256_verify_recid(v->pubkey, v->digest, v->sig) };
+    }
+
+    static const unsigned bad[] = { 5, 77, 78, 120 };
+    for(unsigned i = 0; i < 4; i++) {
+        memcpy(forged[i], items[bad[i]].sig, 64);
+        forged[i][40] ^= 0x10;
+        items[bad[i]].sig = forged[i];
+    }
+    unsigned nok = p256_verify_batch(items, P256_BATCH_MAX, ok);
+    printk("forged batch: %d of %d verify, checksum %x\n",
+        nok, P256_BATCH_MAX, fast_hash32(ok, P256_BATCH_MAX));
+    for(unsigned i = 0; i < 4; i++)
+        items[bad[i]].sig = good[bad[i] % ngood]->sig;
+
+    unsigned one = TIME_CYC(
+        for(unsigned i = 0; i < NI; i++)
+            p256_verify(items[i].pubkey, items[i].digest, items[i].sig));
+    printk("one at a time: %d verifies/sec (%d cycles each)\n", per_sec(NI, one), one / NI);
+
+    unsigned best = 0;
+    for(unsigned b = 1; b <= P256_BATCH_MAX; b *= 2) {
+        unsigned n = 0;
+        unsigned cyc = TIME_CYC(
+            for(unsigned i = 0; i + b <= NI; i += b)
+                n += p256_verify_batch(items + i, b, ok + i));
+        if(n != NI)
+            panic("batch of %d: %d of %d verified\n", b, n, NI);
+        printk("batch %d: %d verifies/sec (%d cycles each)\n", b, per_sec(NI, cyc), cyc / NI);
+        if(per_sec(NI, cyc) > best)
+            best = per_sec(NI, cyc);
+    }
+    printk("SUCCESS: batches peak at %d verifies/sec, %d one at a time\n",
+        best, per_sec(NI, one));
+    clean_reboot();
+}
@@ -0,0 +1,65 @@
+#include "rpi.h"
+#include "cycle-count.h"
+#include "secp256k1.h"
+#include "atecc608a.h"
+#include "atecc-seal.h"
+#include "secp256k1-vectors.h"
+
+// cycles per secp256k1 sign and verify in software (libpi
+// secp256k1.c), on the generated vectors, and what opening a key
+// sealed under the chip costs (one ECDH).  the target is a signature
+// well under 100ms.
+enum { NVEC = sizeof secp256k1_vectors / sizeof secp256k1_vectors[0] };
+#define SIGN_MAX_CYC (100 * 700 * 1000)
+
+void notmain(void) {
+    uart_init();
+    caches_enable();
+    cycle_cnt_init();
+    kmalloc_init(1);
+
+    // the first sign builds the comb table.
+    secp256k1_key_t key;
+    uint8_t sig[64];
+    const secp256k1_vector_t *v = &secp256k1_vectors[0];
+    secp256k1_key_init(&key, v->priv);
+    unsigned first = TIME_CYC(secp256k1_sign(&key, v->digest, sig));
+
+    // every vector, for correctness, on the pi's compiler and flags.
+    unsigned sign_total = 0, verify_total = 0;
+    for(unsigned i = 0; i < NVEC; i++) {
+        v = &secp256k1_vectors[i];
+        int recid, ok;
+        if(!secp256k1_key_init(&key, v->priv))
+            panic("vector <%s>: key rejected\n", v->name);
+        sign_total += TIME_CYC(recid = secp256k1_sign(&key, v->digest, sig));
+        if(recid != v->recid || memcmp(sig, v->sig, 64) != 0)
+            panic("vector <%s>: signature differs\n", v->name);
+        verify_total += TIME_CYC(ok = secp256k1_verify(v->pubkey, v->digest, sig));
+        if(!ok)
+            panic("vector <%s>: does not verify\n", v->name);
+    }
+    unsigned sign = sign_total / NVEC, verify = verify_total / NVEC;
+    printk("first sign (comb table): %d cycles (%d usec)\n", first, first / 700);
+    printk("sign: %d cycles (%d usec), verify: %d cycles (%d usec), %d vectors\n",
+        sign, sign / 700, verify, verify / 700, NVEC);
+
+    // seal the last vector's key under the chip and open it again.
+    secp256k1_sealed_t sealed;
+    if(atecc_seal_k1(v->priv, &sealed) < 0)
+        panic("sealing failed: is slot %d an ECDH key?\n", ATECC_SEAL_SLOT);
+    int ret;
+    unsigned unseal = TIME_CYC(ret = atecc_unseal_k1(&sealed, &key));
+    if(ret != 0 || memcmp(key.pubkey, v->pubkey, 64) != 0)
+        panic("sealed key did not come back: %d\n", ret);
+    unsigned sealed_sign = TIME_CYC(secp256k1_sign(&key, v->digest, sig));
+    secp256k1_key_wipe(&key);
+    printk("unseal (ECDH + key): %d cycles (%d usec), then sign %d usec\n",
+        unseal, unseal / 700, sealed_sign / 700);
+
+    if(sign > SIGN_MAX_CYC)
+        panic("sign takes %d usec\n", sign / 700);
+    printk("SUCCESS: secp256k1 sign in %d usec, verify in %d usec\n",
+        sign / 700, verify / 700);
+    clean_reboot();
+}
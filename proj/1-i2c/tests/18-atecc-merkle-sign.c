@@ -0,0 +1,91 @@
+#include "rpi.h"
+#include "i2c.h"
+#include "cycle-count.h"
+#include "atecc608a.h"
+#include "atecc-merkle.h"
+
+// Merkle batch signing on the chip: digests per second by batch size
+// against atecc608a_sign one at a time, every receipt checked in
+// software against slot 0's public key, and one receipt printed for
+// proj/2-py-util/merkle-verify.py:
+//   python3 merkle-verify.py <pubkey> <digest> <receipt>
+enum { NMAX = ATECC_MERKLE_MAX, NSINGLE = 8 };
+
+static atecc_merkle_t batch;
+static uint8_t digest[NMAX][32], sig[64], pubkey[64];
+static uint8_t wire[ATECC_MERKLE_PROOF_BYTES(ATECC_MERKLE_DEPTH)];
+
+static void print_hex(const char *name, const uint8_t *p, unsigned n) {
+    printk("%s: ", name);
+    static const char hex[] = "0123456789abcdef";
+    for(unsigned i = 0; i < n; i++)
+        printk("%c%c", hex[p[i] >> 4], hex[p[i] & 15]);
+    printk("\n");
+}
+
+void notmain(void) {
+    uart_init();
+    caches_enable();
+    cycle_cnt_init();
+    kmalloc_init(1);
+    i2c_init();
+    i2c_set_speed(I2C_FAST);
+
+    for(unsigned i = 0; i < NMAX; i++)
+        for(unsigned j = 0; j < 32; j++)
+            digest[i][j] = i * 131 + j * 7;
+    if(atecc608a_pubkey(0, pubkey) < 0)
+        panic("no public key in slot 0\n");
+
+    unsigned s = timer_get_usec();
+    for(unsigned i = 0; i < NSINGLE; i++)
+        if(atecc608a_sign(0, digest[i], sig) < 0)
+            panic("sign %d failed\n", i);
+    unsigned single = (timer_get_usec() - s) / NSINGLE;
+    printk("atecc608a_sign: %d usec/digest = %d digests/s\n", single, 1000000 / single);
+
+    unsigned per = single;
+    for(unsigned n = 1; n <= NMAX; n *= 4) {
+        atecc_merkle_proof_t p;
+        atecc_merkle_init(&batch);
+
+        // the leaves, the tree and the chip, then every receipt.
+        s = timer_get_usec();
+        unsigned add = TIME_CYC(
+            for(unsigned i = 0; i < n; i++)
+                atecc_merkle_add(&batch, digest[i]));
+        if(atecc_merkle_sign(&batch, 0) < 0)
+            panic("batch of %d: signing failed\n", n);
+        unsigned proofs = TIME_CYC(
+            for(unsigned i = 0; i < n; i++)
+                atecc_merkle_proof(&batch, i, &p));
+        unsigned t = timer_get_usec() - s;
+        per = t / n;
+        printk("batch %d: %d usec, %d usec/digest = %d digests/s "
+            "(leaves %d cyc/digest, receipts %d cyc/digest)\n",
+            n, t, per, n * 1000000 / t, add / n, proofs / n);
+
+        unsigned cyc = 0;
+        for(unsigned i = 0; i < n; i++) {
+            int ret;
+            atecc_merkle_proof(&batch, i, &p);
+            cyc += TIME_CYC(ret = atecc_merkle_verify(pubkey, digest[i], &p));
+            if(ret != 0)
+                panic("batch of %d: receipt %d does not verify\n", n, i);
+        }
+        printk("  %d receipts verified, %d usec each\n", n, cyc / n / 700);
+    }
+
+    atecc_merkle_proof_t p;
+    atecc_merkle_proof(&batch, 5, &p);
+    unsigned len = atecc_merkle_proof_pack(wire, &p);
+    print_hex("pubkey", pubkey, 64);
+    print_hex("digest", digest[5], 32);
+    print_hex("receipt", wire, len);
+    digest[5][0] ^= 1;
+    if(atecc_merkle_verify(pubkey, digest[5], &p) != 1)
+        panic("receipt verifies another digest\n");
+
+    printk("SUCCESS: %d usec/digest in batches of %d vs %d singly\n", per, NMAX, single);
+    clean_reboot();
+}
@@ -19,9 +19,8 @@ void my_i2c_init(void) {
     PUT32(I2C_S, I2C_S_CLKT | I2C_S_ERR | I2C_S_DONE);
     dev_barrier();
     
-    // Set clock divider for 100kHz (assuming 250MHz core clock)
-    PUT32(I2C_DIV, 2500);
-    dev_barrier();
+    // Set clock divider for 100kHz (from the real core clock)
+    i2c_set_speed(I2C_STANDARD);
     
     // Enable I2C
     PUT32(I2C_C, I2C_C_I2CEN);
@@ -28,9 +28,12 @@ void notmain(void) {
     }
     printk("\n");
     
+    // SHA-256 of the message on the chip, then signed: what
+    // 2-py-util/test-sig.py checks.  (atecc608a_sign wants a 32-byte
+    // digest, not the message.)
     uint8_t msg[] = "Hello, world!";
     uint8_t signature[64];
-    atecc608a_sign(0, msg, signature);
+    atecc608a_sign_message(0, msg, sizeof msg - 1, signature);
     printk("Signature: ");
     for (int i = 0; i < 64; i++) {
         printk("%x, ", signature[i]);
@@ -4,6 +4,8 @@
 
 void notmain(void) {
     uart_init();
+    // atecc608a_verify's key cache (p256.h).
+    kmalloc_init(1);
     printk("ATECC608A Detection Test for %x\n", ATECC608A_ADDR);
     
     i2c_init();
@@ -0,0 +1,31 @@
+#include "rpi.h"
+#include "i2c.h"
+#include "atecc608a.h"
+
+// time <n> INFO round trips at the current speed.
+static unsigned time_info(unsigned n) {
+    unsigned s = timer_get_usec();
+    for(unsigned i = 0; i < n; i++)
+        if(!atecc608a_check_link(0))
+            panic("INFO failed at %d hz\n", i2c_get_speed());
+    return (timer_get_usec() - s) / n;
+}
+
+void notmain(void) {
+    uart_init();
+    printk("ATECC608A bus speed probe for %x\n", ATECC608A_ADDR);
+
+    i2c_init();
+    atecc608a_wakeup();
+
+    printk("%d hz: INFO takes %d usec\n", i2c_get_speed(), time_info(4));
+
+    unsigned hz = i2c_speed_probe(atecc608a_check_link, 0);
+    if(!hz)
+        panic("device does not work even at 100kHz\n");
+    printk("%d hz: INFO takes %d usec\n", hz, time_info(4));
+
+    atecc608a_sleep();
+    printk("SUCCESS: running the bus at %d hz\n", hz);
+    clean_reboot();
+}
@@ -0,0 +1,32 @@
+#include "rpi.h"
+#include "i2c.h"
+#include "i2c-trace.h"
+#include "atecc608a.h"
+
+void notmain(void) {
+    uart_init();
+    printk("I2C trace of ATECC608A traffic\n");
+
+    // needs the tracer compiled in: uncomment CFLAGS_EXTRA in the Makefile.
+    if(!I2C_TRACE)
+        panic("ERROR: built without -DI2C_TRACE=1\n");
+
+    i2c_init();
+    atecc608a_wakeup();
+    i2c_trace_reset();
+
+    uint8_t rand[32];
+    for(int i = 0; i < 4; i++) {
+        if(!atecc608a_check_link(0))
+            panic("INFO failed\n");
+    }
+    atecc608a_random(rand);
+    atecc608a_sleep();
+
+    // pi-install mangles binary output: wait for the host tool
+    // (proj/1-i2c/trace) to ask for it.
+    printk("TRACE: quit pi-install and run i2c-trace\n");
+    uart_get8();
+    i2c_trace_dump();
+    clean_reboot();
+}
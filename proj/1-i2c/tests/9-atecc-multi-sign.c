@@ -0,0 +1,51 @@
+#include "rpi.h"
+#include "i2c.h"
+#include "atecc-bus.h"
+
+// one entry per chip on the bus.  each needs its own I2C_Address in
+// its config zone (the default is 0x60): edit to match your board.
+static const uint8_t addrs[] = { 0x60, 0x61 };
+enum { NCHIPS = sizeof addrs, NSIG = 8 };
+
+static uint8_t digest[NSIG][32], sig[NSIG][64], who[NSIG];
+
+// sign the batch using the first <n> chips.
+static unsigned sign_batch(unsigned n) {
+    if(atecc_bus_wake() != n)
+        panic("only some of the %d chips woke up\n", n);
+
+    unsigned s = timer_get_usec();
+    int r = atecc_bus_sign(0, digest, sig, who, NSIG);
+    unsigned t = timer_get_usec() - s;
+    atecc_bus_sleep();
+    if(r != NSIG)
+        panic("sign batch failed: %d\n", r);
+
+    printk("%d chip(s): %d signatures in %d usec\n", n, NSIG, t);
+    for(unsigned i = 0; i < NSIG; i++)
+        printk("  digest %d signed by %x\n", i, who[i]);
+    return t;
+}
+
+void notmain(void) {
+    uart_init();
+    printk("ATECC608A multi-chip signing on %d chips\n", NCHIPS);
+
+    for(unsigned i = 0; i < NSIG; i++)
+        for(unsigned j = 0; j < 32; j++)
+            digest[i][j] = i * 31 + j;
+
+    i2c_init();
+    i2c_set_speed(I2C_FAST);
+
+    unsigned t1 = 0, tn = 0;
+    for(unsigned n = 1; n <= NCHIPS; n++) {
+        atecc_bus_add(addrs[n-1]);
+        tn = sign_batch(n);
+        if(n == 1)
+            t1 = tn;
+    }
+    printk("SUCCESS: %d chips sign %d.%dx faster than one\n",
+        NCHIPS, (t1 * 10 / tn) / 10, (t1 * 10 / tn) % 10);
+    clean_reboot();
+}
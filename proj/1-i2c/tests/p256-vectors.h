@@ -0,0 +1,1209 @@
+// generated by proj/2-py-util/p256-vectors.py: do not edit.
+//
+// P-256 ECDSA over SHA-256 digests; ok says whether the signature
+// verifies.  r and s are taken mod 2^256 ("r = r + n" wraps).
+#ifndef __P256_VECTORS_H__
+#define __P256_VECTORS_H__
+
+typedef struct {
+    const char *name;
+    int ok;
+    uint8_t pubkey[64];
+    uint8_t digest[32];
+    uint8_t sig[64];
+} p256_vector_t;
+
+static const p256_vector_t p256_vectors[] = {
+    { "key 0 msg 0", 1,
+      {
+        0x68, 0x11, 0x37, 0x76, 0x77, 0xb3, 0x91, 0xcc, 0x8e, 0xd7, 0x75, 0xf4, 0x6f, 0xe8, 0x45, 0x75,
+        0x57, 0xa0, 0x00, 0x0d, 0xa1, 0xfd, 0x9c, 0x61, 0xa4, 0x3e, 0x23, 0x6b, 0x86, 0x21, 0x74, 0x45,
+        0xd1, 0xea, 0xd1, 0x52, 0x57, 0x5a, 0xd8, 0x82, 0x59, 0x09, 0xbc, 0x52, 0xd3, 0xfc, 0x70, 0x37,
+        0x54, 0xdd, 0x1c, 0x50, 0x97, 0x9b, 0xfa, 0x52, 0x6e, 0x04, 0xbb, 0x40, 0x7c, 0x4c, 0x20, 0x5b,
+      },
+      {
+        0xbe, 0xb0, 0xcc, 0x90, 0xc2, 0x6d, 0xc4, 0x05, 0xb2, 0x0c, 0x60, 0x6b, 0x8f, 0x6a, 0xbf, 0xa9,
+        0x5f, 0xae, 0xb9, 0x5a, 0xed, 0x35, 0x4b, 0x06, 0x85, 0xe1, 0x9a, 0xa0, 0x5f, 0x96, 0xd6, 0xbb,
+      },
+      {
+        0xed, 0x62, 0x20, 0x6d, 0x5a, 0x1b, 0xed, 0xe3, 0xcd, 0xcb, 0x02, 0x0a, 0xe8, 0x34, 0x8d, 0x15,
+        0x38, 0x7b, 0x6b, 0xb8, 0x29, 0xc1, 0x8b, 0x8d, 0x44, 0x35, 0x6b, 0x49, 0xd2, 0x19, 0x53, 0x57,
+        0x64, 0x8e, 0x48, 0x34, 0x25, 0xb8, 0x24, 0x3f, 0x1a, 0x74, 0x9a, 0x3f, 0x3d, 0xeb, 0x5e, 0xd3,
+        0x45, 0xb3, 0x0f, 0x60, 0xf2, 0x67, 0x13, 0x90, 0x7b, 0x2c, 0xbc, 0x72, 0x36, 0x48, 0xfd, 0xb5,
+      } },
+    { "key 0, r bit flip", 0,
+      {
+        0x68, 0x11, 0x37, 0x76, 0x77, 0xb3, 0x91, 0xcc, 0x8e, 0xd7, 0x75, 0xf4, 0x6f, 0xe8, 0x45, 0x75,
+        0x57, 0xa0, 0x00, 0x0d, 0xa1, 0xfd, 0x9c, 0x61, 0xa4, 0x3e, 0x23, 0x6b, 0x86, 0x21, 0x74, 0x45,
+        0xd1, 0xea, 0xd1, 0x52, 0x57, 0x5a, 0xd8, 0x82, 0x59, 0x09, 0xbc, 0x52, 0xd3, 0xfc, 0x70, 0x37,
+        0x54, 0xdd, 0x1c, 0x50, 0x97, 0x9b, 0xfa, 0x52, 0x6e, 0x04, 0xbb, 0x40, 0x7c, 0x4c, 0x20, 0x5b,
+      },
+      {
+        0xbe, 0xb0, 0xcc, 0x90, 0xc2, 0x6d, 0xc4, 0x05, 0xb2, 0x0c, 0x60, 0x6b, 0x8f, 0x6a, 0xbf, 0xa9,
+        0x5f, 0xae, 0xb9, 0x5a, 0xed, 0x35, 0x4b, 0x06, 0x85, 0xe1, 0x9a, 0xa0, 0x5f, 0x96, 0xd6, 0xbb,
+      },
+      {
+        0xed, 0x62, 0x20, 0x6d, 0x5a, 0x1b, 0xed, 0xe3, 0xcd, 0xcb, 0x02, 0x0a, 0xe8, 0x34, 0x8d, 0x15,
+        0x38, 0x7b, 0x6b, 0xb8, 0x2b, 0xc1, 0x8b, 0x8d, 0x44, 0x35, 0x6b, 0x49, 0xd2, 0x19, 0x53, 0x57,
+        0x64, 0x8e, 0x48, 0x34, 0x25, 0xb8, 0x24, 0x3f, 0x1a, 0x74, 0x9a, 0x3f, 0x3d, 0xeb, 0x5e, 0xd3,
+        0x45, 0xb3, 0x0f, 0x60, 0xf2, 0x67, 0x13, 0x90, 0x7b, 0x2c, 0xbc, 0x72, 0x36, 0x48, 0xfd, 0xb5,
+      } },
+    { "key 0, s bit flip", 0,
+      {
+        0x68, 0x11, 0x37, 0x76, 0x77, 0xb3, 0x91, 0xcc, 0x8e, 0xd7, 0x75, 0xf4, 0x6f, 0xe8, 0x45, 0x75,
+        0x57, 0xa0, 0x00, 0x0d, 0xa1, 0xfd, 0x9c, 0x61, 0xa4, 0x3e, 0x23, 0x6b, 0x86, 0x21, 0x74, 0x45,
+        0xd1, 0xea, 0xd1, 0x52, 0x57, 0x5a, 0xd8, 0x82, 0x59, 0x09, 0xbc, 0x52, 0xd3, 0xfc, 0x70, 0x37,
+        0x54, 0xdd, 0x1c, 0x50, 0x97, 0x9b, 0xfa, 0x52, 0x6e, 0x04, 0xbb, 0x40, 0x7c, 0x4c, 0x20, 0x5b,
+      },
+      {
+        0xbe, 0xb0, 0xcc, 0x90, 0xc2, 0x6d, 0xc4, 0x05, 0xb2, 0x0c, 0x60, 0x6b, 0x8f, 0x6a, 0xbf, 0xa9,
+        0x5f, 0xae, 0xb9, 0x5a, 0xed, 0x35, 0x4b, 0x06, 0x85, 0xe1, 0x9a, 0xa0, 0x5f, 0x96, 0xd6, 0xbb,
+      },
+      {
+        0xed, 0x62, 0x20, 0x6d, 0x5a, 0x1b, 0xed, 0xe3, 0xcd, 0xcb, 0x02, 0x0a, 0xe8, 0x34, 0x8d, 0x15,
+        0x38, 0x7b, 0x6b, 0xb8, 0x29, 0xc1, 0x8b, 0x8d, 0x44, 0x35, 0x6b, 0x49, 0xd2, 0x19, 0x53, 0x57,
+        0x64, 0x8e, 0x48, 0x34, 0x25, 0xb8, 0x24, 0x3f, 0x1a, 0x74, 0x9a, 0x3f, 0x3d, 0xeb, 0x5e, 0xd3,
+        0x45, 0x93, 0x0f, 0x60, 0xf2, 0x67, 0x13, 0x90, 0x7b, 0x2c, 0xbc, 0x72, 0x36, 0x48, 0xfd, 0xb5,
+      } },
+    { "key 0, message bit flip", 0,
+      {
+        0x68, 0x11, 0x37, 0x76, 0x77, 0xb3, 0x91, 0xcc, 0x8e, 0xd7, 0x75, 0xf4, 0x6f, 0xe8, 0x45, 0x75,
+        0x57, 0xa0, 0x00, 0x0d, 0xa1, 0xfd, 0x9c, 0x61, 0xa4, 0x3e, 0x23, 0x6b, 0x86, 0x21, 0x74, 0x45,
+        0xd1, 0xea, 0xd1, 0x52, 0x57, 0x5a, 0xd8, 0x82, 0x59, 0x09, 0xbc, 0x52, 0xd3, 0xfc, 0x70, 0x37,
+        0x54, 0xdd, 0x1c, 0x50, 0x97, 0x9b, 0xfa, 0x52, 0x6e, 0x04, 0xbb, 0x40, 0x7c, 0x4c, 0x20, 0x5b,
+      },
+      {
+        0xda, 0x45, 0x44, 0x73, 0x54, 0xd8, 0xb4, 0x7e, 0x51, 0x5c, 0xc8, 0x18, 0x9a, 0xa8, 0xbf, 0xbe,
+        0x88, 0xd0, 0xa5, 0x36, 0x5d, 0xb9, 0xa7, 0xdc, 0xbe, 0xe7, 0x3f, 0x95, 0x94, 0xd7, 0x74, 0x2c,
+      },
+      {
+        0xed, 0x62, 0x20, 0x6d, 0x5a, 0x1b, 0xed, 0xe3, 0xcd, 0xcb, 0x02, 0x0a, 0xe8, 0x34, 0x8d, 0x15,
+        0x38, 0x7b, 0x6b, 0xb8, 0x29, 0xc1, 0x8b, 0x8d, 0x44, 0x35, 0x6b, 0x49, 0xd2, 0x19, 0x53, 0x57,
+        0x64, 0x8e, 0x48, 0x34, 0x25, 0xb8, 0x24, 0x3f, 0x1a, 0x74, 0x9a, 0x3f, 0x3d, 0xeb, 0x5e, 0xd3,
+        0x45, 0xb3, 0x0f, 0x60, 0xf2, 0x67, 0x13, 0x90, 0x7b, 0x2c, 0xbc, 0x72, 0x36, 0x48, 0xfd, 0xb5,
+      } },
+    { "key 0, wrong key", 0,
+      {
+        0x9c, 0x9c, 0xcd, 0xda, 0xde, 0xda, 0x1f, 0xe3, 0x96, 0x35, 0x91, 0x31, 0x1f, 0xfc, 0x64, 0x7f,
+        0x3b, 0x38, 0xb3, 0x50, 0x6f, 0xb8, 0x49, 0x51, 0xc0, 0x24, 0xe0, 0x7b, 0xa1, 0xbb, 0x71, 0xdc,
+        0x55, 0x2f, 0x59, 0x38, 0xd7, 0xce, 0xaf, 0xc9, 0xa9, 0x78, 0x49, 0xe1, 0xff, 0x8a, 0x4c, 0xa9,
+        0x1b, 0x63, 0xc4, 0xde, 0x9f, 0xc6, 0xd5, 0xf0, 0xc3, 0x84, 0x4d, 0xcc, 0xfc, 0xb5, 0xde, 0xc7,
+      },
+      {
+        0xbe, 0xb0, 0xcc, 0x90, 0xc2, 0x6d, 0xc4, 0x05, 0xb2, 0x0c, 0x60, 0x6b, 0x8f, 0x6a, 0xbf, 0xa9,
+        0x5f, 0xae, 0xb9, 0x5a, 0xed, 0x35, 0x4b, 0x06, 0x85, 0xe1, 0x9a, 0xa0, 0x5f, 0x96, 0xd6, 0xbb,
+      },
+      {
+        0xed, 0x62, 0x20, 0x6d, 0x5a, 0x1b, 0xed, 0xe3, 0xcd, 0xcb, 0x02, 0x0a, 0xe8, 0x34, 0x8d, 0x15,
+        0x38, 0x7b, 0x6b, 0xb8, 0x29, 0xc1, 0x8b, 0x8d, 0x44, 0x35, 0x6b, 0x49, 0xd2, 0x19, 0x53, 0x57,
+        0x64, 0x8e, 0x48, 0x34, 0x25, 0xb8, 0x24, 0x3f, 0x1a, 0x74, 0x9a, 0x3f, 0x3d, 0xeb, 0x5e, 0xd3,
+        0x45, 0xb3, 0x0f, 0x60, 0xf2, 0x67, 0x13, 0x90, 0x7b, 0x2c, 0xbc, 0x72, 0x36, 0x48, 0xfd, 0xb5,
+      } },
+    { "r = 0", 0,
+      {
+        0x68, 0x11, 0x37, 0x76, 0x77, 0xb3, 0x91, 0xcc, 0x8e, 0xd7, 0x75, 0xf4, 0x6f, 0xe8, 0x45, 0x75,
+        0x57, 0xa0, 0x00, 0x0d, 0xa1, 0xfd, 0x9c, 0x61, 0xa4, 0x3e, 0x23, 0x6b, 0x86, 0x21, 0x74, 0x45,
+        0xd1, 0xea, 0xd1, 0x52, 0x57, 0x5a, 0xd8, 0x82, 0x59, 0x09, 0xbc, 0x52, 0xd3, 0xfc, 0x70, 0x37,
+        0x54, 0xdd, 0x1c, 0x50, 0x97, 0x9b, 0xfa, 0x52, 0x6e, 0x04, 0xbb, 0x40, 0x7c, 0x4c, 0x20, 0x5b,
+      },
+      {
+        0xbe, 0xb0, 0xcc, 0x90, 0xc2, 0x6d, 0xc4, 0x05, 0xb2, 0x0c, 0x60, 0x6b, 0x8f, 0x6a, 0xbf, 0xa9,
+        0x5f, 0xae, 0xb9, 0x5a, 0xed, 0x35, 0x4b, 0x06, 0x85, 0xe1, 0x9a, 0xa0, 0x5f, 0x96, 0xd6, 0xbb,
+      },
+      {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x64, 0x8e, 0x48, 0x34, 0x25, 0xb8, 0x24, 0x3f, 0x1a, 0x74, 0x9a, 0x3f, 0x3d, 0xeb, 0x5e, 0xd3,
+        0x45, 0xb3, 0x0f, 0x60, 0xf2, 0x67, 0x13, 0x90, 0x7b, 0x2c, 0xbc, 0x72, 0x36, 0x48, 0xfd, 0xb5,
+      } },
+    { "s = n", 0,
+      {
+        0x68, 0x11, 0x37, 0x76, 0x77, 0xb3, 0x91, 0xcc, 0x8e, 0xd7, 0x75, 0xf4, 0x6f, 0xe8, 0x45, 0x75,
+        0x57, 0xa0, 0x00, 0x0d, 0xa1, 0xfd, 0x9c, 0x61, 0xa4, 0x3e, 0x23, 0x6b, 0x86, 0x21, 0x74, 0x45,
+        0xd1, 0xea, 0xd1, 0x52, 0x57, 0x5a, 0xd8, 0x82, 0x59, 0x09, 0xbc, 0x52, 0xd3, 0xfc, 0x70, 0x37,
+        0x54, 0xdd, 0x1c, 0x50, 0x97, 0x9b, 0xfa, 0x52, 0x6e, 0x04, 0xbb, 0x40, 0x7c, 0x4c, 0x20, 0x5b,
+      },
+      {
+        0xbe, 0xb0, 0xcc, 0x90, 0xc2, 0x6d, 0xc4, 0x05, 0xb2, 0x0c, 0x60, 0x6b, 0x8f, 0x6a, 0xbf, 0xa9,
+        0x5f, 0xae, 0xb9, 0x5a, 0xed, 0x35, 0x4b, 0x06, 0x85, 0xe1, 0x9a, 0xa0, 0x5f, 0x96, 0xd6, 0xbb,
+      },
+      {
+        0xed, 0x62, 0x20, 0x6d, 0x5a, 0x1b, 0xed, 0xe3, 0xcd, 0xcb, 0x02, 0x0a, 0xe8, 0x34, 0x8d, 0x15,
+        0x38, 0x7b, 0x6b, 0xb8, 0x29, 0xc1, 0x8b, 0x8d, 0x44, 0x35, 0x6b, 0x49, 0xd2, 0x19, 0x53, 0x57,
+        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xbc, 0xe6, 0xfa, 0xad, 0xa7, 0x17, 0x9e, 0x84, 0xf3, 0xb9, 0xca, 0xc2, 0xfc, 0x63, 0x25, 0x51,
+      } },
+    { "r = r + n", 0,
+      {
+        0x68, 0x11, 0x37, 0x76, 0x77, 0xb3, 0x91, 0xcc, 0x8e, 0xd7, 0x75, 0xf4, 0x6f, 0xe8, 0x45, 0x75,
+        0x57, 0xa0, 0x00, 0x0d, 0xa1, 0xfd, 0x9c, 0x61, 0xa4, 0x3e, 0x23, 0x6b, 0x86, 0x21, 0x74, 0x45,
+        0xd1, 0xea, 0xd1, 0x52, 0x57, 0x5a, 0xd8, 0x82, 0x59, 0x09, 0xbc, 0x52, 0xd3, 0xfc, 0x70, 0x37,
+        0x54, 0xdd, 0x1c, 0x50, 0x97, 0x9b, 0xfa, 0x52, 0x6e, 0x04, 0xbb, 0x40, 0x7c, 0x4c, 0x20, 0x5b,
+      },
+      {
+        0xbe, 0xb0, 0xcc, 0x90, 0xc2, 0x6d, 0xc4, 0x05, 0xb2, 0x0c, 0x60, 0x6b, 0x8f, 0x6a, 0xbf, 0xa9,
+        0x5f, 0xae, 0xb9, 0x5a, 0xed, 0x35, 0x4b, 0x06, 0x85, 0xe1, 0x9a, 0xa0, 0x5f, 0x96, 0xd6, 0xbb,
+      },
+      {
+        0xed, 0x62, 0x20, 0x6c, 0x5a, 0x1b, 0xed, 0xe4, 0xcd, 0xcb, 0x02, 0x0a, 0xe8, 0x34, 0x8d, 0x14,
+        0xf5, 0x62, 0x66, 0x65, 0xd0, 0xd9, 0x2a, 0x12, 0x37, 0xef, 0x36, 0x0c, 0xce, 0x7c, 0x78, 0xa8,
+        0x64, 0x8e, 0x48, 0x34, 0x25, 0xb8, 0x24, 0x3f, 0x1a, 0x74, 0x9a, 0x3f, 0x3d, 0xeb, 0x5e, 0xd3,
+        0x45, 0xb3, 0x0f, 0x60, 0xf2, 0x67, 0x13, 0x90, 0x7b, 0x2c, 0xbc, 0x72, 0x36, 0x48, 0xfd, 0xb5,
+      } },
+    { "key off the curve", 0,
+      {
+        0x68, 0x11, 0x37, 0x76, 0x77, 0xb3, 0x91, 0xcc, 0x8e, 0xd7, 0x75, 0xf4, 0x6f, 0xe8, 0x45, 0x75,
+        0x57, 0xa0, 0x00, 0x0d, 0xa1, 0xfd, 0x9c, 0x61, 0xa4, 0x3e, 0x23, 0x6b, 0x86, 0x21, 0x74, 0x45,
+        0xd1, 0xea, 0xd1, 0x52, 0x57, 0x5a, 0xd8, 0x82, 0x59, 0x09, 0xbc, 0x52, 0xd3, 0xfc, 0x70, 0x37,
+        0x54, 0xdd, 0x1c, 0x50, 0x97, 0x9b, 0xfa, 0x52, 0x6e, 0x04, 0xbb, 0x40, 0x7c, 0x4c, 0x20, 0x5c,
+      },
+      {
+        0xbe, 0xb0, 0xcc, 0x90, 0xc2, 0x6d, 0xc4, 0x05, 0xb2, 0x0c, 0x60, 0x6b, 0x8f, 0x6a, 0xbf, 0xa9,
+        0x5f, 0xae, 0xb9, 0x5a, 0xed, 0x35, 0x4b, 0x06, 0x85, 0xe1, 0x9a, 0xa0, 0x5f, 0x96, 0xd6, 0xbb,
+      },
+      {
+        0xed, 0x62, 0x20, 0x6d, 0x5a, 0x1b, 0xed, 0xe3, 0xcd, 0xcb, 0x02, 0x0a, 0xe8, 0x34, 0x8d, 0x15,
+        0x38, 0x7b, 0x6b, 0xb8, 0x29, 0xc1, 0x8b, 0x8d, 0x44, 0x35, 0x6b, 0x49, 0xd2, 0x19, 0x53, 0x57,
+        0x64, 0x8e, 0x48, 0x34, 0x25, 0xb8, 0x24, 0x3f, 0x1a, 0x74, 0x9a, 0x3f, 0x3d, 0xeb, 0x5e, 0xd3,
+        0x45, 0xb3, 0x0f, 0x60, 0xf2, 0x67, 0x13, 0x90, 0x7b, 0x2c, 0xbc, 0x72, 0x36, 0x48, 0xfd, 0xb5,
+      } },
+    { "key 0 msg 1", 1,
+      {
+        0x68, 0x11, 0x37, 0x76, 0x77, 0xb3, 0x91, 0xcc, 0x8e, 0xd7, 0x75, 0xf4, 0x6f, 0xe8, 0x45, 0x75,
+        0x57, 0xa0, 0x00, 0x0d, 0xa1, 0xfd, 0x9c, 0x61, 0xa4, 0x3e, 0x23, 0x6b, 0x86, 0x21, 0x74, 0x45,
+        0xd1, 0xea, 0xd1, 0x52, 0x57, 0x5a, 0xd8, 0x82, 0x59, 0x09, 0xbc, 0x52, 0xd3, 0xfc, 0x70, 0x37,
+        0x54, 0xdd, 0x1c, 0x50, 0x97, 0x9b, 0xfa, 0x52, 0x6e, 0x04, 0xbb, 0x40, 0x7c, 0x4c, 0x20, 0x5b,
+      },
+      {
+        0xa5, 0x4f, 0xf0, 0x27, 0xb1, 0xbb, 0xa0, 0x6f, 0x6d, 0xe5, 0xc3, 0x89, 0x5e, 0xe5, 0xb2, 0xfa,
+        0x76, 0xeb, 0xf9, 0x4d, 0xbd, 0xf4, 0x1d, 0xde, 0xee, 0xf5, 0x0f, 0x61, 0x9a, 0xdd, 0xc7, 0x93,
+      },
+      {
+        0x26, 0x04, 0x43, 0x82, 0xd0, 0xff, 0x26, 0xce, 0x04, 0x6b, 0xe0, 0xa1, 0x0f, 0xfd, 0x23, 0x6d,
+        0x39, 0x2f, 0x87, 0xc6, 0xb8, 0x61, 0x61, 0xf5, 0x29, 0x9d, 0xc8, 0x06, 0x15, 0x04, 0xad, 0x86,
+        0x6f, 0xa4, 0x23, 0xc6, 0x9e, 0x6d, 0x02, 0x9d, 0x2f, 0xfc, 0xa1, 0xf7, 0x76, 0x87, 0xc6, 0xb7,
+        0x29, 0x92, 0x06, 0x66, 0xb1, 0x51, 0xb1, 0x2a, 0x7f, 0x19, 0x67, 0xb1, 0xbe, 0x98, 0x9c, 0xef,
+      } },
+    { "key 0 msg 2", 1,
+      {
+        0x68, 0x11, 0x37, 0x76, 0x77, 0xb3, 0x91, 0xcc, 0x8e, 0xd7, 0x75, 0xf4, 0x6f, 0xe8, 0x45, 0x75,
+        0x57, 0xa0, 0x00, 0x0d, 0xa1, 0xfd, 0x9c, 0x61, 0xa4, 0x3e, 0x23, 0x6b, 0x86, 0x21, 0x74, 0x45,
+        0xd1, 0xea, 0xd1, 0x52, 0x57, 0x5a, 0xd8, 0x82, 0x59, 0x09, 0xbc, 0x52, 0xd3, 0xfc, 0x70, 0x37,
+        0x54, 0xdd, 0x1c, 0x50, 0x97, 0x9b, 0xfa, 0x52, 0x6e, 0x04, 0xbb, 0x40, 0x7c, 0x4c, 0x20, 0x5b,
+      },
+      {
+        0x3c, 0x02, 0xec, 0xb3, 0xe5, 0x32, 0xb6, 0x27, 0xb3, 0x20, 0x2b, 0x2f, 0xd9, 0x61, 0xb8, 0xc2,
+        0x5d, 0xf0, 0xf4, 0x4a, 0x3f, 0xa7, 0x04, 0x77, 0xac, 0x60, 0x05, 0x93, 0x98, 0x5c, 0x82, 0xcf,
+      },
+      {
+        0x8d, 0x9c, 0xbd, 0x96, 0xf8, 0x6b, 0xcf, 0x32, 0xa0, 0xbc, 0x0c, 0xf8, 0x8e, 0xd3, 0x16, 0x2e,
+        0x57, 0xb6, 0x4f, 0x97, 0xc1, 0x8b, 0x22, 0x33, 0xee, 0xad, 0xc9, 0xd2, 0x2b, 0x9d, 0xa8, 0x34,
+        0x30, 0x78, 0xf1, 0xa5, 0x35, 0x5d, 0xbb, 0xc9, 0xbc, 0xfe, 0x3c, 0x14, 0x8d, 0xdb, 0xfe, 0x73,
+        0x42, 0x8a, 0x6a, 0xeb, 0xbb, 0x5c, 0x0b, 0x6c, 0x08, 0xca, 0x96, 0x12, 0xe3, 0x03, 0x7c, 0x4a,
+      } },
+    { "key 0 msg 3", 1,
+      {
+        0x68, 0x11, 0x37, 0x76, 0x77, 0xb3, 0x91, 0xcc, 0x8e, 0xd7, 0x75, 0xf4, 0x6f, 0xe8, 0x45, 0x75,
+        0x57, 0xa0, 0x00, 0x0d, 0xa1, 0xfd, 0x9c, 0x61, 0xa4, 0x3e, 0x23, 0x6b, 0x86, 0x21, 0x74, 0x45,
+        0xd1, 0xea, 0xd1, 0x52, 0x57, 0x5a, 0xd8, 0x82, 0x59, 0x09, 0xbc, 0x52, 0xd3, 0xfc, 0x70, 0x37,
+        0x54, 0xdd, 0x1c, 0x50, 0x97, 0x9b, 0xfa, 0x52, 0x6e, 0x04, 0xbb, 0x40, 0x7c, 0x4c, 0x20, 0x5b,
+      },
+      {
+        0x4a, 0x56, 0x54, 0x34, 0x9b, 0xa4, 0x5b, 0x32, 0xad, 0x03, 0x4b, 0xa3, 0x6f, 0xed, 0x4b, 0x29,
+        0x64, 0xb7, 0x24, 0xe0, 0x19, 0xa9, 0x3e, 0x5b, 0xcf, 0x03, 0x4c, 0x26, 0x46, 0x39, 0xe3, 0xf5,
+      },
+      {
+        0xa6, 0xf5, 0x46, 0x1e, 0x19, 0x81, 0xb5, 0x43, 0xbd, 0x37, 0x0d, 0x88, 0x83, 0xda, 0x7a, 0x9a,
+        0x32, 0x26, 0xb5, 0xd9, 0x04, 0x3a, 0x47, 0xdd, 0x2b, 0xdc, 0x83, 0x0f, 0x82, 0x93, 0xeb, 0x12,
+        0x0d, 0x58, 0xa2, 0x22, 0x4f, 0x62, 0xfe, 0xc2, 0xef, 0x76, 0x90, 0x7f, 0x33, 0x67, 0x22, 0x8d,
+        0xab, 0xee, 0x02, 0xb9, 0x78, 0x97, 0xb3, 0x13, 0x6d, 0xf7, 0x29, 0xc4, 0xc3, 0x30, 0xcc, 0xf9,
+      } },
+    { "key 1 msg 0", 1,
+      {
+        0x0f, 0x01, 0xbc, 0x3b, 0x58, 0xb1, 0x29, 0xe2, 0xf3, 0x44, 0x52, 0xa8, 0xba, 0x38, 0xe0, 0x34,
+        0xb3, 0x91, 0xd2, 0x5c, 0x51, 0x38, 0xcf, 0xf0, 0xa7, 0x47, 0x42, 0x08, 0xe2, 0xa6, 0xf9, 0x2b,
+        0x35, 0x38, 0x09, 0x87, 0xcd, 0x73, 0x35, 0x93, 0xbb, 0x5c, 0x4b, 0x5b, 0xa6, 0xf3, 0x08, 0xcc,
+        0xa3, 0x3e, 0x34, 0x1b, 0xba, 0x05, 0x39, 0xa1, 0x71, 0x36, 0xbe, 0x8e, 0x6f, 0xd6, 0xb0, 0x2e,
+      },
+      {
+        0xd3, 0xf7, 0xa2, 0x33, 0x78, 0xde, 0x95, 0x28, 0x63, 0x81, 0x8b, 0x52, 0x1a, 0x63, 0x3d, 0x46,
+        0xc6, 0x78, 0x2e, 0xfe, 0x0b, 0xe7, 0x37, 0xe5, 0x28, 0x6c, 0x1c, 0x28, 0x92, 0x10, 0x35, 0xde,
+      },
+      {
+        0x0e, 0xaf, 0x23, 0x85, 0x8e, 0xf2, 0xe2, 0x36, 0xf3, 0xd9, 0xb0, 0x75, 0x40, 0xca, 0xe2, 0x7f,
+        0xd6, 0x17, 0xbb, 0x40, 0x75, 0x31, 0x54, 0x31, 0xd5, 0x14, 0x34, 0xa9, 0x09, 0x5b, 0x93, 0x38,
+        0x20, 0xfb, 0xef, 0x37, 0x12, 0x67, 0x85, 0x32, 0x77, 0x02, 0xcd, 0xad, 0x45, 0x7d, 0x90, 0x00,
+        0xff, 0x09, 0x05, 0xaa, 0x24, 0x32, 0xec, 0x95, 0xca, 0x9f, 0xce, 0xcc, 0x5f, 0x84, 0x9a, 0x86,
+      } },
+    { "key 1, r bit flip", 0,
+      {
+        0x0f, 0x01, 0xbc, 0x3b, 0x58, 0xb1, 0x29, 0xe2, 0xf3, 0x44, 0x52, 0xa8, 0xba, 0x38, 0xe0, 0x34,
+        0xb3, 0x91, 0xd2, 0x5c, 0x51, 0x38, 0xcf, 0xf0, 0xa7, 0x47, 0x42, 0x08, 0xe2, 0xa6, 0xf9, 0x2b,
+        0x35, 0x38, 0x09, 0x87, 0xcd, 0x73, 0x35, 0x93, 0xbb, 0x5c, 0x4b, 0x5b, 0xa6, 0xf3, 0x08, 0xcc,
+        0xa3, 0x3e, 0x34, 0x1b, 0xba, 0x05, 0x39, 0xa1, 0x71, 0x36, 0xbe, 0x8e, 0x6f, 0xd6, 0xb0, 0x2e,
+      },
+      {
+        0xd3, 0xf7, 0xa2, 0x33, 0x78, 0xde, 0x95, 0x28, 0x63, 0x81, 0x8b, 0x52, 0x1a, 0x63, 0x3d, 0x46,
+        0xc6, 0x78, 0x2e, 0xfe, 0x0b, 0xe7, 0x37, 0xe5, 0x28, 0x6c, 0x1c, 0x28, 0x92, 0x10, 0x35, 0xde,
+      },
+      {
+        0x0e, 0xaf, 0x23, 0x85, 0x8e, 0xf2, 0xe2, 0x36, 0xf3, 0xd9, 0xb0, 0x75, 0x40, 0xca, 0xe2, 0x7f,
+        0xd6, 0x17, 0xbb, 0x40, 0x75, 0x31, 0x54, 0x35, 0xd5, 0x14, 0x34, 0xa9, 0x09, 0x5b, 0x93, 0x38,
+        0x20, 0xfb, 0xef, 0x37, 0x12, 0x67, 0x85, 0x32, 0x77, 0x02, 0xcd, 0xad, 0x45, 0x7d, 0x90, 0x00,
+        0xff, 0x09, 0x05, 0xaa, 0x24, 0x32, 0xec, 0x95, 0xca, 0x9f, 0xce, 0xcc, 0x5f, 0x84, 0x9a, 0x86,
+      } },
+    { "key 1, s bit flip", 0,
+      {
+        0x0f, 0x01, 0xbc, 0x3b, 0x58, 0xb1, 0x29, 0xe2, 0xf3, 0x44, 0x52, 0xa8, 0xba, 0x38, 0xe0, 0x34,
+        0xb3, 0x91, 0xd2, 0x5c, 0x51, 0x38, 0xcf, 0xf0, 0xa7, 0x47, 0x42, 0x08, 0xe2, 0xa6, 0xf9, 0x2b,
+        0x35, 0x38, 0x09, 0x87, 0xcd, 0x73, 0x35, 0x93, 0xbb, 0x5c, 0x4b, 0x5b, 0xa6, 0xf3, 0x08, 0xcc,
+        0xa3, 0x3e, 0x34, 0x1b, 0xba, 0x05, 0x39, 0xa1, 0x71, 0x36, 0xbe, 0x8e, 0x6f, 0xd6, 0xb0, 0x2e,
+      },
+      {
+        0xd3, 0xf7, 0xa2, 0x33, 0x78, 0xde, 0x95, 0x28, 0x63, 0x81, 0x8b, 0x52, 0x1a, 0x63, 0x3d, 0x46,
+        0xc6, 0x78, 0x2e, 0xfe, 0x0b, 0xe7, 0x37, 0xe5, 0x28, 0x6c, 0x1c, 0x28, 0x92, 0x10, 0x35, 0xde,
+      },
+      {
+        0x0e, 0xaf, 0x23, 0x85, 0x8e, 0xf2, 0xe2, 0x36, 0xf3, 0xd9, 0xb0, 0x75, 0x40, 0xca, 0xe2, 0x7f,
+        0xd6, 0x17, 0xbb, 0x40, 0x75, 0x31, 0x54, 0x31, 0xd5, 0x14, 0x34, 0xa9, 0x09, 0x5b, 0x93, 0x38,
+        0x20, 0xfb, 0xef, 0x37, 0x12, 0x67, 0x85, 0x32, 0x77, 0x02, 0xcd, 0xad, 0x45, 0x7d, 0x90, 0x00,
+        0xff, 0x09, 0x05, 0xaa, 0x24, 0xb2, 0xec, 0x95, 0xca, 0x9f, 0xce, 0xcc, 0x5f, 0x84, 0x9a, 0x86,
+      } },
+    { "key 1, message bit flip", 0,
+      {
+        0x0f, 0x01, 0xbc, 0x3b, 0x58, 0xb1, 0x29, 0xe2, 0xf3, 0x44, 0x52, 0xa8, 0xba, 0x38, 0xe0, 0x34,
+        0xb3, 0x91, 0xd2, 0x5c, 0x51, 0x38, 0xcf, 0xf0, 0xa7, 0x47, 0x42, 0x08, 0xe2, 0xa6, 0xf9, 0x2b,
+        0x35, 0x38, 0x09, 0x87, 0xcd, 0x73, 0x35, 0x93, 0xbb, 0x5c, 0x4b, 0x5b, 0xa6, 0xf3, 0x08, 0xcc,
+        0xa3, 0x3e, 0x34, 0x1b, 0xba, 0x05, 0x39, 0xa1, 0x71, 0x36, 0xbe, 0x8e, 0x6f, 0xd6, 0xb0, 0x2e,
+      },
+      {
+        0x7e, 0x03, 0x3d, 0x64, 0xa3, 0x81, 0x78, 0xb3, 0x0d, 0x49, 0xdc, 0xe6, 0x77, 0x91, 0xf1, 0xf8,
+        0x8e, 0x26, 0x5c, 0x88, 0x40, 0xf3, 0x77, 0xe5, 0xae, 0xad, 0x10, 0xac, 0x61, 0xff, 0x4c, 0xcf,
+      },
+      {
+        0x0e, 0xaf, 0x23, 0x85, 0x8e, 0xf2, 0xe2, 0x36, 0xf3, 0xd9, 0xb0, 0x75, 0x40, 0xca, 0xe2, 0x7f,
+        0xd6, 0x17, 0xbb, 0x40, 0x75, 0x31, 0x54, 0x31, 0xd5, 0x14, 0x34, 0xa9, 0x09, 0x5b, 0x93, 0x38,
+        0x20, 0xfb, 0xef, 0x37, 0x12, 0x67, 0x85, 0x32, 0x77, 0x02, 0xcd, 0xad, 0x45, 0x7d, 0x90, 0x00,
+        0xff, 0x09, 0x05, 0xaa, 0x24, 0x32, 0xec, 0x95, 0xca, 0x9f, 0xce, 0xcc, 0x5f, 0x84, 0x9a, 0x86,
+      } },
+    { "key 1, wrong key", 0,
+      {
+        0x0f, 0xee, 0x8f, 0x0e, 0x3e, 0x48, 0xe7, 0x98, 0x42, 0x3a, 0xbc, 0xde, 0x12, 0xc8, 0x9d, 0x23,
+        0x4f, 0xc4, 0xfb, 0x73, 0x7c, 0xf2, 0x60, 0xe0, 0xee, 0xae, 0x5a, 0xaa, 0x36, 0xd5, 0x19, 0x61,
+        0x5e, 0x7b, 0x38, 0xbf, 0x72, 0x5c, 0x7d, 0x2a, 0xd5, 0x76, 0xa0, 0xa3, 0xe3, 0x3c, 0x4f, 0xcc,
+        0x5c, 0xe0, 0x49, 0x33, 0x56, 0x64, 0xef, 0x10, 0xab, 0x05, 0x27, 0x68, 0x8c, 0xb2, 0x39, 0x62,
+      },
+      {
+        0xd3, 0xf7, 0xa2, 0x33, 0x78, 0xde, 0x95, 0x28, 0x63, 0x81, 0x8b, 0x52, 0x1a, 0x63, 0x3d, 0x46,
+        0xc6, 0x78, 0x2e, 0xfe, 0x0b, 0xe7, 0x37, 0xe5, 0x28, 0x6c, 0x1c, 0x28, 0x92, 0x10, 0x35, 0xde,
+      },
+      {
+        0x0e, 0xaf, 0x23, 0x85, 0x8e, 0xf2, 0xe2, 0x36, 0xf3, 0xd9, 0xb0, 0x75, 0x40, 0xca, 0xe2, 0x7f,
+        0xd6, 0x17, 0xbb, 0x40, 0x75, 0x31, 0x54, 0x31, 0xd5, 0x14, 0x34, 0xa9, 0x09, 0x5b, 0x93, 0x38,
+        0x20, 0xfb, 0xef, 0x37, 0x12, 0x67, 0x85, 0x32, 0x77, 0x02, 0xcd, 0xad, 0x45, 0x7d, 0x90, 0x00,
+        0xff, 0x09, 0x05, 0xaa, 0x24, 0x32, 0xec, 0x95, 0xca, 0x9f, 0xce, 0xcc, 0x5f, 0x84, 0x9a, 0x86,
+      } },
+    { "key 1 msg 1", 1,
+      {
+        0x0f, 0x01, 0xbc, 0x3b, 0x58, 0xb1, 0x29, 0xe2, 0xf3, 0x44, 0x52, 0xa8, 0xba, 0x38, 0xe0, 0x34,
+        0xb3, 0x91, 0xd2, 0x5c, 0x51, 0x38, 0xcf, 0xf0, 0xa7, 0x47, 0x42, 0x08, 0xe2, 0xa6, 0xf9, 0x2b,
+        0x35, 0x38, 0x09, 0x87, 0xcd, 0x73, 0x35, 0x93, 0xbb, 0x5c, 0x4b, 0x5b, 0xa6, 0xf3, 0x08, 0xcc,
+        0xa3, 0x3e, 0x34, 0x1b, 0xba, 0x05, 0x39, 0xa1, 0x71, 0x36, 0xbe, 0x8e, 0x6f, 0xd6, 0xb0, 0x2e,
+      },
+      {
+        0x71, 0x75, 0x03, 0xbc, 0xef, 0xcc, 0xb9, 0x7c, 0x4a, 0x67, 0x12, 0x41, 0xb9, 0x39, 0xd5, 0x5a,
+        0x4f, 0xda, 0x0e, 0x65, 0xf3, 0xaf, 0xee, 0x6a, 0x3f, 0x78, 0x27, 0x55, 0x82, 0x3c, 0x1c, 0xbd,
+      },
+      {
+        0xac, 0x8f, 0xf4, 0x6b, 0xf9, 0x7d, 0x3c, 0xc8, 0xe9, 0xac, 0xd0, 0x1d, 0x92, 0xc8, 0x49, 0x33,
+        0x10, 0x22, 0x30, 0x35, 0xb7, 0x16, 0xda, 0xb4, 0x38, 0x51, 0x7e, 0xe5, 0x16, 0x0e, 0xe2, 0x41,
+        0x9e, 0x93, 0xa9, 0xde, 0x4c, 0x38, 0x81, 0x24, 0x32, 0xa0, 0xfb, 0xd3, 0x0f, 0xb4, 0xcc, 0x5e,
+        0xd1, 0xa7, 0x93, 0xcc, 0xda, 0xf7, 0x42, 0x11, 0x09, 0x2b, 0x0d, 0x07, 0x56, 0xfa, 0x11, 0x3c,
+      } },
+    { "key 1 msg 2", 1,
+      {
+        0x0f, 0x01, 0xbc, 0x3b, 0x58, 0xb1, 0x29, 0xe2, 0xf3, 0x44, 0x52, 0xa8, 0xba, 0x38, 0xe0, 0x34,
+        0xb3, 0x91, 0xd2, 0x5c, 0x51, 0x38, 0xcf, 0xf0, 0xa7, 0x47, 0x42, 0x08, 0xe2, 0xa6, 0xf9, 0x2b,
+        0x35, 0x38, 0x09, 0x87, 0xcd, 0x73, 0x35, 0x93, 0xbb, 0x5c, 0x4b, 0x5b, 0xa6, 0xf3, 0x08, 0xcc,
+        0xa3, 0x3e, 0x34, 0x1b, 0xba, 0x05, 0x39, 0xa1, 0x71, 0x36, 0xbe, 0x8e, 0x6f, 0xd6, 0xb0, 0x2e,
+      },
+      {
+        0xb9, 0xab, 0xea, 0x3d, 0x79, 0xc7, 0x21, 0xd3, 0x50, 0x8f, 0xe9, 0x89, 0x2e, 0x9b, 0x23, 0xdc,
+        0xf7, 0x3c, 0x3d, 0xe0, 0x59, 0x97, 0xe5, 0x64, 0x28, 0x77, 0x47, 0x1d, 0xa1, 0xd2, 0x86, 0x49,
+      },
+      {
+        0x37, 0xf8, 0xae, 0x90, 0x7d, 0xff, 0x4d, 0x31, 0x21, 0x48, 0xc5, 0x5e, 0x60, 0x4b, 0xb5, 0x17,
+        0x04, 0x2d, 0x19, 0x07, 0x24, 0xd9, 0x9b, 0x28, 0x70, 0x80, 0x23, 0x49, 0xd4, 0x65, 0x0e, 0x3b,
+        0x69, 0x97, 0xf3, 0x0c, 0x50, 0x01, 0x87, 0x5f, 0x68, 0xd7, 0xb2, 0x2d, 0xbf, 0x5c, 0x39, 0xd9,
+        0x29, 0xbb, 0xce, 0xfb, 0x5f, 0x63, 0x1b, 0x8f, 0xbb, 0x53, 0xf4, 0x31, 0xab, 0xf8, 0x67, 0xec,
+      } },
+    { "key 1 msg 3", 1,
+      {
+        0x0f, 0x01, 0xbc, 0x3b, 0x58, 0xb1, 0x29, 0xe2, 0xf3, 0x44, 0x52, 0xa8, 0xba, 0x38, 0xe0, 0x34,
+        0xb3, 0x91, 0xd2, 0x5c, 0x51, 0x38, 0xcf, 0xf0, 0xa7, 0x47, 0x42, 0x08, 0xe2, 0xa6, 0xf9, 0x2b,
+        0x35, 0x38, 0x09, 0x87, 0xcd, 0x73, 0x35, 0x93, 0xbb, 0x5c, 0x4b, 0x5b, 0xa6, 0xf3, 0x08, 0xcc,
+        0xa3, 0x3e, 0x34, 0x1b, 0xba, 0x05, 0x39, 0xa1, 0x71, 0x36, 0xbe, 0x8e, 0x6f, 0xd6, 0xb0, 0x2e,
+      },
+      {
+        0x9d, 0x22, 0xbc, 0x10, 0xe8, 0x2b, 0x39, 0xf5, 0x84, 0x5f, 0x71, 0xcd, 0x4b, 0xb0, 0x84, 0xe6,
+        0x75, 0x1f, 0xa5, 0x77, 0x81, 0x16, 0x27, 0x33, 0x09, 0x0b, 0x75, 0xef, 0xd5, 0xa7, 0x53, 0x70,
+      },
+      {
+        0xa9, 0xb7, 0x50, 0xb7, 0xb6, 0x70, 0x13, 0x40, 0xbb, 0x04, 0x07, 0x7d, 0x2d, 0x53, 0xea, 0x92,
+        0xc7, 0xa3, 0x4b, 0x98, 0xd6, 0x6c, 0x07, 0xfa, 0x57, 0x9b, 0x56, 0x90, 0xd1, 0xa1, 0x64, 0xc6,
+        0xfd, 0x6a, 0x1c, 0x8c, 0x5e, 0x21, 0xcd, 0x05, 0x27, 0x3d, 0xb7, 0x4f, 0x33, 0xe8, 0x02, 0x96,
+        0x6c, 0xfb, 0xcd, 0xe8, 0xf7, 0x05, 0x28, 0xff, 0xa0, 0x52, 0xf4, 0x2a, 0xf3, 0xc1, 0x7c, 0x21,
+      } },
+    { "key 2 msg 0", 1,
+      {
+        0xfc, 0xf0, 0x65, 0x49, 0x2e, 0xb8, 0x30, 0xc9, 0xcb, 0xdc, 0x46, 0xa7, 0xbd, 0x5c, 0xf2, 0x99,
+        0x37, 0x24, 0x28, 0x69, 0x5e, 0xc5, 0x18, 0xe2, 0x64, 0xb8, 0x72, 0x32, 0x34, 0x87, 0x2e, 0x6f,
+        0xd4, 0xdc, 0x88, 0x3b, 0xfc, 0xf5, 0x62, 0x24, 0xe8, 0x2c, 0x9d, 0x17, 0x36, 0x7e, 0x2b, 0xbb,
+        0x67, 0xda, 0x8c, 0xf6, 0x95, 0x79, 0x7d, 0x91, 0x96, 0xea, 0xff, 0x16, 0x5f, 0x9f, 0x66, 0xe9,
+      },
+      {
+        0xd2, 0x90, 0x3b, 0xe0, 0x6c, 0x1f, 0xab, 0x6e, 0xdb, 0xdc, 0xe0, 0x08, 0x13, 0x17, 0x93, 0xf3,
+        0x52, 0x96, 0xb0, 0x77, 0x17, 0x69, 0x27, 0xe9, 0x1c, 0x7c, 0xbc, 0x9b, 0x7e, 0xe1, 0xdd, 0xb3,
+      },
+      {
+        0xf1, 0x2c, 0xc0, 0x58, 0x90, 0x4a, 0xa9, 0x0e, 0x99, 0x4f, 0xcc, 0x9c, 0x55, 0x3c, 0x3f, 0x47,
+        0xeb, 0x3b, 0xd7, 0x9f, 0xb0, 0x2e, 0x13, 0x40, 0x31, 0xa0, 0x56, 0x33, 0x73, 0x62, 0x53, 0xbe,
+        0x6c, 0xec, 0x4a, 0x7a, 0x9f, 0x15, 0x3d, 0x46, 0x71, 0xe7, 0xcd, 0xd7, 0x0d, 0x2e, 0x97, 0x84,
+        0x9a, 0x91, 0x6b, 0xd5, 0x61, 0x7d, 0x58, 0x96, 0x94, 0xcd, 0xe8, 0x1c, 0xba, 0x63, 0xe0, 0x5e,
+      } },
+    { "key 2, r bit flip", 0,
+      {
+        0xfc, 0xf0, 0x65, 0x49, 0x2e, 0xb8, 0x30, 0xc9, 0xcb, 0xdc, 0x46, 0xa7, 0xbd, 0x5c, 0xf2, 0x99,
+        0x37, 0x24, 0x28, 0x69, 0x5e, 0xc5, 0x18, 0xe2, 0x64, 0xb8, 0x72, 0x32, 0x34, 0x87, 0x2e, 0x6f,
+        0xd4, 0xdc, 0x88, 0x3b, 0xfc, 0xf5, 0x62, 0x24, 0xe8, 0x2c, 0x9d, 0x17, 0x36, 0x7e, 0x2b, 0xbb,
+        0x67, 0xda, 0x8c, 0xf6, 0x95, 0x79, 0x7d, 0x91, 0x96, 0xea, 0xff, 0x16, 0x5f, 0x9f, 0x66, 0xe9,
+      },
+      {
+        0xd2, 0x90, 0x3b, 0xe0, 0x6c, 0x1f, 0xab, 0x6e, 0xdb, 0xdc, 0xe0, 0x08, 0x13, 0x17, 0x93, 0xf3,
+        0x52, 0x96, 0xb0, 0x77, 0x17, 0x69, 0x27, 0xe9, 0x1c, 0x7c, 0xbc, 0x9b, 0x7e, 0xe1, 0xdd, 0xb3,
+      },
+      {
+        0xf1, 0x2c, 0xc0, 0x58, 0x90, 0x4a, 0xa9, 0x0e, 0x99, 0x4f, 0xcc, 0x9c, 0x55, 0x3c, 0x3f, 0x47,
+        0xeb, 0x3b, 0xf7, 0x9f, 0xb0, 0x2e, 0x13, 0x40, 0x31, 0xa0, 0x56, 0x33, 0x73, 0x62, 0x53, 0xbe,
+        0x6c, 0xec, 0x4a, 0x7a, 0x9f, 0x15, 0x3d, 0x46, 0x71, 0xe7, 0xcd, 0xd7, 0x0d, 0x2e, 0x97, 0x84,
+        0x9a, 0x91, 0x6b, 0xd5, 0x61, 0x7d, 0x58, 0x96, 0x94, 0xcd, 0xe8, 0x1c, 0xba, 0x63, 0xe0, 0x5e,
+      } },
+    { "key 2, s bit flip", 0,
+      {
+        0xfc, 0xf0, 0x65, 0x49, 0x2e, 0xb8, 0x30, 0xc9, 0xcb, 0xdc, 0x46, 0xa7, 0xbd, 0x5c, 0xf2, 0x99,
+        0x37, 0x24, 0x28, 0x69, 0x5e, 0xc5, 0x18, 0xe2, 0x64, 0xb8, 0x72, 0x32, 0x34, 0x87, 0x2e, 0x6f,
+        0xd4, 0xdc, 0x88, 0x3b, 0xfc, 0xf5, 0x62, 0x24, 0xe8, 0x2c, 0x9d, 0x17, 0x36, 0x7e, 0x2b, 0xbb,
+        0x67, 0xda, 0x8c, 0xf6, 0x95, 0x79, 0x7d, 0x91, 0x96, 0xea, 0xff, 0x16, 0x5f, 0x9f, 0x66, 0xe9,
+      },
+      {
+        0xd2, 0x90, 0x3b, 0xe0, 0x6c, 0x1f, 0xab, 0x6e, 0xdb, 0xdc, 0xe0, 0x08, 0x13, 0x17, 0x93, 0xf3,
+        0x52, 0x96, 0xb0, 0x77, 0x17, 0x69, 0x27, 0xe9, 0x1c, 0x7c, 0xbc, 0x9b, 0x7e, 0xe1, 0xdd, 0xb3,
+      },
+      {
+        0xf1, 0x2c, 0xc0, 0x58, 0x90, 0x4a, 0xa9, 0x0e, 0x99, 0x4f, 0xcc, 0x9c, 0x55, 0x3c, 0x3f, 0x47,
+        0xeb, 0x3b, 0xd7, 0x9f, 0xb0, 0x2e, 0x13, 0x40, 0x31, 0xa0, 0x56, 0x33, 0x73, 0x62, 0x53, 0xbe,
+        0x6c, 0xfc, 0x4a, 0x7a, 0x9f, 0x15, 0x3d, 0x46, 0x71, 0xe7, 0xcd, 0xd7, 0x0d, 0x2e, 0x97, 0x84,
+        0x9a, 0x91, 0x6b, 0xd5, 0x61, 0x7d, 0x58, 0x96, 0x94, 0xcd, 0xe8, 0x1c, 0xba, 0x63, 0xe0, 0x5e,
+      } },
+    { "key 2, message bit flip", 0,
+      {
+        0xfc, 0xf0, 0x65, 0x49, 0x2e, 0xb8, 0x30, 0xc9, 0xcb, 0xdc, 0x46, 0xa7, 0xbd, 0x5c, 0xf2, 0x99,
+        0x37, 0x24, 0x28, 0x69, 0x5e, 0xc5, 0x18, 0xe2, 0x64, 0xb8, 0x72, 0x32, 0x34, 0x87, 0x2e, 0x6f,
+        0xd4, 0xdc, 0x88, 0x3b, 0xfc, 0xf5, 0x62, 0x24, 0xe8, 0x2c, 0x9d, 0x17, 0x36, 0x7e, 0x2b, 0xbb,
+        0x67, 0xda, 0x8c, 0xf6, 0x95, 0x79, 0x7d, 0x91, 0x96, 0xea, 0xff, 0x16, 0x5f, 0x9f, 0x66, 0xe9,
+      },
+      {
+        0x06, 0x82, 0x62, 0xda, 0x78, 0x5f, 0x2a, 0x78, 0x67, 0xed, 0xc0, 0xbb, 0xdc, 0xbe, 0x80, 0x80,
+        0x3b, 0x0d, 0xda, 0x85, 0x77, 0x93, 0x0f, 0xb3, 0x59, 0x09, 0xdf, 0x4d, 0x0e, 0x59, 0x95, 0x82,
+      },
+      {
+        0xf1, 0x2c, 0xc0, 0x58, 0x90, 0x4a, 0xa9, 0x0e, 0x99, 0x4f, 0xcc, 0x9c, 0x55, 0x3c, 0x3f, 0x47,
+        0xeb, 0x3b, 0xd7, 0x9f, 0xb0, 0x2e, 0x13, 0x40, 0x31, 0xa0, 0x56, 0x33, 0x73, 0x62, 0x53, 0xbe,
+        0x6c, 0xec, 0x4a, 0x7a, 0x9f, 0x15, 0x3d, 0x46, 0x71, 0xe7, 0xcd, 0xd7, 0x0d, 0x2e, 0x97, 0x84,
+        0x9a, 0x91, 0x6b, 0xd5, 0x61, 0x7d, 0x58, 0x96, 0x94, 0xcd, 0xe8, 0x1c, 0xba, 0x63, 0xe0, 0x5e,
+      } },
+    { "key 2, wrong key", 0,
+      {
+        0x39, 0x35, 0x1b, 0x93, 0x31, 0x86, 0x01, 0x8c, 0x34, 0xc8, 0xcd, 0x4b, 0x55, 0x40, 0x35, 0x6e,
+        0x27, 0xa5, 0x6a, 0x41, 0xc2, 0x14, 0x9e, 0x20, 0xc6, 0x2b, 0xba, 0x73, 0x52, 0x6e, 0x17, 0xec,
+        0xd7, 0x1d, 0x66, 0x3f, 0xc4, 0x5b, 0xa1, 0xd6, 0x87, 0xbd, 0xf7, 0x53, 0x65, 0x86, 0x72, 0xb4,
+        0x59, 0x0a, 0xea, 0xde, 0xca, 0x7a, 0x79, 0x9e, 0x4b, 0xc5, 0xbe, 0xd9, 0xca, 0xbe, 0x6e, 0x6e,
+      },
+      {
+        0xd2, 0x90, 0x3b, 0xe0, 0x6c, 0x1f, 0xab, 0x6e, 0xdb, 0xdc, 0xe0, 0x08, 0x13, 0x17, 0x93, 0xf3,
+        0x52, 0x96, 0xb0, 0x77, 0x17, 0x69, 0x27, 0xe9, 0x1c, 0x7c, 0xbc, 0x9b, 0x7e, 0xe1, 0xdd, 0xb3,
+      },
+      {
+        0xf1, 0x2c, 0xc0, 0x58, 0x90, 0x4a, 0xa9, 0x0e, 0x99, 0x4f, 0xcc, 0x9c, 0x55, 0x3c, 0x3f, 0x47,
+        0xeb, 0x3b, 0xd7, 0x9f, 0xb0, 0x2e, 0x13, 0x40, 0x31, 0xa0, 0x56, 0x33, 0x73, 0x62, 0x53, 0xbe,
+        0x6c, 0xec, 0x4a, 0x7a, 0x9f, 0x15, 0x3d, 0x46, 0x71, 0xe7, 0xcd, 0xd7, 0x0d, 0x2e, 0x97, 0x84,
+        0x9a, 0x91, 0x6b, 0xd5, 0x61, 0x7d, 0x58, 0x96, 0x94, 0xcd, 0xe8, 0x1c, 0xba, 0x63, 0xe0, 0x5e,
+      } },
+    { "key 2 msg 1", 1,
+      {
+        0xfc, 0xf0, 0x65, 0x49, 0x2e, 0xb8, 0x30, 0xc9, 0xcb, 0xdc, 0x46, 0xa7, 0xbd, 0x5c, 0xf2, 0x99,
+        0x37, 0x24, 0x28, 0x69, 0x5e, 0xc5, 0x18, 0xe2, 0x64, 0xb8, 0x72, 0x32, 0x34, 0x87, 0x2e, 0x6f,
+        0xd4, 0xdc, 0x88, 0x3b, 0xfc, 0xf5, 0x62, 0x24, 0xe8, 0x2c, 0x9d, 0x17, 0x36, 0x7e, 0x2b, 0xbb,
+        0x67, 0xda, 0x8c, 0xf6, 0x95, 0x79, 0x7d, 0x91, 0x96, 0xea, 0xff, 0x16, 0x5f, 0x9f, 0x66, 0xe9,
+      },
+      {
+        0x06, 0x6c, 0x2d, 0xdf, 0x27, 0x28, 0x2b, 0xca, 0x79, 0xce, 0xc9, 0xf1, 0x99, 0x27, 0x32, 0x79,
+        0x20, 0x00, 0xbc, 0xfa, 0xa5, 0x66, 0x8b, 0x0b, 0xc6, 0x17, 0xe1, 0xb0, 0x8f, 0x73, 0xba, 0x5d,
+      },
+      {
+        0xb2, 0x02, 0x57, 0xbb, 0xd7, 0x52, 0x10, 0xc5, 0x04, 0x1a, 0x1c, 0x8e, 0x3c, 0x69, 0xc3, 0x73,
+        0x5f, 0xef, 0x7c, 0x39, 0xad, 0xb3, 0x98, 0x98, 0x27, 0xa6, 0x49, 0x7b, 0xab, 0x55, 0x92, 0x8e,
+        0xaa, 0xdd, 0xa7, 0x7e, 0x36, 0x0a, 0xb8, 0x1f, 0xfa, 0x4a, 0xf1, 0x9c, 0xcf, 0xfa, 0x35, 0x77,
+        0x45, 0xc0, 0x26, 0xec, 0xfe, 0x6b, 0x05, 0x4b, 0x44, 0xec, 0xe0, 0x39, 0xfc, 0x37, 0xcc, 0xad,
+      } },
+    { "key 2 msg 2", 1,
+      {
+        0xfc, 0xf0, 0x65, 0x49, 0x2e, 0xb8, 0x30, 0xc9, 0xcb, 0xdc, 0x46, 0xa7, 0xbd, 0x5c, 0xf2, 0x99,
+        0x37, 0x24, 0x28, 0x69, 0x5e, 0xc5, 0x18, 0xe2, 0x64, 0xb8, 0x72, 0x32, 0x34, 0x87, 0x2e, 0x6f,
+        0xd4, 0xdc, 0x88, 0x3b, 0xfc, 0xf5, 0x62, 0x24, 0xe8, 0x2c, 0x9d, 0x17, 0x36, 0x7e, 0x2b, 0xbb,
+        0x67, 0xda, 0x8c, 0xf6, 0x95, 0x79, 0x7d, 0x91, 0x96, 0xea, 0xff, 0x16, 0x5f, 0x9f, 0x66, 0xe9,
+      },
+      {
+        0x38, 0x64, 0xbc, 0xb8, 0x52, 0x1c, 0xcd, 0x20, 0x34, 0x26, 0x95, 0xf3, 0x01, 0x16, 0x9a, 0xb5,
+        0x6f, 0xfc, 0xe2, 0x1b, 0x30, 0xc5, 0x3f, 0x6a, 0xde, 0x9c, 0xa9, 0x52, 0x25, 0xe2, 0x1f, 0x6d,
+      },
+      {
+        0x84, 0xd3, 0x86, 0x72, 0x1f, 0x0d, 0xd4, 0x46, 0x69, 0x21, 0x13, 0x14, 0xa0, 0x30, 0x9b, 0x7a,
+        0x2c, 0xd4, 0x2a, 0x85, 0x3e, 0xa4, 0xd9, 0x85, 0x6c, 0xe8, 0x2d, 0x5a, 0x7a, 0x25, 0x68, 0xa8,
+        0xcf, 0x41, 0x26, 0x5f, 0x20, 0xdf, 0xc4, 0x97, 0x07, 0x05, 0xb8, 0xa2, 0x1b, 0x8a, 0xd6, 0x79,
+        0x39, 0x4b, 0x38, 0x62, 0x8b, 0x8b, 0x81, 0x18, 0x30, 0xc6, 0x84, 0xc1, 0xcf, 0x0b, 0x6a, 0x0b,
+      } },
+    { "key 2 msg 3", 1,
+      {
+        0xfc, 0xf0, 0x65, 0x49, 0x2e, 0xb8, 0x30, 0xc9, 0xcb, 0xdc, 0x46, 0xa7, 0xbd, 0x5c, 0xf2, 0x99,
+        0x37, 0x24, 0x28, 0x69, 0x5e, 0xc5, 0x18, 0xe2, 0x64, 0xb8, 0x72, 0x32, 0x34, 0x87, 0x2e, 0x6f,
+        0xd4, 0xdc, 0x88, 0x3b, 0xfc, 0xf5, 0x62, 0x24, 0xe8, 0x2c, 0x9d, 0x17, 0x36, 0x7e, 0x2b, 0xbb,
+        0x67, 0xda, 0x8c, 0xf6, 0x95, 0x79, 0x7d, 0x91, 0x96, 0xea, 0xff, 0x16, 0x5f, 0x9f, 0x66, 0xe9,
+      },
+      {
+        0x35, 0x94, 0x27, 0x4e, 0x99, 0x46, 0x35, 0x2e, 0x0c, 0x1a, 0x12, 0xd7, 0x50, 0x1e, 0xb6, 0x3d,
+        0x0a, 0x4d, 0xc6, 0x52, 0xb5, 0x11, 0xc5, 0x9a, 0xe6, 0x9d, 0x01, 0x58, 0xaa, 0x47, 0x7b, 0xb1,
+      },
+      {
+        0xf2, 0x02, 0x27, 0x9a, 0xa1, 0x1e, 0x1c, 0x08, 0x02, 0xf1, 0xc7, 0xae, 0x42, 0xb2, 0xda, 0xdc,
+        0x3f, 0x21, 0x78, 0x39, 0x63, 0x78, 0xe3, 0x17, 0xac, 0x22, 0x1b, 0x34, 0x60, 0xcf, 0x9a, 0xd0,
+        0x70, 0x17, 0x20, 0x2d, 0xa4, 0x9e, 0xd6, 0x86, 0x95, 0x61, 0xa9, 0x8a, 0xbc, 0x47, 0xa7, 0xac,
+        0xce, 0xad, 0xf6, 0x9e, 0xc1, 0x18, 0x88, 0x40, 0xf2, 0x3c, 0x34, 0x81, 0x25, 0x13, 0x7a, 0x9a,
+      } },
+    { "key 3 msg 0", 1,
+      {
+        0xc5, 0x2b, 0xf9, 0x24, 0x63, 0x72, 0xfe, 0x2a, 0xe7, 0x9e, 0x13, 0x13, 0x46, 0x3c, 0x37, 0x8e,
+        0xb2, 0xd4, 0x15, 0x57, 0xb0, 0xe1, 0xe3, 0x2b, 0xc1, 0x36, 0x26, 0xc1, 0x0a, 0x3f, 0xbc, 0xdf,
+        0x1b, 0x9a, 0xd2, 0x29, 0x72, 0x8b, 0x7c, 0x7d, 0xba, 0x6d, 0xeb, 0xa7, 0xcf, 0x48, 0x78, 0xc4,
+        0xe2, 0x94, 0x2b, 0x2f, 0xaa, 0x2d, 0x2b, 0x4b, 0xa3, 0x6b, 0x87, 0xbb, 0xa6, 0x64, 0xd7, 0x29,
+      },
+      {
+        0x9b, 0xf5, 0x9d, 0x50, 0xa9, 0x37, 0xbd, 0x18, 0x86, 0xc6, 0x40, 0x4f, 0xde, 0xc6, 0xbd, 0xe7,
+        0xb8, 0x47, 0xd6, 0x37, 0xc6, 0xd8, 0xce, 0x5d, 0xa2, 0xd5, 0xef, 0x53, 0xba, 0x25, 0x59, 0x82,
+      },
+      {
+        0x39, 0xaa, 0xdf, 0xce, 0x9b, 0x8f, 0x6c, 0x07, 0x6f, 0x73, 0x94, 0x04, 0xfa, 0x7a, 0x32, 0x21,
+        0x1d, 0xef, 0xad, 0xae, 0x77, 0xb2, 0x49, 0xde, 0xbd, 0xd0, 0x85, 0x63, 0xdc, 0xcf, 0xac, 0xed,
+        0xc2, 0x85, 0x94, 0x28, 0xe5, 0xfc, 0xcc, 0xeb, 0x79, 0xd1, 0x23, 0x2e, 0x2b, 0x33, 0x9e, 0xa7,
+        0x98, 0xc5, 0x35, 0x98, 0x0d, 0x58, 0x87, 0xc8, 0x37, 0x2c, 0x9a, 0x5e, 0xaf, 0x2d, 0xa9, 0x85,
+      } },
+    { "key 3, r bit flip", 0,
+      {
+        0xc5, 0x2b, 0xf9, 0x24, 0x63, 0x72, 0xfe, 0x2a, 0xe7, 0x9e, 0x13, 0x13, 0x46, 0x3c, 0x37, 0x8e,
+        0xb2, 0xd4, 0x15, 0x57, 0xb0, 0xe1, 0xe3, 0x2b, 0xc1, 0x36, 0x26, 0xc1, 0x0a, 0x3f, 0xbc, 0xdf,
+        0x1b, 0x9a, 0xd2, 0x29, 0x72, 0x8b, 0x7c, 0x7d, 0xba, 0x6d, 0xeb, 0xa7, 0xcf, 0x48, 0x78, 0xc4,
+        0xe2, 0x94, 0x2b, 0x2f, 0xaa, 0x2d, 0x2b, 0x4b, 0xa3, 0x6b, 0x87, 0xbb, 0xa6, 0x64, 0xd7, 0x29,
+      },
+      {
+        0x9b, 0xf5, 0x9d, 0x50, 0xa9, 0x37, 0xbd, 0x18, 0x86, 0xc6, 0x40, 0x4f, 0xde, 0xc6, 0xbd, 0xe7,
+        0xb8, 0x47, 0xd6, 0x37, 0xc6, 0xd8, 0xce, 0x5d, 0xa2, 0xd5, 0xef, 0x53, 0xba, 0x25, 0x59, 0x82,
+      },
+      {
+        0x39, 0xaa, 0xdf, 0xce, 0x9b, 0x8f, 0x6c, 0x07, 0x6f, 0x73, 0x94, 0x04, 0xba, 0x7a, 0x32, 0x21,
+        0x1d, 0xef, 0xad, 0xae, 0x77, 0xb2, 0x49, 0xde, 0xbd, 0xd0, 0x85, 0x63, 0xdc, 0xcf, 0xac, 0xed,
+        0xc2, 0x85, 0x94, 0x28, 0xe5, 0xfc, 0xcc, 0xeb, 0x79, 0xd1, 0x23, 0x2e, 0x2b, 0x33, 0x9e, 0xa7,
+        0x98, 0xc5, 0x35, 0x98, 0x0d, 0x58, 0x87, 0xc8, 0x37, 0x2c, 0x9a, 0x5e, 0xaf, 0x2d, 0xa9, 0x85,
+      } },
+    { "key 3, s bit flip", 0,
+      {
+        0xc5, 0x2b, 0xf9, 0x24, 0x63, 0x72, 0xfe, 0x2a, 0xe7, 0x9e, 0x13, 0x13, 0x46, 0x3c, 0x37, 0x8e,
+        0xb2, 0xd4, 0x15, 0x57, 0xb0, 0xe1, 0xe3, 0x2b, 0xc1, 0x36, 0x26, 0xc1, 0x0a, 0x3f, 0xbc, 0xdf,
+        0x1b, 0x9a, 0xd2, 0x29, 0x72, 0x8b, 0x7c, 0x7d, 0xba, 0x6d, 0xeb, 0xa7, 0xcf, 0x48, 0x78, 0xc4,
+        0xe2, 0x94, 0x2b, 0x2f, 0xaa, 0x2d, 0x2b, 0x4b, 0xa3, 0x6b, 0x87, 0xbb, 0xa6, 0x64, 0xd7, 0x29,
+      },
+      {
+        0x9b, 0xf5, 0x9d, 0x50, 0xa9, 0x37, 0xbd, 0x18, 0x86, 0xc6, 0x40, 0x4f, 0xde, 0xc6, 0xbd, 0xe7,
+        0xb8, 0x47, 0xd6, 0x37, 0xc6, 0xd8, 0xce, 0x5d, 0xa2, 0xd5, 0xef, 0x53, 0xba, 0x25, 0x59, 0x82,
+      },
+      {
+        0x39, 0xaa, 0xdf, 0xce, 0x9b, 0x8f, 0x6c, 0x07, 0x6f, 0x73, 0x94, 0x04, 0xfa, 0x7a, 0x32, 0x21,
+        0x1d, 0xef, 0xad, 0xae, 0x77, 0xb2, 0x49, 0xde, 0xbd, 0xd0, 0x85, 0x63, 0xdc, 0xcf, 0xac, 0xed,
+        0xc2, 0x85, 0x94, 0x28, 0xe5, 0xfc, 0xcc, 0xeb, 0x79, 0xd1, 0x23, 0x2e, 0x2b, 0xb3, 0x9e, 0xa7,
+        0x98, 0xc5, 0x35, 0x98, 0x0d, 0x58, 0x87, 0xc8, 0x37, 0x2c, 0x9a, 0x5e, 0xaf, 0x2d, 0xa9, 0x85,
+      } },
+    { "key 3, message bit flip", 0,
+      {
+        0xc5, 0x2b, 0xf9, 0x24, 0x63, 0x72, 0xfe, 0x2a, 0xe7, 0x9e, 0x13, 0x13, 0x46, 0x3c, 0x37, 0x8e,
+        0xb2, 0xd4, 0x15, 0x57, 0xb0, 0xe1, 0xe3, 0x2b, 0xc1, 0x36, 0x26, 0xc1, 0x0a, 0x3f, 0xbc, 0xdf,
+        0x1b, 0x9a, 0xd2, 0x29, 0x72, 0x8b, 0x7c, 0x7d, 0xba, 0x6d, 0xeb, 0xa7, 0xcf, 0x48, 0x78, 0xc4,
+        0xe2, 0x94, 0x2b, 0x2f, 0xaa, 0x2d, 0x2b, 0x4b, 0xa3, 0x6b, 0x87, 0xbb, 0xa6, 0x64, 0xd7, 0x29,
+      },
+      {
+        0x99, 0x11, 0xc0, 0xe6, 0x31, 0xcd, 0xa8, 0xae, 0xd0, 0x82, 0x7e, 0x50, 0xdf, 0xa7, 0x10, 0xd3,
+        0xdb, 0x5b, 0xd8, 0x97, 0x51, 0x8a, 0x58, 0x98, 0xb7, 0xf1, 0xec, 0x5d, 0x8c, 0xfe, 0x48, 0x28,
+      },
+      {
+        0x39, 0xaa, 0xdf, 0xce, 0x9b, 0x8f, 0x6c, 0x07, 0x6f, 0x73, 0x94, 0x04, 0xfa, 0x7a, 0x32, 0x21,
+        0x1d, 0xef, 0xad, 0xae, 0x77, 0xb2, 0x49, 0xde, 0xbd, 0xd0, 0x85, 0x63, 0xdc, 0xcf, 0xac, 0xed,
+        0xc2, 0x85, 0x94, 0x28, 0xe5, 0xfc, 0xcc, 0xeb, 0x79, 0xd1, 0x23, 0x2e, 0x2b, 0x33, 0x9e, 0xa7,
+        0x98, 0xc5, 0x35, 0x98, 0x0d, 0x58, 0x87, 0xc8, 0x37, 0x2c, 0x9a, 0x5e, 0xaf, 0x2d, 0xa9, 0x85,
+      } },
+    { "key 3, wrong key", 0,
+      {
+        0xdd, 0x2a, 0x39, 0x2b, 0x9d, 0x76, 0x3d, 0xc3, 0x4e, 0x67, 0xe6, 0x02, 0x8e, 0xba, 0x99, 0x3e,
+        0xa3, 0xa5, 0x5f, 0x8a, 0x18, 0xae, 0x53, 0x13, 0x2e, 0x9e, 0x7a, 0xb3, 0x8a, 0x4c, 0xe7, 0x90,
+        0xac, 0x65, 0xbb, 0xea, 0x72, 0x36, 0x46, 0xf1, 0xc3, 0xb7, 0x95, 0x15, 0xd4, 0x31, 0x55, 0x78,
+        0x87, 0x84, 0xa1, 0x47, 0x11, 0x52, 0xf4, 0x9a, 0x94, 0x1c, 0x87, 0xbe, 0x20, 0x0d, 0xb2, 0xa2,
+      },
+      {
+        0x9b, 0xf5, 0x9d, 0x50, 0xa9, 0x37, 0xbd, 0x18, 0x86, 0xc6, 0x40, 0x4f, 0xde, 0xc6, 0xbd, 0xe7,
+        0xb8, 0x47, 0xd6, 0x37, 0xc6, 0xd8, 0xce, 0x5d, 0xa2, 0xd5, 0xef, 0x53, 0xba, 0x25, 0x59, 0x82,
+      },
+      {
+        0x39, 0xaa, 0xdf, 0xce, 0x9b, 0x8f, 0x6c, 0x07, 0x6f, 0x73, 0x94, 0x04, 0xfa, 0x7a, 0x32, 0x21,
+        0x1d, 0xef, 0xad, 0xae, 0x77, 0xb2, 0x49, 0xde, 0xbd, 0xd0, 0x85, 0x63, 0xdc, 0xcf, 0xac, 0xed,
+        0xc2, 0x85, 0x94, 0x28, 0xe5, 0xfc, 0xcc, 0xeb, 0x79, 0xd1, 0x23, 0x2e, 0x2b, 0x33, 0x9e, 0xa7,
+        0x98, 0xc5, 0x35, 0x98, 0x0d, 0x58, 0x87, 0xc8, 0x37, 0x2c, 0x9a, 0x5e, 0xaf, 0x2d, 0xa9, 0x85,
+      } },
+    { "key 3 msg 1", 1,
+      {
+        0xc5, 0x2b, 0xf9, 0x24, 0x63, 0x72, 0xfe, 0x2a, 0xe7, 0x9e, 0x13, 0x13, 0x46, 0x3c, 0x37, 0x8e,
+        0xb2, 0xd4, 0x15, 0x57, 0xb0, 0xe1, 0xe3, 0x2b, 0xc1, 0x36, 0x26, 0xc1, 0x0a, 0x3f, 0xbc, 0xdf,
+        0x1b, 0x9a, 0xd2, 0x29, 0x72, 0x8b, 0x7c, 0x7d, 0xba, 0x6d, 0xeb, 0xa7, 0xcf, 0x48, 0x78, 0xc4,
+        0xe2, 0x94, 0x2b, 0x2f, 0xaa, 0x2d, 0x2b, 0x4b, 0xa3, 0x6b, 0x87, 0xbb, 0xa6, 0x64, 0xd7, 0x29,
+      },
+      {
+        0x2c, 0x60, 0xcf, 0x6f, 0x5f, 0xbb, 0xad, 0x9b, 0x33, 0x3b, 0x22, 0x1d, 0x1d, 0xde, 0x3a, 0x21,
+        0xac, 0x5d, 0x57, 0xaf, 0xa3, 0xd8, 0x49, 0x58, 0xc1, 0xed, 0x7c, 0x8f, 0x9e, 0xf1, 0x3c, 0x62,
+      },
+      {
+        0x9a, 0x66, 0x11, 0x26, 0xa4, 0x0a, 0x8a, 0x28, 0x23, 0x9e, 0xa5, 0x86, 0x62, 0x70, 0xc3, 0x4d,
+        0x2b, 0x18, 0xd5, 0xf5, 0x15, 0x58, 0xd7, 0x5c, 0xb8, 0xc1, 0x36, 0x3a, 0x6b, 0xc6, 0x0e, 0x28,
+        0xa8, 0x4b, 0xda, 0x76, 0x4a, 0xa2, 0x5b, 0x73, 0x69, 0x8f, 0xcc, 0xcd, 0x2c, 0xbc, 0xf5, 0xc5,
+        0x95, 0xea, 0x26, 0x46, 0x52, 0x19, 0x0f, 0x79, 0x22, 0x05, 0xc2, 0xd9, 0xe8, 0x77, 0xd7, 0x39,
+      } },
+    { "key 3 msg 2", 1,
+      {
+        0xc5, 0x2b, 0xf9, 0x24, 0x63, 0x72, 0xfe, 0x2a, 0xe7, 0x9e, 0x13, 0x13, 0x46, 0x3c, 0x37, 0x8e,
+        0xb2, 0xd4, 0x15, 0x57, 0xb0, 0xe1, 0xe3, 0x2b, 0xc1, 0x36, 0x26, 0xc1, 0x0a, 0x3f, 0xbc, 0xdf,
+        0x1b, 0x9a, 0xd2, 0x29, 0x72, 0x8b, 0x7c, 0x7d, 0xba, 0x6d, 0xeb, 0xa7, 0xcf, 0x48, 0x78, 0xc4,
+        0xe2, 0x94, 0x2b, 0x2f, 0xaa, 0x2d, 0x2b, 0x4b, 0xa3, 0x6b, 0x87, 0xbb, 0xa6, 0x64, 0xd7, 0x29,
+      },
+      {
+        0x8f, 0x7c, 0x76, 0x83, 0xa1, 0x02, 0xa4, 0x03, 0x77, 0xf8, 0x45, 0x4d, 0xab, 0x2a, 0x5f, 0xf1,
+        0x09, 0x06, 0xa1, 0x3f, 0x8d, 0x8e, 0x4c, 0x97, 0x84, 0xef, 0xfe, 0x76, 0xe0, 0xd6, 0x9f, 0x20,
+      },
+      {
+        0xfe, 0xf0, 0xad, 0xe2, 0xab, 0xb3, 0x59, 0x64, 0x99, 0xcb, 0x8c, 0x69, 0x5e, 0xd6, 0x50, 0xa0,
+        0x6e, 0x92, 0x1b, 0xd5, 0xdb, 0x20, 0xbb, 0xf9, 0xa7, 0x1d, 0xae, 0x83, 0x8d, 0x85, 0x06, 0x09,
+        0x6e, 0x28, 0x3b, 0xf7, 0xcd, 0x00, 0xe3, 0x34, 0xea, 0x0e, 0xa2, 0x07, 0xbf, 0xf9, 0x34, 0x2c,
+        0x5a, 0xb0, 0xf0, 0x2b, 0x06, 0x45, 0x34, 0xfb, 0x09, 0x8e, 0x89, 0x1b, 0x77, 0xd6, 0x81, 0xb4,
+      } },
+    { "key 3 msg 3", 1,
+      {
+        0xc5, 0x2b, 0xf9, 0x24, 0x63, 0x72, 0xfe, 0x2a, 0xe7, 0x9e, 0x13, 0x13, 0x46, 0x3c, 0x37, 0x8e,
+        0xb2, 0xd4, 0x15, 0x57, 0xb0, 0xe1, 0xe3, 0x2b, 0xc1, 0x36, 0x26, 0xc1, 0x0a, 0x3f, 0xbc, 0xdf,
+        0x1b, 0x9a, 0xd2, 0x29, 0x72, 0x8b, 0x7c, 0x7d, 0xba, 0x6d, 0xeb, 0xa7, 0xcf, 0x48, 0x78, 0xc4,
+        0xe2, 0x94, 0x2b, 0x2f, 0xaa, 0x2d, 0x2b, 0x4b, 0xa3, 0x6b, 0x87, 0xbb, 0xa6, 0x64, 0xd7, 0x29,
+      },
+      {
+        0x3e, 0xed, 0x7f, 0xd0, 0x7e, 0xe5, 0x34, 0xf4, 0xab, 0xfd, 0x79, 0x48, 0x67, 0x17, 0xdb, 0xea,
+        0xaf, 0xee, 0xd9, 0x87, 0x89, 0x72, 0x78, 0xba, 0x11, 0xf9, 0x09, 0x9e, 0x45, 0xae, 0x91, 0xab,
+      },
+      {
+        0xd5, 0xf9, 0x50, 0xff, 0x22, 0xf2, 0xee, 0xcc, 0x96, 0x16, 0x88, 0x9d, 0xec, 0xed, 0x9f, 0x66,
+        0x88, 0xbe, 0x11, 0x50, 0x7d, 0x2a, 0x63, 0x2b, 0x72, 0x72, 0x9b, 0x61, 0x0b, 0x7a, 0xbd, 0x95,
+        0x75, 0xfb, 0x77, 0x1b, 0x79, 0xc9, 0x82, 0x0e, 0x2e, 0x36, 0xc6, 0x6e, 0xd2, 0x29, 0xcf, 0x75,
+        0xfc, 0xfa, 0xac, 0x39, 0xef, 0x3a, 0x1d, 0x76, 0x13, 0xea, 0x07, 0xb2, 0x38, 0xe9, 0x72, 0xd6,
+      } },
+    { "key 4 msg 0", 1,
+      {
+        0x15, 0x11, 0xe1, 0xb3, 0x58, 0xae, 0x22, 0x40, 0xd3, 0x01, 0xa2, 0x45, 0x30, 0x49, 0xc2, 0xd9,
+        0xaf, 0x65, 0x0f, 0xb7, 0x54, 0x29, 0x2e, 0x6d, 0x32, 0x57, 0xd0, 0xce, 0x3d, 0x1e, 0x19, 0x97,
+        0x02, 0xa8, 0x14, 0x37, 0xb1, 0x92, 0x87, 0x5d, 0xed, 0x39, 0x68, 0x49, 0x5d, 0x78, 0xba, 0x7b,
+        0x51, 0x73, 0xa5, 0x69, 0x19, 0xbd, 0x06, 0x23, 0x68, 0x13, 0x1a, 0x97, 0x32, 0xe9, 0x8b, 0x7c,
+      },
+      {
+        0xc4, 0x75, 0x00, 0x58, 0x76, 0xdb, 0x07, 0x9e, 0x8d, 0x1b, 0xfa, 0x7c, 0x63, 0xbe, 0x19, 0x41,
+        0x9a, 0x16, 0xd4, 0x37, 0xc6, 0xea, 0xd3, 0xf7, 0xbc, 0x89, 0xfa, 0x66, 0xc9, 0xc4, 0x64, 0xd5,
+      },
+      {
+        0x67, 0x43, 0x06, 0xcc, 0xb4, 0xbd, 0xb3, 0xe0, 0x40, 0x48, 0xf7, 0x87, 0x55, 0x1a, 0x3c, 0x8b,
+        0x86, 0xae, 0x78, 0x88, 0x59, 0xdf, 0x1f, 0xb3, 0x72, 0x10, 0x29, 0x26, 0x09, 0xc4, 0x2d, 0x47,
+        0xf9, 0x8a, 0x93, 0xd9, 0x19, 0x07, 0x7a, 0x21, 0x32, 0x56, 0x5f, 0x36, 0x0d, 0xb4, 0x14, 0x11,
+        0x40, 0x42, 0x85, 0xab, 0x7a, 0xf4, 0x31, 0x5b, 0xfc, 0x70, 0xa8, 0xc2, 0xb1, 0xc6, 0xc2, 0x43,
+      } },
+    { "key 4, r bit flip", 0,
+      {
+        0x15, 0x11, 0xe1, 0xb3, 0x58, 0xae, 0x22, 0x40, 0xd3, 0x01, 0xa2, 0x45, 0x30, 0x49, 0xc2, 0xd9,
+        0xaf, 0x65, 0x0f, 0xb7, 0x54, 0x29, 0x2e, 0x6d, 0x32, 0x57, 0xd0, 0xce, 0x3d, 0x1e, 0x19, 0x97,
+        0x02, 0xa8, 0x14, 0x37, 0xb1, 0x92, 0x87, 0x5d, 0xed, 0x39, 0x68, 0x49, 0x5d, 0x78, 0xba, 0x7b,
+        0x51, 0x73, 0xa5, 0x69, 0x19, 0xbd, 0x06, 0x23, 0x68, 0x13, 0x1a, 0x97, 0x32, 0xe9, 0x8b, 0x7c,
+      },
+      {
+        0xc4, 0x75, 0x00, 0x58, 0x76, 0xdb, 0x07, 0x9e, 0x8d, 0x1b, 0xfa, 0x7c, 0x63, 0xbe, 0x19, 0x41,
+        0x9a, 0x16, 0xd4, 0x37, 0xc6, 0xea, 0xd3, 0xf7, 0xbc, 0x89, 0xfa, 0x66, 0xc9, 0xc4, 0x64, 0xd5,
+      },
+      {
+        0x67, 0x43, 0x06, 0xcc, 0xb4, 0xbd, 0xb3, 0xe0, 0x40, 0x48, 0xf7, 0x87, 0x54, 0x1a, 0x3c, 0x8b,
+        0x86, 0xae, 0x78, 0x88, 0x59, 0xdf, 0x1f, 0xb3, 0x72, 0x10, 0x29, 0x26, 0x09, 0xc4, 0x2d, 0x47,
+        0xf9, 0x8a, 0x93, 0xd9, 0x19, 0x07, 0x7a, 0x21, 0x32, 0x56, 0x5f, 0x36, 0x0d, 0xb4, 0x14, 0x11,
+        0x40, 0x42, 0x85, 0xab, 0x7a, 0xf4, 0x31, 0x5b, 0xfc, 0x70, 0xa8, 0xc2, 0xb1, 0xc6, 0xc2, 0x43,
+      } },
+    { "key 4, s bit flip", 0,
+      {
+        0x15, 0x11, 0xe1, 0xb3, 0x58, 0xae, 0x22, 0x40, 0xd3, 0x01, 0xa2, 0x45, 0x30, 0x49, 0xc2, 0xd9,
+        0xaf, 0x65, 0x0f, 0xb7, 0x54, 0x29, 0x2e, 0x6d, 0x32, 0x57, 0xd0, 0xce, 0x3d, 0x1e, 0x19, 0x97,
+        0x02, 0xa8, 0x14, 0x37, 0xb1, 0x92, 0x87, 0x5d, 0xed, 0x39, 0x68, 0x49, 0x5d, 0x78, 0xba, 0x7b,
+        0x51, 0x73, 0xa5, 0x69, 0x19, 0xbd, 0x06, 0x23, 0x68, 0x13, 0x1a, 0x97, 0x32, 0xe9, 0x8b, 0x7c,
+      },
+      {
+        0xc4, 0x75, 0x00, 0x58, 0x76, 0xdb, 0x07, 0x9e, 0x8d, 0x1b, 0xfa, 0x7c, 0x63, 0xbe, 0x19, 0x41,
+        0x9a, 0x16, 0xd4, 0x37, 0xc6, 0xea, 0xd3, 0xf7, 0xbc, 0x89, 0xfa, 0x66, 0xc9, 0xc4, 0x64, 0xd5,
+      },
+      {
+        0x67, 0x43, 0x06, 0xcc, 0xb4, 0xbd, 0xb3, 0xe0, 0x40, 0x48, 0xf7, 0x87, 0x55, 0x1a, 0x3c, 0x8b,
+        0x86, 0xae, 0x78, 0x88, 0x59, 0xdf, 0x1f, 0xb3, 0x72, 0x10, 0x29, 0x26, 0x09, 0xc4, 0x2d, 0x47,
+        0xf9, 0x8a, 0x93, 0xd9, 0x39, 0x07, 0x7a, 0x21, 0x32, 0x56, 0x5f, 0x36, 0x0d, 0xb4, 0x14, 0x11,
+        0x40, 0x42, 0x85, 0xab, 0x7a, 0xf4, 0x31, 0x5b, 0xfc, 0x70, 0xa8, 0xc2, 0xb1, 0xc6, 0xc2, 0x43,
+      } },
+    { "key 4, message bit flip", 0,
+      {
+        0x15, 0x11, 0xe1, 0xb3, 0x58, 0xae, 0x22, 0x40, 0xd3, 0x01, 0xa2, 0x45, 0x30, 0x49, 0xc2, 0xd9,
+        0xaf, 0x65, 0x0f, 0xb7, 0x54, 0x29, 0x2e, 0x6d, 0x32, 0x57, 0xd0, 0xce, 0x3d, 0x1e, 0x19, 0x97,
+        0x02, 0xa8, 0x14, 0x37, 0xb1, 0x92, 0x87, 0x5d, 0xed, 0x39, 0x68, 0x49, 0x5d, 0x78, 0xba, 0x7b,
+        0x51, 0x73, 0xa5, 0x69, 0x19, 0xbd, 0x06, 0x23, 0x68, 0x13, 0x1a, 0x97, 0x32, 0xe9, 0x8b, 0x7c,
+      },
+      {
+        0x99, 0x47, 0x0e, 0xb0, 0x4b, 0x1d, 0xbd, 0xf2, 0x24, 0xcf, 0x7f, 0x23, 0x15, 0x0c, 0x4e, 0x5d,
+        0x40, 0x5e, 0xf1, 0xe6, 0x51, 0x83, 0x3e, 0x0b, 0x86, 0xe5, 0x08, 0xe7, 0xd3, 0x0d, 0x42, 0x7e,
+      },
+      {
+        0x67, 0x43, 0x06, 0xcc, 0xb4, 0xbd, 0xb3, 0xe0, 0x40, 0x48, 0xf7, 0x87, 0x55, 0x1a, 0x3c, 0x8b,
+        0x86, 0xae, 0x78, 0x88, 0x59, 0xdf, 0x1f, 0xb3, 0x72, 0x10, 0x29, 0x26, 0x09, 0xc4, 0x2d, 0x47,
+        0xf9, 0x8a, 0x93, 0xd9, 0x19, 0x07, 0x7a, 0x21, 0x32, 0x56, 0x5f, 0x36, 0x0d, 0xb4, 0x14, 0x11,
+        0x40, 0x42, 0x85, 0xab, 0x7a, 0xf4, 0x31, 0x5b, 0xfc, 0x70, 0xa8, 0xc2, 0xb1, 0xc6, 0xc2, 0x43,
+      } },
+    { "key 4, wrong key", 0,
+      {
+        0x02, 0xe3, 0x2a, 0xf0, 0x2a, 0x6d, 0xdb, 0xa4, 0x7b, 0x97, 0xaf, 0x2d, 0xef, 0x0a, 0x5b, 0x07,
+        0x70, 0x4a, 0xae, 0x8a, 0xc2, 0x3c, 0x9c, 0xb9, 0x98, 0xf1, 0x8d, 0xeb, 0x34, 0x75, 0x1f, 0x0b,
+        0xee, 0xff, 0xc8, 0x5a, 0xc6, 0x8d, 0x1b, 0x88, 0xf0, 0x78, 0xa1, 0xe4, 0x17, 0x7f, 0x3b, 0x33,
+        0x60, 0x00, 0xf1, 0xd8, 0x68, 0x66, 0xe5, 0x68, 0x14, 0x1a, 0x3b, 0x54, 0xd8, 0xa6, 0x2d, 0xa4,
+      },
+      {
+        0xc4, 0x75, 0x00, 0x58, 0x76, 0xdb, 0x07, 0x9e, 0x8d, 0x1b, 0xfa, 0x7c, 0x63, 0xbe, 0x19, 0x41,
+        0x9a, 0x16, 0xd4, 0x37, 0xc6, 0xea, 0xd3, 0xf7, 0xbc, 0x89, 0xfa, 0x66, 0xc9, 0xc4, 0x64, 0xd5,
+      },
+      {
+        0x67, 0x43, 0x06, 0xcc, 0xb4, 0xbd, 0xb3, 0xe0, 0x40, 0x48, 0xf7, 0x87, 0x55, 0x1a, 0x3c, 0x8b,
+        0x86, 0xae, 0x78, 0x88, 0x59, 0xdf, 0x1f, 0xb3, 0x72, 0x10, 0x29, 0x26, 0x09, 0xc4, 0x2d, 0x47,
+        0xf9, 0x8a, 0x93, 0xd9, 0x19, 0x07, 0x7a, 0x21, 0x32, 0x56, 0x5f, 0x36, 0x0d, 0xb4, 0x14, 0x11,
+        0x40, 0x42, 0x85, 0xab, 0x7a, 0xf4, 0x31, 0x5b, 0xfc, 0x70, 0xa8, 0xc2, 0xb1, 0xc6, 0xc2, 0x43,
+      } },
+    { "key 4 msg 1", 1,
+      {
+        0x15, 0x11, 0xe1, 0xb3, 0x58, 0xae, 0x22, 0x40, 0xd3, 0x01, 0xa2, 0x45, 0x30, 0x49, 0xc2, 0xd9,
+        0xaf, 0x65, 0x0f, 0xb7, 0x54, 0x29, 0x2e, 0x6d, 0x32, 0x57, 0xd0, 0xce, 0x3d, 0x1e, 0x19, 0x97,
+        0x02, 0xa8, 0x14, 0x37, 0xb1, 0x92, 0x87, 0x5d, 0xed, 0x39, 0x68, 0x49, 0x5d, 0x78, 0xba, 0x7b,
+        0x51, 0x73, 0xa5, 0x69, 0x19, 0xbd, 0x06, 0x23, 0x68, 0x13, 0x1a, 0x97, 0x32, 0xe9, 0x8b, 0x7c,
+      },
+      {
+        0x3e, 0xfb, 0x85, 0x54, 0xc0, 0x23, 0x4e, 0xbb, 0x85, 0x59, 0xdd, 0xf8, 0x6b, 0xbf, 0xd9, 0x3c,
+        0xe8, 0xd1, 0x5f, 0x44, 0x46, 0x1a, 0xed, 0xf0, 0x3d, 0xb9, 0x15, 0xc8, 0x2a, 0xbe, 0x9c, 0x53,
+      },
+      {
+        0x68, 0x82, 0xc6, 0x3d, 0xce, 0x60, 0x3a, 0x4f, 0xc3, 0x9a, 0xd3, 0xa4, 0x25, 0x73, 0xa5, 0x5e,
+        0xbf, 0x26, 0x26, 0x87, 0xe8, 0x0a, 0x62, 0xd9, 0x5b, 0xfe, 0x42, 0x9a, 0x5e, 0x6e, 0xc3, 0xe9,
+        0xa6, 0x08, 0xbd, 0x57, 0xb4, 0x23, 0x20, 0x13, 0xbe, 0xd5, 0x43, 0x72, 0xb3, 0xe6, 0x8a, 0x87,
+        0xed, 0xe5, 0xbf, 0x83, 0x99, 0x80, 0x3c, 0x4e, 0x47, 0xa1, 0xc3, 0xbf, 0x41, 0xa4, 0xc2, 0x49,
+      } },
+    { "key 4 msg 2", 1,
+      {
+        0x15, 0x11, 0xe1, 0xb3, 0x58, 0xae, 0x22, 0x40, 0xd3, 0x01, 0xa2, 0x45, 0x30, 0x49, 0xc2, 0xd9,
+        0xaf, 0x65, 0x0f, 0xb7, 0x54, 0x29, 0x2e, 0x6d, 0x32, 0x57, 0xd0, 0xce, 0x3d, 0x1e, 0x19, 0x97,
+        0x02, 0xa8, 0x14, 0x37, 0xb1, 0x92, 0x87, 0x5d, 0xed, 0x39, 0x68, 0x49, 0x5d, 0x78, 0xba, 0x7b,
+        0x51, 0x73, 0xa5, 0x69, 0x19, 0xbd, 0x06, 0x23, 0x68, 0x13, 0x1a, 0x97, 0x32, 0xe9, 0x8b, 0x7c,
+      },
+      {
+        0xf8, 0xd6, 0xe5, 0x70, 0x1f, 0x3a, 0x2a, 0x21, 0x24, 0x3a, 0xe1, 0x07, 0x75, 0xaf, 0xf3, 0x28,
+        0x0f, 0x4c, 0xb2, 0x20, 0x1d, 0x9f, 0x0a, 0xe0, 0xf7, 0xda, 0xf8, 0xaf, 0xc1, 0x93, 0xc0, 0x8b,
+      },
+      {
+        0x42, 0x00, 0xfc, 0x6a, 0xe4, 0xbd, 0x4c, 0xc0, 0xd3, 0xc7, 0x15, 0x2c, 0x4f, 0xf7, 0x66, 0x1c,
+        0xad, 0xf5, 0x6b, 0x13, 0x6c, 0xd9, 0x07, 0xf7, 0x9d, 0x3d, 0x6f, 0xfa, 0x31, 0xf8, 0xa9, 0x90,
+        0x82, 0xf4, 0x67, 0xb2, 0x97, 0x98, 0x98, 0x6c, 0x3a, 0xdc, 0x64, 0x69, 0xa1, 0xb9, 0xac, 0x53,
+        0xac, 0x40, 0x8e, 0x9b, 0x82, 0x20, 0x36, 0x18, 0xb3, 0x69, 0xd6, 0xa1, 0x7a, 0xfb, 0xf6, 0x54,
+      } },
+    { "key 4 msg 3", 1,
+      {
+        0x15, 0x11, 0xe1, 0xb3, 0x58, 0xae, 0x22, 0x40, 0xd3, 0x01, 0xa2, 0x45, 0x30, 0x49, 0xc2, 0xd9,
+        0xaf, 0x65, 0x0f, 0xb7, 0x54, 0x29, 0x2e, 0x6d, 0x32, 0x57, 0xd0, 0xce, 0x3d, 0x1e, 0x19, 0x97,
+        0x02, 0xa8, 0x14, 0x37, 0xb1, 0x92, 0x87, 0x5d, 0xed, 0x39, 0x68, 0x49, 0x5d, 0x78, 0xba, 0x7b,
+        0x51, 0x73, 0xa5, 0x69, 0x19, 0xbd, 0x06, 0x23, 0x68, 0x13, 0x1a, 0x97, 0x32, 0xe9, 0x8b, 0x7c,
+      },
+      {
+        0xca, 0xda, 0xcd, 0x64, 0x15, 0x6b, 0xa4, 0x6b, 0x95, 0xb5, 0xc2, 0xb4, 0x7f, 0xe6, 0xfb, 0x8f,
+        0xf0, 0x14, 0x81, 0xfd, 0xa1, 0x14, 0xea, 0x0c, 0x45, 0x0c, 0x38, 0xd7, 0x8c, 0x02, 0x3d, 0x34,
+      },
+      {
+        0xde, 0x0b, 0xa6, 0xa9, 0xd4, 0x2c, 0x2c, 0xc8, 0x3a, 0xe1, 0xa0, 0x4d, 0x43, 0x29, 0x21, 0xf9,
+        0xc0, 0x4d, 0xfb, 0xff, 0x72, 0x5a, 0x07, 0x0a, 0x99, 0x57, 0xea, 0x92, 0xfb, 0x6b, 0x20, 0x54,
+        0x43, 0x8d, 0x61, 0xaf, 0x2f, 0xab, 0xa7, 0x75, 0xc0, 0x87, 0xaf, 0x8f, 0x86, 0x17, 0xf0, 0xec,
+        0xd3, 0xaf, 0x4c, 0x39, 0xf1, 0x64, 0x85, 0xd8, 0xac, 0x51, 0x2d, 0x07, 0xc5, 0xc3, 0x1e, 0x41,
+      } },
+    { "key 5 msg 0", 1,
+      {
+        0x1b, 0x1b, 0xc3, 0xc8, 0xd2, 0x64, 0xa7, 0xca, 0x98, 0xa8, 0x2d, 0x91, 0x7a, 0x69, 0xc0, 0xce,
+        0x48, 0x20, 0x23, 0x6b, 0x8d, 0x25, 0xea, 0xe1, 0x2e, 0xcc, 0x88, 0xa9, 0x0e, 0x0c, 0x29, 0x49,
+        0x2f, 0x37, 0x47, 0x3c, 0x6d, 0x44, 0x6d, 0xa0, 0x63, 0xc6, 0x1a, 0xbf, 0xe5, 0x65, 0xb9, 0x75,
+        0x46, 0x49, 0x0e, 0xa8, 0xc9, 0xd9, 0xa0, 0x06, 0x3d, 0x33, 0xa0, 0x83, 0x6f, 0x58, 0x6d, 0x9a,
+      },
+      {
+        0x41, 0x68, 0x57, 0x98, 0xbb, 0x05, 0x8a, 0xaf, 0x50, 0x2d, 0xc6, 0x41, 0x7b, 0x97, 0x1b, 0xff,
+        0xd4, 0x6d, 0xd6, 0x3d, 0x7c, 0x18, 0x17, 0x23, 0x35, 0x74, 0xae, 0x62, 0x2b, 0x75, 0x05, 0x4a,
+      },
+      {
+        0x49, 0x44, 0x16, 0xdf, 0x72, 0xe4, 0x09, 0x08, 0x3f, 0x29, 0xc9, 0x14, 0xe5, 0x19, 0x63, 0xc4,
+        0x22, 0xb1, 0x32, 0x57, 0xa9, 0xb2, 0x80, 0xe7, 0xcf, 0xe2, 0xd2, 0x80, 0x9c, 0x71, 0x2d, 0x9d,
+        0xda, 0x64, 0xfe, 0x09, 0x58, 0x0f, 0xa8, 0xd4, 0x1b, 0x31, 0x63, 0x68, 0x0b, 0x6f, 0x61, 0xad,
+        0x1a, 0x36, 0xe1, 0x21, 0x52, 0x4d, 0xad, 0xab, 0x91, 0x59, 0x47, 0x62, 0xec, 0x8d, 0xa1, 0xeb,
+      } },
+    { "key 5, r bit flip", 0,
+      {
+        0x1b, 0x1b, 0xc3, 0xc8, 0xd2, 0x64, 0xa7, 0xca, 0x98, 0xa8, 0x2d, 0x91, 0x7a, 0x69, 0xc0, 0xce,
+        0x48, 0x20, 0x23, 0x6b, 0x8d, 0x25, 0xea, 0xe1, 0x2e, 0xcc, 0x88, 0xa9, 0x0e, 0x0c, 0x29, 0x49,
+        0x2f, 0x37, 0x47, 0x3c, 0x6d, 0x44, 0x6d, 0xa0, 0x63, 0xc6, 0x1a, 0xbf, 0xe5, 0x65, 0xb9, 0x75,
+        0x46, 0x49, 0x0e, 0xa8, 0xc9, 0xd9, 0xa0, 0x06, 0x3d, 0x33, 0xa0, 0x83, 0x6f, 0x58, 0x6d, 0x9a,
+      },
+      {
+        0x41, 0x68, 0x57, 0x98, 0xbb, 0x05, 0x8a, 0xaf, 0x50, 0x2d, 0xc6, 0x41, 0x7b, 0x97, 0x1b, 0xff,
+        0xd4, 0x6d, 0xd6, 0x3d, 0x7c, 0x18, 0x17, 0x23, 0x35, 0x74, 0xae, 0x62, 0x2b, 0x75, 0x05, 0x4a,
+      },
+      {
+        0x49, 0x44, 0x16, 0xdf, 0x72, 0xe4, 0x09, 0x08, 0x3f, 0x29, 0xc9, 0x14, 0xe5, 0x19, 0x63, 0xe4,
+        0x22, 0xb1, 0x32, 0x57, 0xa9, 0xb2, 0x80, 0xe7, 0xcf, 0xe2, 0xd2, 0x80, 0x9c, 0x71, 0x2d, 0x9d,
+        0xda, 0x64, 0xfe, 0x09, 0x58, 0x0f, 0xa8, 0xd4, 0x1b, 0x31, 0x63, 0x68, 0x0b, 0x6f, 0x61, 0xad,
+        0x1a, 0x36, 0xe1, 0x21, 0x52, 0x4d, 0xad, 0xab, 0x91, 0x59, 0x47, 0x62, 0xec, 0x8d, 0xa1, 0xeb,
+      } },
+    { "key 5, s bit flip", 0,
+      {
+        0x1b, 0x1b, 0xc3, 0xc8, 0xd2, 0x64, 0xa7, 0xca, 0x98, 0xa8, 0x2d, 0x91, 0x7a, 0x69, 0xc0, 0xce,
+        0x48, 0x20, 0x23, 0x6b, 0x8d, 0x25, 0xea, 0xe1, 0x2e, 0xcc, 0x88, 0xa9, 0x0e, 0x0c, 0x29, 0x49,
+        0x2f, 0x37, 0x47, 0x3c, 0x6d, 0x44, 0x6d, 0xa0, 0x63, 0xc6, 0x1a, 0xbf, 0xe5, 0x65, 0xb9, 0x75,
+        0x46, 0x49, 0x0e, 0xa8, 0xc9, 0xd9, 0xa0, 0x06, 0x3d, 0x33, 0xa0, 0x83, 0x6f, 0x58, 0x6d, 0x9a,
+      },
+      {
+        0x41, 0x68, 0x57, 0x98, 0xbb, 0x05, 0x8a, 0xaf, 0x50, 0x2d, 0xc6, 0x41, 0x7b, 0x97, 0x1b, 0xff,
+        0xd4, 0x6d, 0xd6, 0x3d, 0x7c, 0x18, 0x17, 0x23, 0x35, 0x74, 0xae, 0x62, 0x2b, 0x75, 0x05, 0x4a,
+      },
+      {
+        0x49, 0x44, 0x16, 0xdf, 0x72, 0xe4, 0x09, 0x08, 0x3f, 0x29, 0xc9, 0x14, 0xe5, 0x19, 0x63, 0xc4,
+        0x22, 0xb1, 0x32, 0x57, 0xa9, 0xb2, 0x80, 0xe7, 0xcf, 0xe2, 0xd2, 0x80, 0x9c, 0x71, 0x2d, 0x9d,
+        0xda, 0x64, 0xfe, 0x09, 0x58, 0x0f, 0xa8, 0xd4, 0x1b, 0x31, 0x63, 0x68, 0x0b, 0x6f, 0x61, 0xad,
+        0x1a, 0x36, 0xe1, 0x21, 0x52, 0x4d, 0x8d, 0xab, 0x91, 0x59, 0x47, 0x62, 0xec, 0x8d, 0xa1, 0xeb,
+      } },
+    { "key 5, message bit flip", 0,
+      {
+        0x1b, 0x1b, 0xc3, 0xc8, 0xd2, 0x64, 0xa7, 0xca, 0x98, 0xa8, 0x2d, 0x91, 0x7a, 0x69, 0xc0, 0xce,
+        0x48, 0x20, 0x23, 0x6b, 0x8d, 0x25, 0xea, 0xe1, 0x2e, 0xcc, 0x88, 0xa9, 0x0e, 0x0c, 0x29, 0x49,
+        0x2f, 0x37, 0x47, 0x3c, 0x6d, 0x44, 0x6d, 0xa0, 0x63, 0xc6, 0x1a, 0xbf, 0xe5, 0x65, 0xb9, 0x75,
+        0x46, 0x49, 0x0e, 0xa8, 0xc9, 0xd9, 0xa0, 0x06, 0x3d, 0x33, 0xa0, 0x83, 0x6f, 0x58, 0x6d, 0x9a,
+      },
+      {
+        0x64, 0x70, 0x2a, 0x1f, 0x8e, 0x8e, 0x7a, 0xbe, 0xe5, 0x18, 0xf6, 0xce, 0xd1, 0xe7, 0xe7, 0xb8,
+        0x33, 0x74, 0xcb, 0x52, 0x7e, 0x29, 0xb4, 0x84, 0x88, 0x92, 0x0e, 0xf0, 0x2a, 0x6a, 0x8e, 0x15,
+      },
+      {
+        0x49, 0x44, 0x16, 0xdf, 0x72, 0xe4, 0x09, 0x08, 0x3f, 0x29, 0xc9, 0x14, 0xe5, 0x19, 0x63, 0xc4,
+        0x22, 0xb1, 0x32, 0x57, 0xa9, 0xb2, 0x80, 0xe7, 0xcf, 0xe2, 0xd2, 0x80, 0x9c, 0x71, 0x2d, 0x9d,
+        0xda, 0x64, 0xfe, 0x09, 0x58, 0x0f, 0xa8, 0xd4, 0x1b, 0x31, 0x63, 0x68, 0x0b, 0x6f, 0x61, 0xad,
+        0x1a, 0x36, 0xe1, 0x21, 0x52, 0x4d, 0xad, 0xab, 0x91, 0x59, 0x47, 0x62, 0xec, 0x8d, 0xa1, 0xeb,
+      } },
+    { "key 5, wrong key", 0,
+      {
+        0x5d, 0x41, 0x7c, 0x71, 0xf4, 0x4b, 0x90, 0xd6, 0x6d, 0x91, 0xa0, 0x48, 0x29, 0xbe, 0xb8, 0x47,
+        0x7e, 0x9d, 0x69, 0x0d, 0x9f, 0x3a, 0x83, 0x75, 0x27, 0x88, 0xa4, 0xe9, 0x1c, 0x11, 0x55, 0x6d,
+        0xc5, 0x9d, 0x61, 0xc7, 0xf3, 0x07, 0x54, 0x51, 0x68, 0x24, 0xae, 0x87, 0x65, 0x3c, 0xde, 0x88,
+        0x5a, 0xa7, 0xae, 0x98, 0x0b, 0xa0, 0xf7, 0x9b, 0x81, 0x84, 0xb2, 0xd5, 0x9c, 0x41, 0xca, 0x10,
+      },
+      {
+        0x41, 0x68, 0x57, 0x98, 0xbb, 0x05, 0x8a, 0xaf, 0x50, 0x2d, 0xc6, 0x41, 0x7b, 0x97, 0x1b, 0xff,
+        0xd4, 0x6d, 0xd6, 0x3d, 0x7c, 0x18, 0x17, 0x23, 0x35, 0x74, 0xae, 0x62, 0x2b, 0x75, 0x05, 0x4a,
+      },
+      {
+        0x49, 0x44, 0x16, 0xdf, 0x72, 0xe4, 0x09, 0x08, 0x3f, 0x29, 0xc9, 0x14, 0xe5, 0x19, 0x63, 0xc4,
+        0x22, 0xb1, 0x32, 0x57, 0xa9, 0xb2, 0x80, 0xe7, 0xcf, 0xe2, 0xd2, 0x80, 0x9c, 0x71, 0x2d, 0x9d,
+        0xda, 0x64, 0xfe, 0x09, 0x58, 0x0f, 0xa8, 0xd4, 0x1b, 0x31, 0x63, 0x68, 0x0b, 0x6f, 0x61, 0xad,
+        0x1a, 0x36, 0xe1, 0x21, 0x52, 0x4d, 0xad, 0xab, 0x91, 0x59, 0x47, 0x62, 0xec, 0x8d, 0xa1, 0xeb,
+      } },
+    { "key 5 msg 1", 1,
+      {
+        0x1b, 0x1b, 0xc3, 0xc8, 0xd2, 0x64, 0xa7, 0xca, 0x98, 0xa8, 0x2d, 0x91, 0x7a, 0x69, 0xc0, 0xce,
+        0x48, 0x20, 0x23, 0x6b, 0x8d, 0x25, 0xea, 0xe1, 0x2e, 0xcc, 0x88, 0xa9, 0x0e, 0x0c, 0x29, 0x49,
+        0x2f, 0x37, 0x47, 0x3c, 0x6d, 0x44, 0x6d, 0xa0, 0x63, 0xc6, 0x1a, 0xbf, 0xe5, 0x65, 0xb9, 0x75,
+        0x46, 0x49, 0x0e, 0xa8, 0xc9, 0xd9, 0xa0, 0x06, 0x3d, 0x33, 0xa0, 0x83, 0x6f, 0x58, 0x6d, 0x9a,
+      },
+      {
+        0xfc, 0xa7, 0x97, 0xd1, 0x6d, 0x5f, 0x8c, 0x3a, 0xa2, 0xd2, 0x54, 0x18, 0xd7, 0xaa, 0x82, 0x09,
+        0xa6, 0x95, 0xa4, 0xf2, 0x60, 0x00, 0xb7, 0x28, 0xa8, 0x18, 0xa7, 0x98, 0x45, 0x76, 0xd3, 0x85,
+      },
+      {
+        0xf5, 0x4b, 0x18, 0x73, 0x6f, 0x6a, 0xa8, 0xeb, 0xc3, 0x17, 0x6b, 0x35, 0x9c, 0x0e, 0x66, 0x7a,
+        0x67, 0xdf, 0x6d, 0x4d, 0xec, 0xb2, 0x0b, 0x59, 0x7b, 0x9e, 0x42, 0xe4, 0x42, 0x96, 0xd3, 0x59,
+        0x63, 0xea, 0x68, 0x52, 0x7b, 0x02, 0x2d, 0x09, 0xcd, 0x19, 0xeb, 0x40, 0x19, 0x97, 0x06, 0x59,
+        0xad, 0x45, 0x25, 0x5c, 0xdc, 0x07, 0x95, 0x58, 0x41, 0xf8, 0xeb, 0xda, 0x8b, 0x61, 0xc5, 0x5c,
+      } },
+    { "key 5 msg 2", 1,
+      {
+        0x1b, 0x1b, 0xc3, 0xc8, 0xd2, 0x64, 0xa7, 0xca, 0x98, 0xa8, 0x2d, 0x91, 0x7a, 0x69, 0xc0, 0xce,
+        0x48, 0x20, 0x23, 0x6b, 0x8d, 0x25, 0xea, 0xe1, 0x2e, 0xcc, 0x88, 0xa9, 0x0e, 0x0c, 0x29, 0x49,
+        0x2f, 0x37, 0x47, 0x3c, 0x6d, 0x44, 0x6d, 0xa0, 0x63, 0xc6, 0x1a, 0xbf, 0xe5, 0x65, 0xb9, 0x75,
+        0x46, 0x49, 0x0e, 0xa8, 0xc9, 0xd9, 0xa0, 0x06, 0x3d, 0x33, 0xa0, 0x83, 0x6f, 0x58, 0x6d, 0x9a,
+      },
+      {
+        0x0c, 0x15, 0xd8, 0x60, 0x61, 0x01, 0x08, 0x74, 0x8c, 0xa9, 0x00, 0xd1, 0x31, 0x97, 0x16, 0x10,
+        0x05, 0xfa, 0xf0, 0x10, 0xb6, 0x7f, 0x45, 0x32, 0x7f, 0xe3, 0xa0, 0x1f, 0x1b, 0xa8, 0x7a, 0x17,
+      },
+      {
+        0x55, 0x75, 0x74, 0x0e, 0xa0, 0xfc, 0x6f, 0x7f, 0x92, 0x20, 0x8c, 0x78, 0xc7, 0xc4, 0x37, 0xa4,
+        0xc0, 0x42, 0x28, 0xa9, 0x46, 0xc9, 0xeb, 0x52, 0xba, 0x42, 0x10, 0xe8, 0x42, 0xfa, 0x0b, 0x6c,
+        0x01, 0xff, 0x2e, 0xdf, 0x00, 0x1c, 0xe6, 0x94, 0x16, 0xd5, 0xb7, 0x43, 0x6b, 0x51, 0xdc, 0x29,
+        0x81, 0x93, 0x20, 0x47, 0x23, 0xe3, 0xe1, 0x7b, 0xe0, 0x89, 0xe3, 0x14, 0xac, 0x73, 0x64, 0x63,
+      } },
+    { "key 5 msg 3", 1,
+      {
+        0x1b, 0x1b, 0xc3, 0xc8, 0xd2, 0x64, 0xa7, 0xca, 0x98, 0xa8, 0x2d, 0x91, 0x7a, 0x69, 0xc0, 0xce,
+        0x48, 0x20, 0x23, 0x6b, 0x8d, 0x25, 0xea, 0xe1, 0x2e, 0xcc, 0x88, 0xa9, 0x0e, 0x0c, 0x29, 0x49,
+        0x2f, 0x37, 0x47, 0x3c, 0x6d, 0x44, 0x6d, 0xa0, 0x63, 0xc6, 0x1a, 0xbf, 0xe5, 0x65, 0xb9, 0x75,
+        0x46, 0x49, 0x0e, 0xa8, 0xc9, 0xd9, 0xa0, 0x06, 0x3d, 0x33, 0xa0, 0x83, 0x6f, 0x58, 0x6d, 0x9a,
+      },
+      {
+        0x62, 0x27, 0xb8, 0x82, 0xe0, 0x3e, 0xda, 0x19, 0x4d, 0x03, 0xbd, 0xa2, 0x94, 0x97, 0xc8, 0x4a,
+        0x45, 0xeb, 0xb7, 0x7d, 0x74, 0x82, 0x4a, 0x1a, 0x8b, 0x5f, 0x25, 0x95, 0x48, 0x53, 0x61, 0xdf,
+      },
+      {
+        0xf8, 0xcc, 0x61, 0x4f, 0x47, 0x12, 0x67, 0x95, 0x08, 0xb8, 0x5a, 0x06, 0xe1, 0xa4, 0xcc, 0x70,
+        0x8a, 0xa3, 0xb8, 0x9f, 0x2f, 0x7b, 0x2e, 0x31, 0xaf, 0x81, 0xbe, 0x7e, 0x67, 0x67, 0xf8, 0x3d,
+        0xf7, 0x6f, 0xdf, 0x4b, 0x09, 0x62, 0xa2, 0x42, 0xd1, 0xa7, 0x1a, 0xa8, 0x8f, 0x96, 0x9d, 0xcf,
+        0x0f, 0x51, 0xd3, 0xc4, 0x0a, 0xf8, 0xaf, 0x14, 0x1b, 0x7a, 0x18, 0x86, 0xcb, 0x37, 0x3e, 0xb0,
+      } },
+    { "key 6 msg 0", 1,
+      {
+        0x54, 0x39, 0x98, 0x46, 0xc4, 0xc4, 0x52, 0x8d, 0x3f, 0xcb, 0x7a, 0x34, 0xe4, 0xf1, 0xca, 0x56,
+        0xf0, 0x2a, 0xdb, 0x1a, 0xd8, 0x42, 0xa1, 0x02, 0xfa, 0xf4, 0x48, 0x39, 0x82, 0xd0, 0xc0, 0xac,
+        0xb8, 0x43, 0x20, 0xf6, 0x09, 0x75, 0x25, 0x54, 0xdf, 0x93, 0x3f, 0xdd, 0xcc, 0xa4, 0xf6, 0x20,
+        0xa0, 0xfd, 0x59, 0x70, 0x52, 0x4e, 0xd8, 0x14, 0x6d, 0x5a, 0x5f, 0x1d, 0xd7, 0x88, 0xf5, 0x92,
+      },
+      {
+        0x2d, 0x59, 0x54, 0xae, 0xc9, 0x9a, 0xd6, 0x11, 0xce, 0x86, 0xa8, 0xa0, 0x4f, 0x4e, 0x0f, 0x76,
+        0x53, 0x94, 0xb1, 0x40, 0xaa, 0xff, 0xcc, 0xf3, 0x3f, 0xc4, 0x4d, 0x48, 0xe1, 0xbe, 0x4d, 0x03,
+      },
+      {
+        0x80, 0x60, 0xb2, 0x2e, 0x5c, 0xce, 0x55, 0x16, 0x7c, 0x6c, 0x71, 0x23, 0x44, 0xd8, 0x3d, 0x6e,
+        0xd8, 0xe3, 0x3f, 0xbc, 0x8a, 0x65, 0xf7, 0xeb, 0xbd, 0x68, 0x9d, 0xbd, 0xef, 0x8e, 0xf4, 0x84,
+        0x04, 0x8d, 0xda, 0xd1, 0x06, 0x2e, 0x63, 0xac, 0x68, 0xfb, 0x95, 0xcb, 0x08, 0xb7, 0x5e, 0x08,
+        0x9d, 0x2f, 0x65, 0x26, 0x9c, 0x30, 0xa5, 0xd9, 0x9a, 0xd0, 0xbf, 0xff, 0x2e, 0xc4, 0x18, 0x06,
+      } },
+    { "key 6, r bit flip", 0,
+      {
+        0x54, 0x39, 0x98, 0x46, 0xc4, 0xc4, 0x52, 0x8d, 0x3f, 0xcb, 0x7a, 0x34, 0xe4, 0xf1, 0xca, 0x56,
+        0xf0, 0x2a, 0xdb, 0x1a, 0xd8, 0x42, 0xa1, 0x02, 0xfa, 0xf4, 0x48, 0x39, 0x82, 0xd0, 0xc0, 0xac,
+        0xb8, 0x43, 0x20, 0xf6, 0x09, 0x75, 0x25, 0x54, 0xdf, 0x93, 0x3f, 0xdd, 0xcc, 0xa4, 0xf6, 0x20,
+        0xa0, 0xfd, 0x59, 0x70, 0x52, 0x4e, 0xd8, 0x14, 0x6d, 0x5a, 0x5f, 0x1d, 0xd7, 0x88, 0xf5, 0x92,
+      },
+      {
+        0x2d, 0x59, 0x54, 0xae, 0xc9, 0x9a, 0xd6, 0x11, 0xce, 0x86, 0xa8, 0xa0, 0x4f, 0x4e, 0x0f, 0x76,
+        0x53, 0x94, 0xb1, 0x40, 0xaa, 0xff, 0xcc, 0xf3, 0x3f, 0xc4, 0x4d, 0x48, 0xe1, 0xbe, 0x4d, 0x03,
+      },
+      {
+        0x00, 0x60, 0xb2, 0x2e, 0x5c, 0xce, 0x55, 0x16, 0x7c, 0x6c, 0x71, 0x23, 0x44, 0xd8, 0x3d, 0x6e,
+        0xd8, 0xe3, 0x3f, 0xbc, 0x8a, 0x65, 0xf7, 0xeb, 0xbd, 0x68, 0x9d, 0xbd, 0xef, 0x8e, 0xf4, 0x84,
+        0x04, 0x8d, 0xda, 0xd1, 0x06, 0x2e, 0x63, 0xac, 0x68, 0xfb, 0x95, 0xcb, 0x08, 0xb7, 0x5e, 0x08,
+        0x9d, 0x2f, 0x65, 0x26, 0x9c, 0x30, 0xa5, 0xd9, 0x9a, 0xd0, 0xbf, 0xff, 0x2e, 0xc4, 0x18, 0x06,
+      } },
+    { "key 6, s bit flip", 0,
+      {
+        0x54, 0x39, 0x98, 0x46, 0xc4, 0xc4, 0x52, 0x8d, 0x3f, 0xcb, 0x7a, 0x34, 0xe4, 0xf1, 0xca, 0x56,
+        0xf0, 0x2a, 0xdb, 0x1a, 0xd8, 0x42, 0xa1, 0x02, 0xfa, 0xf4, 0x48, 0x39, 0x82, 0xd0, 0xc0, 0xac,
+        0xb8, 0x43, 0x20, 0xf6, 0x09, 0x75, 0x25, 0x54, 0xdf, 0x93, 0x3f, 0xdd, 0xcc, 0xa4, 0xf6, 0x20,
+        0xa0, 0xfd, 0x59, 0x70, 0x52, 0x4e, 0xd8, 0x14, 0x6d, 0x5a, 0x5f, 0x1d, 0xd7, 0x88, 0xf5, 0x92,
+      },
+      {
+        0x2d, 0x59, 0x54, 0xae, 0xc9, 0x9a, 0xd6, 0x11, 0xce, 0x86, 0xa8, 0xa0, 0x4f, 0x4e, 0x0f, 0x76,
+        0x53, 0x94, 0xb1, 0x40, 0xaa, 0xff, 0xcc, 0xf3, 0x3f, 0xc4, 0x4d, 0x48, 0xe1, 0xbe, 0x4d, 0x03,
+      },
+      {
+        0x80, 0x60, 0xb2, 0x2e, 0x5c, 0xce, 0x55, 0x16, 0x7c, 0x6c, 0x71, 0x23, 0x44, 0xd8, 0x3d, 0x6e,
+        0xd8, 0xe3, 0x3f, 0xbc, 0x8a, 0x65, 0xf7, 0xeb, 0xbd, 0x68, 0x9d, 0xbd, 0xef, 0x8e, 0xf4, 0x84,
+        0x04, 0x8d, 0xda, 0xd1, 0x06, 0x2e, 0x63, 0xac, 0x68, 0xfb, 0x95, 0xcb, 0x08, 0xb7, 0x5e, 0x08,
+        0x8d, 0x2f, 0x65, 0x26, 0x9c, 0x30, 0xa5, 0xd9, 0x9a, 0xd0, 0xbf, 0xff, 0x2e, 0xc4, 0x18, 0x06,
+      } },
+    { "key 6, message bit flip", 0,
+      {
+        0x54, 0x39, 0x98, 0x46, 0xc4, 0xc4, 0x52, 0x8d, 0x3f, 0xcb, 0x7a, 0x34, 0xe4, 0xf1, 0xca, 0x56,
+        0xf0, 0x2a, 0xdb, 0x1a, 0xd8, 0x42, 0xa1, 0x02, 0xfa, 0xf4, 0x48, 0x39, 0x82, 0xd0, 0xc0, 0xac,
+        0xb8, 0x43, 0x20, 0xf6, 0x09, 0x75, 0x25, 0x54, 0xdf, 0x93, 0x3f, 0xdd, 0xcc, 0xa4, 0xf6, 0x20,
+        0xa0, 0xfd, 0x59, 0x70, 0x52, 0x4e, 0xd8, 0x14, 0x6d, 0x5a, 0x5f, 0x1d, 0xd7, 0x88, 0xf5, 0x92,
+      },
+      {
+        0xf0, 0x70, 0x0c, 0x40, 0xf0, 0x94, 0x61, 0x4f, 0xb9, 0x19, 0x37, 0x73, 0x2c, 0x50, 0xfc, 0x98,
+        0xd8, 0x1b, 0x11, 0x5c, 0x7c, 0xe9, 0xaa, 0x58, 0x74, 0xeb, 0x99, 0xc7, 0x81, 0xf3, 0x40, 0x13,
+      },
+      {
+        0x80, 0x60, 0xb2, 0x2e, 0x5c, 0xce, 0x55, 0x16, 0x7c, 0x6c, 0x71, 0x23, 0x44, 0xd8, 0x3d, 0x6e,
+        0xd8, 0xe3, 0x3f, 0xbc, 0x8a, 0x65, 0xf7, 0xeb, 0xbd, 0x68, 0x9d, 0xbd, 0xef, 0x8e, 0xf4, 0x84,
+        0x04, 0x8d, 0xda, 0xd1, 0x06, 0x2e, 0x63, 0xac, 0x68, 0xfb, 0x95, 0xcb, 0x08, 0xb7, 0x5e, 0x08,
+        0x9d, 0x2f, 0x65, 0x26, 0x9c, 0x30, 0xa5, 0xd9, 0x9a, 0xd0, 0xbf, 0xff, 0x2e, 0xc4, 0x18, 0x06,
+      } },
+    { "key 6, wrong key", 0,
+      {
+        0xe3, 0x86, 0xa4, 0x38, 0xd7, 0x18, 0x1e, 0xd6, 0x73, 0x4d, 0x6d, 0x6d, 0xec, 0xcc, 0x2d, 0x94,
+        0x76, 0x3d, 0xb6, 0x7b, 0x54, 0xc1, 0x1e, 0x26, 0x16, 0x7f, 0xb0, 0x87, 0xfe, 0xfe, 0x1d, 0x99,
+        0x84, 0xd1, 0x9e, 0x66, 0x1c, 0x10, 0xa9, 0x32, 0xc6, 0xac, 0x8f, 0xd8, 0xd3, 0x8f, 0x2e, 0x65,
+        0xf2, 0xc0, 0x9a, 0xc7, 0xad, 0xb0, 0xdc, 0xe0, 0x9d, 0xa7, 0x3c, 0xf2, 0xa1, 0xdc, 0x83, 0xc1,
+      },
+      {
+        0x2d, 0x59, 0x54, 0xae, 0xc9, 0x9a, 0xd6, 0x11, 0xce, 0x86, 0xa8, 0xa0, 0x4f, 0x4e, 0x0f, 0x76,
+        0x53, 0x94, 0xb1, 0x40, 0xaa, 0xff, 0xcc, 0xf3, 0x3f, 0xc4, 0x4d, 0x48, 0xe1, 0xbe, 0x4d, 0x03,
+      },
+      {
+        0x80, 0x60, 0xb2, 0x2e, 0x5c, 0xce, 0x55, 0x16, 0x7c, 0x6c, 0x71, 0x23, 0x44, 0xd8, 0x3d, 0x6e,
+        0xd8, 0xe3, 0x3f, 0xbc, 0x8a, 0x65, 0xf7, 0xeb, 0xbd, 0x68, 0x9d, 0xbd, 0xef, 0x8e, 0xf4, 0x84,
+        0x04, 0x8d, 0xda, 0xd1, 0x06, 0x2e, 0x63, 0xac, 0x68, 0xfb, 0x95, 0xcb, 0x08, 0xb7, 0x5e, 0x08,
+        0x9d, 0x2f, 0x65, 0x26, 0x9c, 0x30, 0xa5, 0xd9, 0x9a, 0xd0, 0xbf, 0xff, 0x2e, 0xc4, 0x18, 0x06,
+      } },
+    { "key 6 msg 1", 1,
+      {
+        0x54, 0x39, 0x98, 0x46, 0xc4, 0xc4, 0x52, 0x8d, 0x3f, 0xcb, 0x7a, 0x34, 0xe4, 0xf1, 0xca, 0x56,
+        0xf0, 0x2a, 0xdb, 0x1a, 0xd8, 0x42, 0xa1, 0x02, 0xfa, 0xf4, 0x48, 0x39, 0x82, 0xd0, 0xc0, 0xac,
+        0xb8, 0x43, 0x20, 0xf6, 0x09, 0x75, 0x25, 0x54, 0xdf, 0x93, 0x3f, 0xdd, 0xcc, 0xa4, 0xf6, 0x20,
+        0xa0, 0xfd, 0x59, 0x70, 0x52, 0x4e, 0xd8, 0x14, 0x6d, 0x5a, 0x5f, 0x1d, 0xd7, 0x88, 0xf5, 0x92,
+      },
+      {
+        0xa9, 0x3c, 0xaa, 0xee, 0x01, 0xd4, 0x4a, 0x46, 0x21, 0x85, 0xce, 0x60, 0xfc, 0x24, 0x6c, 0x1b,
+        0x6f, 0x05, 0xd5, 0x89, 0x2f, 0x24, 0xe8, 0xa2, 0x8f, 0x70, 0x8a, 0x6f, 0x51, 0xb2, 0x80, 0x11,
+      },
+      {
+        0xe8, 0xb5, 0xac, 0xd5, 0xbc, 0x8d, 0xed, 0xb1, 0x6c, 0xd9, 0x40, 0xf5, 0x0c, 0xd0, 0xef, 0xa2,
+        0xd8, 0x2e, 0x9d, 0x8c, 0xfb, 0x3f, 0x7c, 0x39, 0xb8, 0x73, 0xf9, 0xb9, 0xe5, 0x6a, 0x0d, 0x6a,
+        0xb1, 0x47, 0xbf, 0xa0, 0x9e, 0xa3, 0xba, 0xa6, 0xdc, 0xd0, 0x46, 0xe3, 0xdb, 0xd4, 0xf2, 0x23,
+        0x6c, 0xd6, 0x66, 0x23, 0x9b, 0x22, 0x7e, 0x40, 0x93, 0x28, 0xf4, 0xbe, 0x6c, 0x6f, 0x9c, 0x48,
+      } },
+    { "key 6 msg 2", 1,
+      {
+        0x54, 0x39, 0x98, 0x46, 0xc4, 0xc4, 0x52, 0x8d, 0x3f, 0xcb, 0x7a, 0x34, 0xe4, 0xf1, 0xca, 0x56,
+        0xf0, 0x2a, 0xdb, 0x1a, 0xd8, 0x42, 0xa1, 0x02, 0xfa, 0xf4, 0x48, 0x39, 0x82, 0xd0, 0xc0, 0xac,
+        0xb8, 0x43, 0x20, 0xf6, 0x09, 0x75, 0x25, 0x54, 0xdf, 0x93, 0x3f, 0xdd, 0xcc, 0xa4, 0xf6, 0x20,
+        0xa0, 0xfd, 0x59, 0x70, 0x52, 0x4e, 0xd8, 0x14, 0x6d, 0x5a, 0x5f, 0x1d, 0xd7, 0x88, 0xf5, 0x92,
+      },
+      {
+        0x8c, 0x0b, 0x8a, 0x4f, 0x50, 0x0f, 0x8b, 0x59, 0x41, 0x20, 0xd9, 0xd1, 0x9a, 0x6d, 0x9b, 0x0a,
+        0xbc, 0x0e, 0x26, 0x5a, 0xd3, 0x41, 0xaf, 0x35, 0x61, 0xb2, 0x7c, 0x3d, 0xbf, 0xf8, 0x1a, 0x83,
+      },
+      {
+        0xdb, 0xc9, 0x0f, 0xb8, 0x5e, 0x20, 0xdf, 0x82, 0xe8, 0x86, 0x97, 0x34, 0x97, 0xf6, 0x7f, 0xae,
+        0xbc, 0xa5, 0xc2, 0x12, 0x29, 0xfc, 0xd9, 0xb1, 0x4b, 0xca, 0x32, 0xcd, 0xf2, 0x16, 0x2e, 0x2c,
+        0xa4, 0xf8, 0xa8, 0xf9, 0xba, 0xc2, 0x18, 0x30, 0xb6, 0xe6, 0xf8, 0x30, 0x64, 0xb8, 0x32, 0x1a,
+        0x08, 0x4c, 0xb1, 0xf8, 0x0a, 0x49, 0x1c, 0xfd, 0x58, 0x0e, 0x78, 0xa6, 0xb6, 0xd3, 0xe5, 0xbd,
+      } },
+    { "key 6 msg 3", 1,
+      {
+        0x54, 0x39, 0x98, 0x46, 0xc4, 0xc4, 0x52, 0x8d, 0x3f, 0xcb, 0x7a, 0x34, 0xe4, 0xf1, 0xca, 0x56,
+        0xf0, 0x2a, 0xdb, 0x1a, 0xd8, 0x42, 0xa1, 0x02, 0xfa, 0xf4, 0x48, 0x39, 0x82, 0xd0, 0xc0, 0xac,
+        0xb8, 0x43, 0x20, 0xf6, 0x09, 0x75, 0x25, 0x54, 0xdf, 0x93, 0x3f, 0xdd, 0xcc, 0xa4, 0xf6, 0x20,
+        0xa0, 0xfd, 0x59, 0x70, 0x52, 0x4e, 0xd8, 0x14, 0x6d, 0x5a, 0x5f, 0x1d, 0xd7, 0x88, 0xf5, 0x92,
+      },
+      {
+        0x4f, 0x63, 0x56, 0xbe, 0x9e, 0x49, 0xb5, 0xd2, 0xde, 0xb3, 0x3f, 0x34, 0xaa, 0x17, 0xdb, 0x7c,
+        0x61, 0x3d, 0x14, 0x26, 0x83, 0x11, 0x6d, 0xe8, 0x7b, 0x8b, 0xda, 0xa1, 0x8a, 0x12, 0xaf, 0x7e,
+      },
+      {
+        0x36, 0xaf, 0xbb, 0xac, 0xad, 0x92, 0x54, 0x1e, 0x8b, 0x03, 0xbf, 0x4c, 0x9b, 0x86, 0x26, 0x0f,
+        0x5c, 0x9a, 0x46, 0x74, 0x50, 0x96, 0xbb, 0xe3, 0xed, 0xb9, 0xcd, 0x9a, 0xea, 0xaa, 0x15, 0x04,
+        0x54, 0x8e, 0xba, 0xed, 0x00, 0xd6, 0x35, 0x7f, 0x86, 0x72, 0x71, 0x9f, 0xf6, 0x4c, 0xd0, 0x10,
+        0xbf, 0x6e, 0xc8, 0x57, 0xb1, 0xf6, 0x14, 0xdc, 0x6f, 0xf4, 0xbe, 0x7f, 0x46, 0x9f, 0xf0, 0x2c,
+      } },
+    { "key 7 msg 0", 1,
+      {
+        0xb8, 0x25, 0x68, 0x21, 0x8f, 0x9f, 0xd7, 0x44, 0xa8, 0x01, 0x55, 0x8d, 0x1b, 0xcf, 0x13, 0x9e,
+        0xde, 0xfe, 0x55, 0x78, 0xb7, 0xe3, 0x2e, 0x01, 0x9d, 0xab, 0xed, 0xbc, 0xc4, 0x33, 0xdd, 0x6f,
+        0xa0, 0x0f, 0x90, 0x5a, 0xa6, 0xaa, 0x8c, 0xe1, 0x2c, 0x6b, 0xde, 0x89, 0x91, 0xe5, 0xe3, 0x07,
+        0x8b, 0x18, 0x5c, 0x10, 0xed, 0xcb, 0x76, 0x56, 0xbf, 0xed, 0xd0, 0xfe, 0x67, 0xf1, 0xf4, 0xa8,
+      },
+      {
+        0xba, 0x53, 0x59, 0xca, 0x34, 0x29, 0x0d, 0xbc, 0x07, 0xa5, 0xd5, 0x66, 0xce, 0xd4, 0x4d, 0x73,
+        0x20, 0x48, 0xa2, 0x7f, 0xd7, 0x90, 0x31, 0x83, 0x78, 0xbf, 0xd9, 0x69, 0x6e, 0x26, 0x44, 0x62,
+      },
+      {
+        0x14, 0x40, 0x13, 0x7d, 0xd5, 0xbf, 0x01, 0x51, 0x6c, 0x8a, 0x25, 0x7b, 0xa7, 0x6e, 0xd7, 0x1a,
+        0x43, 0x86, 0x9a, 0x93, 0xec, 0xc9, 0x67, 0x20, 0xcd, 0x0d, 0x24, 0xfa, 0xb9, 0x7b, 0x22, 0x78,
+        0x5b, 0xe5, 0x20, 0xff, 0xde, 0x7b, 0xdb, 0xf0, 0x94, 0x89, 0x11, 0x76, 0x1a, 0x4a, 0x6f, 0x6d,
+        0x40, 0xdf, 0x73, 0x74, 0xfc, 0xaa, 0xf4, 0xad, 0x14, 0xe5, 0x33, 0x6a, 0x93, 0x97, 0x7d, 0x11,
+      } },
+    { "key 7, r bit flip", 0,
+      {
+        0xb8, 0x25, 0x68, 0x21, 0x8f, 0x9f, 0xd7, 0x44, 0xa8, 0x01, 0x55, 0x8d, 0x1b, 0xcf, 0x13, 0x9e,
+        0xde, 0xfe, 0x55, 0x78, 0xb7, 0xe3, 0x2e, 0x01, 0x9d, 0xab, 0xed, 0xbc, 0xc4, 0x33, 0xdd, 0x6f,
+        0xa0, 0x0f, 0x90, 0x5a, 0xa6, 0xaa, 0x8c, 0xe1, 0x2c, 0x6b, 0xde, 0x89, 0x91, 0xe5, 0xe3, 0x07,
+        0x8b, 0x18, 0x5c, 0x10, 0xed, 0xcb, 0x76, 0x56, 0xbf, 0xed, 0xd0, 0xfe, 0x67, 0xf1, 0xf4, 0xa8,
+      },
+      {
+        0xba, 0x53, 0x59, 0xca, 0x34, 0x29, 0x0d, 0xbc, 0x07, 0xa5, 0xd5, 0x66, 0xce, 0xd4, 0x4d, 0x73,
+        0x20, 0x48, 0xa2, 0x7f, 0xd7, 0x90, 0x31, 0x83, 0x78, 0xbf, 0xd9, 0x69, 0x6e, 0x26, 0x44, 0x62,
+      },
+      {
+        0x14, 0x40, 0x13, 0x7d, 0xd5, 0xbf, 0x01, 0x51, 0x6c, 0x8a, 0x25, 0x7b, 0xa7, 0x6e, 0xd7, 0x1a,
+        0x43, 0x86, 0x9a, 0x93, 0xec, 0xc9, 0x67, 0x20, 0xcd, 0x0d, 0x24, 0xea, 0xb9, 0x7b, 0x22, 0x78,
+        0x5b, 0xe5, 0x20, 0xff, 0xde, 0x7b, 0xdb, 0xf0, 0x94, 0x89, 0x11, 0x76, 0x1a, 0x4a, 0x6f, 0x6d,
+        0x40, 0xdf, 0x73, 0x74, 0xfc, 0xaa, 0xf4, 0xad, 0x14, 0xe5, 0x33, 0x6a, 0x93, 0x97, 0x7d, 0x11,
+      } },
+    { "key 7, s bit flip", 0,
+      {
+        0xb8, 0x25, 0x68, 0x21, 0x8f, 0x9f, 0xd7, 0x44, 0xa8, 0x01, 0x55, 0x8d, 0x1b, 0xcf, 0x13, 0x9e,
+        0xde, 0xfe, 0x55, 0x78, 0xb7, 0xe3, 0x2e, 0x01, 0x9d, 0xab, 0xed, 0xbc, 0xc4, 0x33, 0xdd, 0x6f,
+        0xa0, 0x0f, 0x90, 0x5a, 0xa6, 0xaa, 0x8c, 0xe1, 0x2c, 0x6b, 0xde, 0x89, 0x91, 0xe5, 0xe3, 0x07,
+        0x8b, 0x18, 0x5c, 0x10, 0xed, 0xcb, 0x76, 0x56, 0xbf, 0xed, 0xd0, 0xfe, 0x67, 0xf1, 0xf4, 0xa8,
+      },
+      {
+        0xba, 0x53, 0x59, 0xca, 0x34, 0x29, 0x0d, 0xbc, 0x07, 0xa5, 0xd5, 0x66, 0xce, 0xd4, 0x4d, 0x73,
+        0x20, 0x48, 0xa2, 0x7f, 0xd7, 0x90, 0x31, 0x83, 0x78, 0xbf, 0xd9, 0x69, 0x6e, 0x26, 0x44, 0x62,
+      },
+      {
+        0x14, 0x40, 0x13, 0x7d, 0xd5, 0xbf, 0x01, 0x51, 0x6c, 0x8a, 0x25, 0x7b, 0xa7, 0x6e, 0xd7, 0x1a,
+        0x43, 0x86, 0x9a, 0x93, 0xec, 0xc9, 0x67, 0x20, 0xcd, 0x0d, 0x24, 0xfa, 0xb9, 0x7b, 0x22, 0x78,
+        0x5b, 0xe5, 0x20, 0xff, 0xde, 0x7b, 0xdb, 0xf0, 0x94, 0x89, 0x11, 0x76, 0x1a, 0x4a, 0x6b, 0x6d,
+        0x40, 0xdf, 0x73, 0x74, 0xfc, 0xaa, 0xf4, 0xad, 0x14, 0xe5, 0x33, 0x6a, 0x93, 0x97, 0x7d, 0x11,
+      } },
+    { "key 7, message bit flip", 0,
+      {
+        0xb8, 0x25, 0x68, 0x21, 0x8f, 0x9f, 0xd7, 0x44, 0xa8, 0x01, 0x55, 0x8d, 0x1b, 0xcf, 0x13, 0x9e,
+        0xde, 0xfe, 0x55, 0x78, 0xb7, 0xe3, 0x2e, 0x01, 0x9d, 0xab, 0xed, 0xbc, 0xc4, 0x33, 0xdd, 0x6f,
+        0xa0, 0x0f, 0x90, 0x5a, 0xa6, 0xaa, 0x8c, 0xe1, 0x2c, 0x6b, 0xde, 0x89, 0x91, 0xe5, 0xe3, 0x07,
+        0x8b, 0x18, 0x5c, 0x10, 0xed, 0xcb, 0x76, 0x56, 0xbf, 0xed, 0xd0, 0xfe, 0x67, 0xf1, 0xf4, 0xa8,
+      },
+      {
+        0x15, 0xe5, 0x95, 0x94, 0x24, 0xa1, 0x29, 0x7b, 0x0d, 0x3a, 0x62, 0xf2, 0x7c, 0xd5, 0xe3, 0xa3,
+        0x5e, 0x40, 0x07, 0xf6, 0x48, 0x52, 0x39, 0x3a, 0x77, 0x64, 0x3c, 0xc1, 0xea, 0xe7, 0x5b, 0x84,
+      },
+      {
+        0x14, 0x40, 0x13, 0x7d, 0xd5, 0xbf, 0x01, 0x51, 0x6c, 0x8a, 0x25, 0x7b, 0xa7, 0x6e, 0xd7, 0x1a,
+        0x43, 0x86, 0x9a, 0x93, 0xec, 0xc9, 0x67, 0x20, 0xcd, 0x0d, 0x24, 0xfa, 0xb9, 0x7b, 0x22, 0x78,
+        0x5b, 0xe5, 0x20, 0xff, 0xde, 0x7b, 0xdb, 0xf0, 0x94, 0x89, 0x11, 0x76, 0x1a, 0x4a, 0x6f, 0x6d,
+        0x40, 0xdf, 0x73, 0x74, 0xfc, 0xaa, 0xf4, 0xad, 0x14, 0xe5, 0x33, 0x6a, 0x93, 0x97, 0x7d, 0x11,
+      } },
+    { "key 7, wrong key", 0,
+      {
+        0xd1, 0xc7, 0x27, 0xb1, 0x62, 0x25, 0xf1, 0x4d, 0x61, 0xfe, 0xf0, 0x36, 0x62, 0xf2, 0xbe, 0x83,
+        0x33, 0xf1, 0x6f, 0x52, 0xf1, 0x5a, 0x7b, 0x39, 0xe0, 0xa8, 0xd1, 0xa0, 0x0d, 0xea, 0x4e, 0x59,
+        0xf6, 0x4e, 0x31, 0xec, 0x9e, 0x8a, 0x12, 0x6f, 0xce, 0x3b, 0x4f, 0x4a, 0x33, 0xeb, 0xbd, 0xa6,
+        0x4e, 0x81, 0xdc, 0xa0, 0x34, 0xb5, 0x6c, 0x6b, 0xc9, 0xc1, 0x0d, 0xd3, 0x50, 0xe4, 0xd5, 0xf3,
+      },
+      {
+        0xba, 0x53, 0x59, 0xca, 0x34, 0x29, 0x0d, 0xbc, 0x07, 0xa5, 0xd5, 0x66, 0xce, 0xd4, 0x4d, 0x73,
+        0x20, 0x48, 0xa2, 0x7f, 0xd7, 0x90, 0x31, 0x83, 0x78, 0xbf, 0xd9, 0x69, 0x6e, 0x26, 0x44, 0x62,
+      },
+      {
+        0x14, 0x40, 0x13, 0x7d, 0xd5, 0xbf, 0x01, 0x51, 0x6c, 0x8a, 0x25, 0x7b, 0xa7, 0x6e, 0xd7, 0x1a,
+        0x43, 0x86, 0x9a, 0x93, 0xec, 0xc9, 0x67, 0x20, 0xcd, 0x0d, 0x24, 0xfa, 0xb9, 0x7b, 0x22, 0x78,
+        0x5b, 0xe5, 0x20, 0xff, 0xde, 0x7b, 0xdb, 0xf0, 0x94, 0x89, 0x11, 0x76, 0x1a, 0x4a, 0x6f, 0x6d,
+        0x40, 0xdf, 0x73, 0x74, 0xfc, 0xaa, 0xf4, 0xad, 0x14, 0xe5, 0x33, 0x6a, 0x93, 0x97, 0x7d, 0x11,
+      } },
+    { "key 7 msg 1", 1,
+      {
+        0xb8, 0x25, 0x68, 0x21, 0x8f, 0x9f, 0xd7, 0x44, 0xa8, 0x01, 0x55, 0x8d, 0x1b, 0xcf, 0x13, 0x9e,
+        0xde, 0xfe, 0x55, 0x78, 0xb7, 0xe3, 0x2e, 0x01, 0x9d, 0xab, 0xed, 0xbc, 0xc4, 0x33, 0xdd, 0x6f,
+        0xa0, 0x0f, 0x90, 0x5a, 0xa6, 0xaa, 0x8c, 0xe1, 0x2c, 0x6b, 0xde, 0x89, 0x91, 0xe5, 0xe3, 0x07,
+        0x8b, 0x18, 0x5c, 0x10, 0xed, 0xcb, 0x76, 0x56, 0xbf, 0xed, 0xd0, 0xfe, 0x67, 0xf1, 0xf4, 0xa8,
+      },
+      {
+        0x11, 0xb6, 0x4d, 0x44, 0x2a, 0xde, 0x9e, 0xc0, 0x70, 0xa5, 0x0b, 0x3d, 0xaf, 0xa5, 0xce, 0x97,
+        0xd8, 0x97, 0x22, 0x72, 0x7d, 0x53, 0xb0, 0xba, 0xf7, 0xbe, 0x82, 0xb8, 0x5c, 0x46, 0x6d, 0x09,
+      },
+      {
+        0x59, 0xe7, 0xaf, 0x77, 0xe0, 0x1e, 0xe0, 0x80, 0x76, 0xfc, 0xa3, 0xd9, 0x29, 0x9e, 0xac, 0xb6,
+        0xf3, 0xbe, 0xa1, 0xbe, 0x8f, 0x19, 0xe2, 0xd3, 0x3e, 0x88, 0xf7, 0x38, 0x91, 0xee, 0x62, 0xe8,
+        0x56, 0xf1, 0x29, 0x3f, 0x7d, 0x61, 0x85, 0x42, 0x70, 0xe9, 0xfb, 0x69, 0xc5, 0xf2, 0x5e, 0x17,
+        0x23, 0x33, 0x38, 0x13, 0xb2, 0x07, 0x56, 0xbe, 0x20, 0xc2, 0x31, 0xd9, 0x5b, 0xbd, 0x33, 0x28,
+      } },
+    { "key 7 msg 2", 1,
+      {
+        0xb8, 0x25, 0x68, 0x21, 0x8f, 0x9f, 0xd7, 0x44, 0xa8, 0x01, 0x55, 0x8d, 0x1b, 0xcf, 0x13, 0x9e,
+        0xde, 0xfe, 0x55, 0x78, 0xb7, 0xe3, 0x2e, 0x01, 0x9d, 0xab, 0xed, 0xbc, 0xc4, 0x33, 0xdd, 0x6f,
+        0xa0, 0x0f, 0x90, 0x5a, 0xa6, 0xaa, 0x8c, 0xe1, 0x2c, 0x6b, 0xde, 0x89, 0x91, 0xe5, 0xe3, 0x07,
+        0x8b, 0x18, 0x5c, 0x10, 0xed, 0xcb, 0x76, 0x56, 0xbf, 0xed, 0xd0, 0xfe, 0x67, 0xf1, 0xf4, 0xa8,
+      },
+      {
+        0x12, 0x76, 0xae, 0x72, 0xb1, 0xb6, 0x63, 0x83, 0x20, 0xae, 0x9b, 0x34, 0x25, 0x85, 0xe3, 0xe1,
+        0xd1, 0x7f, 0x32, 0xbd, 0xe4, 0x43, 0x86, 0x39, 0x69, 0x77, 0xe4, 0x20, 0x0d, 0x00, 0xbb, 0x51,
+      },
+      {
+        0xc1, 0x7a, 0xe4, 0xc8, 0x27, 0x1a, 0x8a, 0x75, 0x4a, 0xd5, 0x04, 0x99, 0x74, 0x36, 0xf8, 0x14,
+        0xf9, 0x64, 0x48, 0x93, 0x00, 0xac, 0xdc, 0xa5, 0x9d, 0x1a, 0x60, 0x51, 0x9f, 0x8f, 0xf5, 0x06,
+        0x02, 0xba, 0x25, 0xbd, 0x9f, 0x49, 0xc4, 0x89, 0xcc, 0xa2, 0x33, 0xd8, 0x6e, 0x93, 0x34, 0x8e,
+        0xec, 0x77, 0xde, 0x66, 0xdc, 0x8b, 0xa5, 0xeb, 0xc9, 0xa8, 0xe8, 0x7b, 0xb3, 0xcc, 0xbc, 0x01,
+      } },
+    { "key 7 msg 3", 1,
+      {
+        0xb8, 0x25, 0x68, 0x21, 0x8f, 0x9f, 0xd7, 0x44, 0xa8, 0x01, 0x55, 0x8d, 0x1b, 0xcf, 0x13, 0x9e,
+        0xde, 0xfe, 0x55, 0x78, 0xb7, 0xe3, 0x2e, 0x01, 0x9d, 0xab, 0xed, 0xbc, 0xc4, 0x33, 0xdd, 0x6f,
+        0xa0, 0x0f, 0x90, 0x5a, 0xa6, 0xaa, 0x8c, 0xe1, 0x2c, 0x6b, 0xde, 0x89, 0x91, 0xe5, 0xe3, 0x07,
+        0x8b, 0x18, 0x5c, 0x10, 0xed, 0xcb, 0x76, 0x56, 0xbf, 0xed, 0xd0, 0xfe, 0x67, 0xf1, 0xf4, 0xa8,
+      },
+      {
+        0x23, 0x6e, 0x24, 0xd1, 0x7d, 0x4f, 0x45, 0x8e, 0x5f, 0x0a, 0x37, 0xfa, 0x08, 0xee, 0xf1, 0x68,
+        0xdd, 0xfc, 0x12, 0x7b, 0x43, 0xd6, 0x3e, 0x5e, 0x2a, 0x9c, 0xf4, 0x58, 0x04, 0x92, 0x7c, 0x76,
+      },
+      {
+        0x1b, 0x18, 0xd4, 0x35, 0xb1, 0x15, 0x43, 0x96, 0x1e, 0x4f, 0xac, 0x2e, 0x64, 0x5c, 0x59, 0x2b,
+        0xea, 0x80, 0xa3, 0xe4, 0x3e, 0x7d, 0x00, 0xbb, 0xe5, 0x91, 0x07, 0xd6, 0x15, 0x89, 0xc0, 0x30,
+        0x8b, 0x08, 0x4e, 0x62, 0x76, 0x59, 0x98, 0xe4, 0x7c, 0x55, 0x8c, 0x1e, 0xd4, 0xf7, 0xf7, 0xdc,
+        0xf2, 0x59, 0x6b, 0xb5, 0x1b, 0x07, 0x49, 0xff, 0x72, 0x03, 0xaf, 0x22, 0x67, 0x3a, 0x08, 0xe5,
+      } },
+    { "q = -g", 1,
+      {
+        0x6b, 0x17, 0xd1, 0xf2, 0xe1, 0x2c, 0x42, 0x47, 0xf8, 0xbc, 0xe6, 0xe5, 0x63, 0xa4, 0x40, 0xf2,
+        0x77, 0x03, 0x7d, 0x81, 0x2d, 0xeb, 0x33, 0xa0, 0xf4, 0xa1, 0x39, 0x45, 0xd8, 0x98, 0xc2, 0x96,
+        0xb0, 0x1c, 0xbd, 0x1c, 0x01, 0xe5, 0x80, 0x65, 0x71, 0x18, 0x14, 0xb5, 0x83, 0xf0, 0x61, 0xe9,
+        0xd4, 0x31, 0xcc, 0xa9, 0x94, 0xce, 0xa1, 0x31, 0x34, 0x49, 0xbf, 0x97, 0xc8, 0x40, 0xae, 0x0a,
+      },
+      {
+        0x8d, 0x1e, 0x5c, 0x1f, 0xac, 0x07, 0x13, 0x97, 0xc0, 0xaa, 0xdc, 0xbf, 0xc8, 0xc8, 0x0b, 0x1d,
+        0x68, 0x48, 0x59, 0x12, 0xf6, 0xb5, 0x02, 0xda, 0x7c, 0xee, 0x79, 0x35, 0x64, 0xc4, 0x7f, 0xfb,
+      },
+      {
+        0x3c, 0x4a, 0x93, 0xcd, 0x2d, 0xbf, 0xa2, 0x21, 0x65, 0xc8, 0xc5, 0xf3, 0xfb, 0x85, 0x0a, 0x5a,
+        0x84, 0x03, 0x09, 0x5d, 0xc4, 0x1d, 0x7b, 0x8d, 0xa5, 0x0c, 0x46, 0x47, 0x10, 0x89, 0x56, 0x29,
+        0x73, 0x95, 0x35, 0x42, 0x1c, 0xce, 0xd8, 0x1f, 0x72, 0x24, 0xe4, 0x60, 0xf8, 0x31, 0xc8, 0xcf,
+        0xa0, 0xba, 0x67, 0xef, 0x80, 0xfc, 0xd5, 0x02, 0x1b, 0x2d, 0xa2, 0x1e, 0xf3, 0x18, 0xae, 0x22,
+      } },
+    { "q = g", 1,
+      {
+        0x6b, 0x17, 0xd1, 0xf2, 0xe1, 0x2c, 0x42, 0x47, 0xf8, 0xbc, 0xe6, 0xe5, 0x63, 0xa4, 0x40, 0xf2,
+        0x77, 0x03, 0x7d, 0x81, 0x2d, 0xeb, 0x33, 0xa0, 0xf4, 0xa1, 0x39, 0x45, 0xd8, 0x98, 0xc2, 0x96,
+        0x4f, 0xe3, 0x42, 0xe2, 0xfe, 0x1a, 0x7f, 0x9b, 0x8e, 0xe7, 0xeb, 0x4a, 0x7c, 0x0f, 0x9e, 0x16,
+        0x2b, 0xce, 0x33, 0x57, 0x6b, 0x31, 0x5e, 0xce, 0xcb, 0xb6, 0x40, 0x68, 0x37, 0xbf, 0x51, 0xf5,
+      },
+      {
+        0x8d, 0x1e, 0x5c, 0x1f, 0xac, 0x07, 0x13, 0x97, 0xc0, 0xaa, 0xdc, 0xbf, 0xc8, 0xc8, 0x0b, 0x1d,
+        0x68, 0x48, 0x59, 0x12, 0xf6, 0xb5, 0x02, 0xda, 0x7c, 0xee, 0x79, 0x35, 0x64, 0xc4, 0x7f, 0xfb,
+      },
+      {
+        0x51, 0x11, 0x83, 0x44, 0xbc, 0xb5, 0xa3, 0x37, 0xdd, 0xf0, 0x0f, 0x11, 0x69, 0xf1, 0x61, 0xec,
+        0x15, 0xf8, 0x8b, 0x0c, 0x1f, 0x4f, 0x23, 0x5c, 0xb2, 0x66, 0xdb, 0x24, 0x42, 0x2b, 0x50, 0x0e,
+        0x73, 0x30, 0x89, 0x83, 0x91, 0x73, 0x05, 0x06, 0x2c, 0xe7, 0x7f, 0xc5, 0x2d, 0x02, 0x39, 0xd9,
+        0xef, 0xd2, 0x0a, 0x79, 0x8d, 0xac, 0xe3, 0xec, 0xbf, 0xf2, 0x98, 0x20, 0xe9, 0x64, 0xd8, 0x52,
+      } },
+};
+
+#endif
@@ -0,0 +1,608 @@
+// generated by proj/2-py-util/secp256k1-vectors.py: do not edit.
+//
+// secp256k1 ECDSA over SHA-256 digests: RFC 6979 nonces, low S,
+// recid as secp256k1_sign returns it.
+#ifndef __SECP256K1_VECTORS_H__
+#define __SECP256K1_VECTORS_H__
+
+typedef struct {
+    const char *name;
+    int recid;
+    uint8_t priv[32];
+    uint8_t pubkey[64];
+    uint8_t digest[32];
+    uint8_t sig[64];
+} secp256k1_vector_t;
+
+static const secp256k1_vector_t secp256k1_vectors[] = {
+    { "key 1, Satoshi Nakamoto", 1,
+      {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+      },
+      {
+        0x79, 0xbe, 0x66, 0x7e, 0xf9, 0xdc, 0xbb, 0xac, 0x55, 0xa0, 0x62, 0x95, 0xce, 0x87, 0x0b, 0x07,
+        0x02, 0x9b, 0xfc, 0xdb, 0x2d, 0xce, 0x28, 0xd9, 0x59, 0xf2, 0x81, 0x5b, 0x16, 0xf8, 0x17, 0x98,
+        0x48, 0x3a, 0xda, 0x77, 0x26, 0xa3, 0xc4, 0x65, 0x5d, 0xa4, 0xfb, 0xfc, 0x0e, 0x11, 0x08, 0xa8,
+        0xfd, 0x17, 0xb4, 0x48, 0xa6, 0x85, 0x54, 0x19, 0x9c, 0x47, 0xd0, 0x8f, 0xfb, 0x10, 0xd4, 0xb8,
+      },
+      {
+        0xa0, 0xdc, 0x65, 0xff, 0xca, 0x79, 0x98, 0x73, 0xcb, 0xea, 0x0a, 0xc2, 0x74, 0x01, 0x5b, 0x95,
+        0x26, 0x50, 0x5d, 0xaa, 0xae, 0xd3, 0x85, 0x15, 0x54, 0x25, 0xf7, 0x33, 0x77, 0x04, 0x88, 0x3e,
+      },
+      {
+        0x93, 0x4b, 0x1e, 0xa1, 0x0a, 0x4b, 0x3c, 0x17, 0x57, 0xe2, 0xb0, 0xc0, 0x17, 0xd0, 0xb6, 0x14,
+        0x3c, 0xe3, 0xc9, 0xa7, 0xe6, 0xa4, 0xa4, 0x98, 0x60, 0xd7, 0xa6, 0xab, 0x21, 0x0e, 0xe3, 0xd8,
+        0x24, 0x42, 0xce, 0x9d, 0x2b, 0x91, 0x60, 0x64, 0x10, 0x80, 0x14, 0x78, 0x3e, 0x92, 0x3e, 0xc3,
+        0x6b, 0x49, 0x74, 0x3e, 0x2f, 0xfa, 0x1c, 0x44, 0x96, 0xf0, 0x1a, 0x51, 0x2a, 0xaf, 0xd9, 0xe5,
+      } },
+    { "key 2", 1,
+      {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+      },
+      {
+        0xc6, 0x04, 0x7f, 0x94, 0x41, 0xed, 0x7d, 0x6d, 0x30, 0x45, 0x40, 0x6e, 0x95, 0xc0, 0x7c, 0xd8,
+        0x5c, 0x77, 0x8e, 0x4b, 0x8c, 0xef, 0x3c, 0xa7, 0xab, 0xac, 0x09, 0xb9, 0x5c, 0x70, 0x9e, 0xe5,
+        0x1a, 0xe1, 0x68, 0xfe, 0xa6, 0x3d, 0xc3, 0x39, 0xa3, 0xc5, 0x84, 0x19, 0x46, 0x6c, 0xea, 0xee,
+        0xf7, 0xf6, 0x32, 0x65, 0x32, 0x66, 0xd0, 0xe1, 0x23, 0x64, 0x31, 0xa9, 0x50, 0xcf, 0xe5, 0x2a,
+      },
+      {
+        0x78, 0xee, 0x38, 0x73, 0xcb, 0x7e, 0xa6, 0xa3, 0x5e, 0xe9, 0x17, 0xc3, 0x90, 0x40, 0x1d, 0x79,
+        0x76, 0xa3, 0x14, 0x53, 0xfb, 0x24, 0x80, 0xd3, 0x88, 0x19, 0xb0, 0x36, 0xf5, 0xcd, 0xd5, 0x89,
+      },
+      {
+        0xda, 0xeb, 0xf8, 0x2e, 0x25, 0x93, 0xdb, 0x3a, 0xd5, 0x1d, 0x27, 0xeb, 0xc8, 0xd0, 0xb9, 0xc5,
+        0xce, 0x5b, 0xa6, 0xab, 0x31, 0x47, 0x8e, 0xe8, 0x93, 0xc2, 0x8c, 0x2c, 0xf9, 0x83, 0x97, 0xab,
+        0x0a, 0x12, 0xdf, 0x38, 0x4d, 0x60, 0x0f, 0xf5, 0xb8, 0x55, 0x37, 0xb9, 0x9f, 0x7a, 0x48, 0x29,
+        0xdf, 0x5d, 0xc0, 0xe9, 0x1e, 0xdb, 0x60, 0xa2, 0x97, 0x63, 0x57, 0xcb, 0x52, 0x19, 0x67, 0x35,
+      } },
+    { "key 3", 0,
+      {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+      },
+      {
+        0xf9, 0x30, 0x8a, 0x01, 0x92, 0x58, 0xc3, 0x10, 0x49, 0x34, 0x4f, 0x85, 0xf8, 0x9d, 0x52, 0x29,
+        0xb5, 0x31, 0xc8, 0x45, 0x83, 0x6f, 0x99, 0xb0, 0x86, 0x01, 0xf1, 0x13, 0xbc, 0xe0, 0x36, 0xf9,
+        0x38, 0x8f, 0x7b, 0x0f, 0x63, 0x2d, 0xe8, 0x14, 0x0f, 0xe3, 0x37, 0xe6, 0x2a, 0x37, 0xf3, 0x56,
+        0x65, 0x00, 0xa9, 0x99, 0x34, 0xc2, 0x23, 0x1b, 0x6c, 0xb9, 0xfd, 0x75, 0x84, 0xb8, 0xe6, 0x72,
+      },
+      {
+        0x78, 0xee, 0x38, 0x73, 0xcb, 0x7e, 0xa6, 0xa3, 0x5e, 0xe9, 0x17, 0xc3, 0x90, 0x40, 0x1d, 0x79,
+        0x76, 0xa3, 0x14, 0x53, 0xfb, 0x24, 0x80, 0xd3, 0x88, 0x19, 0xb0, 0x36, 0xf5, 0xcd, 0xd5, 0x89,
+      },
+      {
+        0x66, 0xa1, 0x35, 0x19, 0x19, 0x94, 0x5e, 0xc3, 0x19, 0xc9, 0xf9, 0x24, 0xbf, 0x67, 0xa6, 0x36,
+        0x3e, 0x45, 0x8b, 0x19, 0xa0, 0x79, 0x85, 0x2d, 0x0c, 0x96, 0x46, 0xd3, 0xfa, 0xcc, 0xfb, 0x5b,
+        0x38, 0x03, 0x31, 0x7b, 0xfc, 0xd6, 0xbc, 0xe7, 0x06, 0x39, 0x23, 0x5d, 0x0f, 0x49, 0x80, 0x73,
+        0x98, 0x29, 0x2b, 0xdb, 0x74, 0xaf, 0xf0, 0x9d, 0xfd, 0x0e, 0x96, 0x2a, 0xfb, 0x27, 0xc7, 0x44,
+      } },
+    { "key n - 1", 1,
+      {
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+        0xba, 0xae, 0xdc, 0xe6, 0xaf, 0x48, 0xa0, 0x3b, 0xbf, 0xd2, 0x5e, 0x8c, 0xd0, 0x36, 0x41, 0x40,
+      },
+      {
+        0x79, 0xbe, 0x66, 0x7e, 0xf9, 0xdc, 0xbb, 0xac, 0x55, 0xa0, 0x62, 0x95, 0xce, 0x87, 0x0b, 0x07,
+        0x02, 0x9b, 0xfc, 0xdb, 0x2d, 0xce, 0x28, 0xd9, 0x59, 0xf2, 0x81, 0x5b, 0x16, 0xf8, 0x17, 0x98,
+        0xb7, 0xc5, 0x25, 0x88, 0xd9, 0x5c, 0x3b, 0x9a, 0xa2, 0x5b, 0x04, 0x03, 0xf1, 0xee, 0xf7, 0x57,
+        0x02, 0xe8, 0x4b, 0xb7, 0x59, 0x7a, 0xab, 0xe6, 0x63, 0xb8, 0x2f, 0x6f, 0x04, 0xef, 0x27, 0x77,
+      },
+      {
+        0x78, 0xee, 0x38, 0x73, 0xcb, 0x7e, 0xa6, 0xa3, 0x5e, 0xe9, 0x17, 0xc3, 0x90, 0x40, 0x1d, 0x79,
+        0x76, 0xa3, 0x14, 0x53, 0xfb, 0x24, 0x80, 0xd3, 0x88, 0x19, 0xb0, 0x36, 0xf5, 0xcd, 0xd5, 0x89,
+      },
+      {
+        0xdc, 0xe3, 0x5c, 0x9b, 0xde, 0xe9, 0x99, 0xc9, 0x3f, 0x80, 0xb1, 0x89, 0x00, 0x2b, 0x3c, 0xcd,
+        0x6a, 0x84, 0x6c, 0xf7, 0x74, 0x4c, 0xe8, 0x0e, 0x00, 0x11, 0xc6, 0xd8, 0xb3, 0xec, 0x35, 0xab,
+        0x50, 0x75, 0x5b, 0x35, 0x55, 0x26, 0xed, 0x5e, 0x43, 0xea, 0x92, 0x4a, 0x0f, 0x23, 0xb4, 0x81,
+        0x9d, 0x0c, 0x26, 0xb8, 0x85, 0xf2, 0xf5, 0x39, 0x15, 0xa9, 0x53, 0x14, 0x6e, 0x7f, 0xf6, 0xa2,
+      } },
+    { "key 0 msg 0", 1,
+      {
+        0x75, 0x0b, 0x79, 0x84, 0x0a, 0x35, 0xe8, 0x88, 0xce, 0xa8, 0x68, 0x4b, 0x60, 0x03, 0x3c, 0xd6,
+        0x5d, 0xb2, 0x33, 0x95, 0x6e, 0xa8, 0x8f, 0x4b, 0x4f, 0x72, 0xfd, 0x3f, 0x7d, 0x25, 0x4d, 0xb9,
+      },
+      {
+        0xae, 0xee, 0x6f, 0xa5, 0x6d, 0x91, 0x17, 0xea, 0x1e, 0xd6, 0x38, 0x0b, 0x85, 0x25, 0x9a, 0x1a,
+        0x47, 0xfd, 0x32, 0xd6, 0xa6, 0xc1, 0xda, 0xe1, 0xc9, 0xa7, 0xe4, 0xf7, 0x67, 0x38, 0x83, 0xc2,
+        0x42, 0x49, 0xf2, 0x46, 0x6c, 0xf0, 0x1e, 0x60, 0x3e, 0x6e, 0xa3, 0x60, 0xa0, 0x04, 0x34, 0x3d,
+        0xb6, 0x43, 0xaa, 0xec, 0xd5, 0x2c, 0x9a, 0xc3, 0x8d, 0x71, 0x66, 0x58, 0x08, 0x84, 0x3f, 0xda,
+      },
+      {
+        0x78, 0x6f, 0x01, 0x34, 0x40, 0x7a, 0xbf, 0xee, 0x1a, 0xce, 0x71, 0x79, 0x2e, 0x2a, 0x0d, 0xb7,
+        0x47, 0xfe, 0xb2, 0xba, 0xd0, 0xf3, 0x70, 0xc6, 0x2e, 0xea, 0x11, 0x36, 0xb7, 0xde, 0x84, 0xeb,
+      },
+      {
+        0x19, 0x28, 0xab, 0xce, 0x72, 0x4e, 0x87, 0x07, 0x48, 0x36, 0x7d, 0xa3, 0x06, 0xf7, 0x70, 0x19,
+        0x7e, 0x93, 0xb3, 0x2e, 0x70, 0x12, 0xce, 0x01, 0xd1, 0x75, 0x3e, 0x10, 0x7b, 0xda, 0xef, 0x6e,
+        0x26, 0x4f, 0x58, 0xc3, 0xb1, 0x41, 0xed, 0x0b, 0xd8, 0xfb, 0xa3, 0xc6, 0x7a, 0xf3, 0x8b, 0xd8,
+        0x54, 0x19, 0xa6, 0xd3, 0x72, 0x71, 0xe5, 0x00, 0xbd, 0x1a, 0x7f, 0x06, 0xbb, 0x54, 0x1b, 0x20,
+      } },
+    { "key 0 msg 1", 0,
+      {
+        0x75, 0x0b, 0x79, 0x84, 0x0a, 0x35, 0xe8, 0x88, 0xce, 0xa8, 0x68, 0x4b, 0x60, 0x03, 0x3c, 0xd6,
+        0x5d, 0xb2, 0x33, 0x95, 0x6e, 0xa8, 0x8f, 0x4b, 0x4f, 0x72, 0xfd, 0x3f, 0x7d, 0x25, 0x4d, 0xb9,
+      },
+      {
+        0xae, 0xee, 0x6f, 0xa5, 0x6d, 0x91, 0x17, 0xea, 0x1e, 0xd6, 0x38, 0x0b, 0x85, 0x25, 0x9a, 0x1a,
+        0x47, 0xfd, 0x32, 0xd6, 0xa6, 0xc1, 0xda, 0xe1, 0xc9, 0xa7, 0xe4, 0xf7, 0x67, 0x38, 0x83, 0xc2,
+        0x42, 0x49, 0xf2, 0x46, 0x6c, 0xf0, 0x1e, 0x60, 0x3e, 0x6e, 0xa3, 0x60, 0xa0, 0x04, 0x34, 0x3d,
+        0xb6, 0x43, 0xaa, 0xec, 0xd5, 0x2c, 0x9a, 0xc3, 0x8d, 0x71, 0x66, 0x58, 0x08, 0x84, 0x3f, 0xda,
+      },
+      {
+        0x7b, 0x50, 0xdf, 0x13, 0x6d, 0x6a, 0xe6, 0x9b, 0xbe, 0xdc, 0x65, 0x88, 0x7f, 0xa1, 0xb8, 0x4d,
+        0xe7, 0x2a, 0x54, 0x82, 0x4b, 0x6a, 0x49, 0x6b, 0x8b, 0xe2, 0xd1, 0x34, 0x6c, 0x55, 0x72, 0x4d,
+      },
+      {
+        0xa9, 0x96, 0x11, 0x3c, 0x30, 0x08, 0x9e, 0x47, 0xbf, 0xf8, 0x68, 0x70, 0x05, 0xfd, 0x29, 0x4d,
+        0x27, 0x14, 0x8a, 0x38, 0x19, 0xc2, 0xae, 0xa7, 0x86, 0x3f, 0x00, 0x9c, 0x93, 0x10, 0x8d, 0x74,
+        0x3f, 0xf1, 0x84, 0xdb, 0x20, 0x7d, 0x50, 0x7c, 0x8e, 0x26, 0x00, 0x57, 0x04, 0xcd, 0xcb, 0x80,
+        0x08, 0x66, 0x8e, 0x50, 0x82, 0xbe, 0x29, 0x03, 0xa8, 0x7c, 0x95, 0xfc, 0x59, 0xb0, 0xf0, 0xce,
+      } },
+    { "key 0 msg 2", 0,
+      {
+        0x75, 0x0b, 0x79, 0x84, 0x0a, 0x35, 0xe8, 0x88, 0xce, 0xa8, 0x68, 0x4b, 0x60, 0x03, 0x3c, 0xd6,
+        0x5d, 0xb2, 0x33, 0x95, 0x6e, 0xa8, 0x8f, 0x4b, 0x4f, 0x72, 0xfd, 0x3f, 0x7d, 0x25, 0x4d, 0xb9,
+      },
+      {
+        0xae, 0xee, 0x6f, 0xa5, 0x6d, 0x91, 0x17, 0xea, 0x1e, 0xd6, 0x38, 0x0b, 0x85, 0x25, 0x9a, 0x1a,
+        0x47, 0xfd, 0x32, 0xd6, 0xa6, 0xc1, 0xda, 0xe1, 0xc9, 0xa7, 0xe4, 0xf7, 0x67, 0x38, 0x83, 0xc2,
+        0x42, 0x49, 0xf2, 0x46, 0x6c, 0xf0, 0x1e, 0x60, 0x3e, 0x6e, 0xa3, 0x60, 0xa0, 0x04, 0x34, 0x3d,
+        0xb6, 0x43, 0xaa, 0xec, 0xd5, 0x2c, 0x9a, 0xc3, 0x8d, 0x71, 0x66, 0x58, 0x08, 0x84, 0x3f, 0xda,
+      },
+      {
+        0xad, 0x22, 0x7c, 0xf2, 0x1e, 0xfe, 0xb2, 0x2e, 0x60, 0xfb, 0xa3, 0x8a, 0x65, 0x88, 0x84, 0x35,
+        0xf7, 0x68, 0x11, 0x28, 0xbf, 0xe9, 0x56, 0x14, 0xd1, 0xc9, 0x96, 0x2e, 0x95, 0x32, 0xfa, 0xba,
+      },
+      {
+        0xa0, 0x99, 0x27, 0xbb, 0xa5, 0xac, 0xc7, 0xee, 0x59, 0xfa, 0x5d, 0x8d, 0x9a, 0xee, 0xf4, 0x6b,
+        0x77, 0x96, 0xe1, 0x0b, 0xb9, 0x3c, 0x71, 0x87, 0xc9, 0x65, 0x96, 0xc1, 0x66, 0x49, 0x91, 0x70,
+        0x4c, 0x99, 0x86, 0x62, 0x30, 0xd9, 0x43, 0xef, 0x73, 0x3f, 0x1c, 0xf8, 0x95, 0xa6, 0xd4, 0xad,
+        0x54, 0x66, 0x2a, 0xd6, 0xa9, 0x89, 0x84, 0xd4, 0xa4, 0xb9, 0x76, 0xe4, 0x0a, 0x76, 0x87, 0xb0,
+      } },
+    { "key 1 msg 0", 0,
+      {
+        0xb8, 0x44, 0x82, 0xfe, 0x6f, 0xd3, 0x19, 0x68, 0x1a, 0x33, 0xad, 0xc9, 0xc8, 0xc4, 0xcf, 0xbc,
+        0x00, 0x46, 0x77, 0x9c, 0xdf, 0x27, 0x29, 0xee, 0xf4, 0x96, 0x0d, 0xfd, 0xd2, 0xb7, 0x39, 0x14,
+      },
+      {
+        0x57, 0xeb, 0xb8, 0x10, 0xb9, 0x2d, 0xe2, 0x6d, 0xea, 0x4e, 0x0b, 0xb9, 0x14, 0x93, 0x18, 0x0e,
+        0x82, 0x24, 0x2c, 0x17, 0xad, 0xb1, 0xe2, 0x92, 0xd3, 0x8d, 0xc9, 0x79, 0xd9, 0x3a, 0x44, 0x61,
+        0xda, 0xaa, 0x43, 0xee, 0xcc, 0x05, 0x5d, 0xe9, 0x08, 0xba, 0xfb, 0xda, 0x2a, 0x36, 0xc0, 0x06,
+        0x58, 0x4b, 0xbe, 0x9e, 0x25, 0x63, 0x56, 0x83, 0x8a, 0xff, 0xa3, 0xd5, 0x90, 0x79, 0xb6, 0x6a,
+      },
+      {
+        0xd1, 0xf6, 0x27, 0xaa, 0x6c, 0xac, 0x66, 0xed, 0x33, 0x4b, 0x59, 0xdd, 0x83, 0x20, 0xbc, 0xf2,
+        0x68, 0x16, 0xbe, 0xf9, 0x19, 0x83, 0x01, 0x3d, 0x63, 0x9a, 0xfe, 0xac, 0xd4, 0x31, 0xfe, 0x4e,
+      },
+      {
+        0x93, 0x76, 0x93, 0x83, 0xc2, 0xa7, 0xaf, 0xe8, 0x32, 0x22, 0xbe, 0x52, 0x54, 0x07, 0x03, 0x23,
+        0x44, 0x99, 0x49, 0x48, 0xb7, 0x0b, 0x90, 0x84, 0xf7, 0xef, 0x46, 0xd5, 0xb7, 0x41, 0xbe, 0xfa,
+        0x21, 0x8d, 0x95, 0x32, 0x28, 0xd8, 0x03, 0xca, 0x8b, 0x65, 0x9b, 0xf3, 0x55, 0x72, 0x1b, 0xb3,
+        0x1d, 0x14, 0xa6, 0x5b, 0x5c, 0xe7, 0x2b, 0x46, 0xbf, 0xeb, 0x1d, 0x9e, 0x79, 0x57, 0x82, 0x13,
+      } },
+    { "key 1 msg 1", 1,
+      {
+        0xb8, 0x44, 0x82, 0xfe, 0x6f, 0xd3, 0x19, 0x68, 0x1a, 0x33, 0xad, 0xc9, 0xc8, 0xc4, 0xcf, 0xbc,
+        0x00, 0x46, 0x77, 0x9c, 0xdf, 0x27, 0x29, 0xee, 0xf4, 0x96, 0x0d, 0xfd, 0xd2, 0xb7, 0x39, 0x14,
+      },
+      {
+        0x57, 0xeb, 0xb8, 0x10, 0xb9, 0x2d, 0xe2, 0x6d, 0xea, 0x4e, 0x0b, 0xb9, 0x14, 0x93, 0x18, 0x0e,
+        0x82, 0x24, 0x2c, 0x17, 0xad, 0xb1, 0xe2, 0x92, 0xd3, 0x8d, 0xc9, 0x79, 0xd9, 0x3a, 0x44, 0x61,
+        0xda, 0xaa, 0x43, 0xee, 0xcc, 0x05, 0x5d, 0xe9, 0x08, 0xba, 0xfb, 0xda, 0x2a, 0x36, 0xc0, 0x06,
+        0x58, 0x4b, 0xbe, 0x9e, 0x25, 0x63, 0x56, 0x83, 0x8a, 0xff, 0xa3, 0xd5, 0x90, 0x79, 0xb6, 0x6a,
+      },
+      {
+        0x1c, 0x56, 0x99, 0x96, 0x68, 0xc9, 0xaa, 0xe7, 0x39, 0x37, 0xe1, 0xba, 0xdf, 0x40, 0x49, 0xc0,
+        0x5f, 0xbe, 0x2e, 0x95, 0x3a, 0x06, 0xe1, 0xf2, 0xbd, 0xaa, 0xe7, 0xbc, 0x86, 0x7e, 0x7a, 0x71,
+      },
+      {
+        0x08, 0x21, 0x1b, 0x04, 0x98, 0x6a, 0xe3, 0x54, 0x94, 0xb5, 0x10, 0x98, 0xe1, 0xd6, 0x47, 0x26,
+        0x3d, 0xcc, 0xfa, 0xb2, 0xb0, 0xdc, 0xde, 0x96, 0x2a, 0xf0, 0xd3, 0x34, 0xa1, 0x1c, 0xf1, 0x8a,
+        0x4d, 0xbf, 0x58, 0x73, 0x3d, 0xcd, 0xfe, 0x0c, 0x73, 0x5e, 0x2e, 0xcf, 0x3b, 0x3b, 0x49, 0xc8,
+        0xc0, 0x6a, 0x72, 0x6b, 0xbc, 0x31, 0x03, 0xb4, 0x7f, 0x0f, 0xaf, 0xa3, 0x71, 0xfe, 0xa6, 0xde,
+      } },
+    { "key 1 msg 2", 1,
+      {
+        0xb8, 0x44, 0x82, 0xfe, 0x6f, 0xd3, 0x19, 0x68, 0x1a, 0x33, 0xad, 0xc9, 0xc8, 0xc4, 0xcf, 0xbc,
+        0x00, 0x46, 0x77, 0x9c, 0xdf, 0x27, 0x29, 0xee, 0xf4, 0x96, 0x0d, 0xfd, 0xd2, 0xb7, 0x39, 0x14,
+      },
+      {
+        0x57, 0xeb, 0xb8, 0x10, 0xb9, 0x2d, 0xe2, 0x6d, 0xea, 0x4e, 0x0b, 0xb9, 0x14, 0x93, 0x18, 0x0e,
+        0x82, 0x24, 0x2c, 0x17, 0xad, 0xb1, 0xe2, 0x92, 0xd3, 0x8d, 0xc9, 0x79, 0xd9, 0x3a, 0x44, 0x61,
+        0xda, 0xaa, 0x43, 0xee, 0xcc, 0x05, 0x5d, 0xe9, 0x08, 0xba, 0xfb, 0xda, 0x2a, 0x36, 0xc0, 0x06,
+        0x58, 0x4b, 0xbe, 0x9e, 0x25, 0x63, 0x56, 0x83, 0x8a, 0xff, 0xa3, 0xd5, 0x90, 0x79, 0xb6, 0x6a,
+      },
+      {
+        0x68, 0xfd, 0x7e, 0x77, 0x7f, 0x30, 0xbe, 0xcf, 0x5d, 0x42, 0xfb, 0xe4, 0xb3, 0xf0, 0xa1, 0xeb,
+        0xd2, 0x57, 0x0e, 0x89, 0x22, 0xcd, 0xbb, 0xd2, 0x4c, 0x4b, 0x8e, 0x9c, 0x42, 0x7a, 0x60, 0xe9,
+      },
+      {
+        0x04, 0x2c, 0x5c, 0xd3, 0x2f, 0xce, 0x4d, 0x4c, 0x79, 0x8a, 0x2c, 0x11, 0xcb, 0xa6, 0xae, 0x29,
+        0xb8, 0xe2, 0x43, 0xbc, 0x0b, 0x4e, 0xe6, 0x2c, 0xf4, 0x91, 0x37, 0x0e, 0xd7, 0x14, 0x95, 0x61,
+        0x7f, 0x07, 0x5f, 0xba, 0x69, 0x02, 0x2d, 0xd4, 0xf3, 0x12, 0x9a, 0xf2, 0x01, 0xef, 0x9d, 0x9c,
+        0xea, 0xd6, 0x56, 0xf1, 0x72, 0x52, 0x9a, 0x2c, 0x07, 0xda, 0xdd, 0x24, 0xa3, 0x21, 0x92, 0xaa,
+      } },
+    { "key 2 msg 0", 0,
+      {
+        0xd7, 0xeb, 0x92, 0x11, 0x43, 0x0d, 0xe4, 0xf5, 0xd3, 0x1c, 0x58, 0xd1, 0xb9, 0xf2, 0xb8, 0x65,
+        0x65, 0xe5, 0x2d, 0xfe, 0x23, 0x17, 0xff, 0x11, 0x54, 0xeb, 0x0c, 0x0b, 0x35, 0x95, 0x0d, 0x67,
+      },
+      {
+        0x40, 0x2e, 0x4a, 0xe2, 0xfd, 0x9b, 0x16, 0x20, 0x31, 0xf9, 0xa0, 0x32, 0x60, 0x1e, 0xc0, 0xd8,
+        0x7d, 0xb8, 0xe6, 0x3f, 0x74, 0xfc, 0x02, 0xc0, 0x6e, 0xca, 0x31, 0x76, 0xa9, 0x75, 0x3c, 0x8b,
+        0x5a, 0xe2, 0x85, 0xd7, 0x61, 0xa2, 0x35, 0x06, 0xcf, 0x91, 0xc9, 0xe1, 0xdb, 0x37, 0xea, 0x85,
+        0x45, 0xbd, 0x44, 0xf4, 0x3e, 0x1f, 0x4f, 0xb8, 0xee, 0x1a, 0xc3, 0x47, 0x04, 0xd8, 0xe4, 0x53,
+      },
+      {
+        0x89, 0x20, 0x5a, 0x4e, 0x0c, 0x91, 0x36, 0x71, 0x4a, 0xdf, 0xfe, 0x8e, 0x26, 0x82, 0x37, 0xa4,
+        0xbc, 0x61, 0xd1, 0x2d, 0x5b, 0x54, 0x10, 0x5c, 0x2e, 0x34, 0xed, 0xcc, 0x43, 0x52, 0x4a, 0xe3,
+      },
+      {
+        0x34, 0xd3, 0x9e, 0x6e, 0xc3, 0x45, 0x4f, 0x54, 0x43, 0x30, 0x90, 0x02, 0x95, 0x88, 0xc5, 0x27,
+        0x58, 0xc3, 0x97, 0xf1, 0x2f, 0xfd, 0x12, 0x30, 0xcd, 0xef, 0x5f, 0xeb, 0x2d, 0x54, 0x40, 0x74,
+        0x3e, 0xdf, 0xb4, 0xc6, 0x58, 0x1a, 0x94, 0xcb, 0xe0, 0x79, 0x61, 0x3e, 0xce, 0xb0, 0xc9, 0x44,
+        0xfb, 0x5f, 0x25, 0x5a, 0x79, 0x15, 0x06, 0xa0, 0xd1, 0xfc, 0x4b, 0xd0, 0x1d, 0xfe, 0x01, 0xd0,
+      } },
+    { "key 2 msg 1", 0,
+      {
+        0xd7, 0xeb, 0x92, 0x11, 0x43, 0x0d, 0xe4, 0xf5, 0xd3, 0x1c, 0x58, 0xd1, 0xb9, 0xf2, 0xb8, 0x65,
+        0x65, 0xe5, 0x2d, 0xfe, 0x23, 0x17, 0xff, 0x11, 0x54, 0xeb, 0x0c, 0x0b, 0x35, 0x95, 0x0d, 0x67,
+      },
+      {
+        0x40, 0x2e, 0x4a, 0xe2, 0xfd, 0x9b, 0x16, 0x20, 0x31, 0xf9, 0xa0, 0x32, 0x60, 0x1e, 0xc0, 0xd8,
+        0x7d, 0xb8, 0xe6, 0x3f, 0x74, 0xfc, 0x02, 0xc0, 0x6e, 0xca, 0x31, 0x76, 0xa9, 0x75, 0x3c, 0x8b,
+        0x5a, 0xe2, 0x85, 0xd7, 0x61, 0xa2, 0x35, 0x06, 0xcf, 0x91, 0xc9, 0xe1, 0xdb, 0x37, 0xea, 0x85,
+        0x45, 0xbd, 0x44, 0xf4, 0x3e, 0x1f, 0x4f, 0xb8, 0xee, 0x1a, 0xc3, 0x47, 0x04, 0xd8, 0xe4, 0x53,
+      },
+      {
+        0x1e, 0x7a, 0x5b, 0xa1, 0x76, 0x50, 0x4a, 0xb9, 0x8f, 0x93, 0x3d, 0xc8, 0xe9, 0xb1, 0x53, 0xd3,
+        0x90, 0x21, 0x71, 0x4b, 0x99, 0x76, 0x05, 0xac, 0xd0, 0x51, 0xed, 0xbc, 0x8d, 0x37, 0xcc, 0xae,
+      },
+      {
+        0x99, 0x7a, 0x86, 0xc9, 0x57, 0x66, 0xe8, 0x1c, 0xfb, 0xd1, 0xcf, 0x79, 0x83, 0xe9, 0x80, 0x56,
+        0xa8, 0x56, 0x29, 0x26, 0x81, 0xea, 0xd3, 0xd7, 0x60, 0x27, 0xab, 0xef, 0xf4, 0xe6, 0x1b, 0x5b,
+        0x5f, 0xf6, 0x05, 0x22, 0x98, 0x7f, 0x04, 0xfe, 0x62, 0x4c, 0x9a, 0xd1, 0xaf, 0x75, 0xe0, 0x09,
+        0x27, 0x54, 0xc5, 0x3f, 0x6f, 0x67, 0x4d, 0x00, 0xdc, 0x5c, 0x32, 0x16, 0x2d, 0xc1, 0xb8, 0xd2,
+      } },
+    { "key 2 msg 2", 0,
+      {
+        0xd7, 0xeb, 0x92, 0x11, 0x43, 0x0d, 0xe4, 0xf5, 0xd3, 0x1c, 0x58, 0xd1, 0xb9, 0xf2, 0xb8, 0x65,
+        0x65, 0xe5, 0x2d, 0xfe, 0x23, 0x17, 0xff, 0x11, 0x54, 0xeb, 0x0c, 0x0b, 0x35, 0x95, 0x0d, 0x67,
+      },
+      {
+        0x40, 0x2e, 0x4a, 0xe2, 0xfd, 0x9b, 0x16, 0x20, 0x31, 0xf9, 0xa0, 0x32, 0x60, 0x1e, 0xc0, 0xd8,
+        0x7d, 0xb8, 0xe6, 0x3f, 0x74, 0xfc, 0x02, 0xc0, 0x6e, 0xca, 0x31, 0x76, 0xa9, 0x75, 0x3c, 0x8b,
+        0x5a, 0xe2, 0x85, 0xd7, 0x61, 0xa2, 0x35, 0x06, 0xcf, 0x91, 0xc9, 0xe1, 0xdb, 0x37, 0xea, 0x85,
+        0x45, 0xbd, 0x44, 0xf4, 0x3e, 0x1f, 0x4f, 0xb8, 0xee, 0x1a, 0xc3, 0x47, 0x04, 0xd8, 0xe4, 0x53,
+      },
+      {
+        0x6e, 0xe6, 0x34, 0xd7, 0x7d, 0xbd, 0xb4, 0x83, 0xbd, 0x4d, 0xc7, 0x88, 0x1c, 0x52, 0xf5, 0x2f,
+        0x32, 0x59, 0xa1, 0x66, 0x81, 0x69, 0x63, 0x31, 0x6e, 0x38, 0x05, 0x46, 0x16, 0x11, 0x7c, 0x07,
+      },
+      {
+        0xf4, 0xc1, 0xb8, 0x48, 0x0b, 0xdb, 0x05, 0xa8, 0xf8, 0x95, 0xbc, 0x38, 0xf8, 0xb9, 0xc6, 0x87,
+        0xc4, 0xa6, 0x88, 0xd0, 0xc3, 0x5e, 0xe9, 0x4e, 0x8a, 0xec, 0x73, 0xbb, 0x8f, 0x89, 0xeb, 0x6a,
+        0x60, 0x72, 0x67, 0x6d, 0x33, 0x67, 0x80, 0x57, 0x70, 0xe5, 0xc0, 0xb9, 0x7f, 0x0f, 0x10, 0xd3,
+        0x19, 0x42, 0x12, 0x6b, 0x04, 0x60, 0x8c, 0x14, 0x4a, 0x97, 0x18, 0x1b, 0x62, 0xd5, 0xbf, 0x87,
+      } },
+    { "key 3 msg 0", 0,
+      {
+        0x84, 0xf9, 0x19, 0xf7, 0x3c, 0xbc, 0x91, 0x77, 0x89, 0xe3, 0x89, 0x2b, 0x87, 0xc1, 0x01, 0x9c,
+        0xe5, 0xe3, 0x78, 0xb5, 0x1e, 0x67, 0xcc, 0xfb, 0xeb, 0x89, 0x08, 0x37, 0x1b, 0x57, 0x18, 0x25,
+      },
+      {
+        0x56, 0xc0, 0x21, 0x5d, 0xbc, 0xb6, 0xda, 0x59, 0x8a, 0x3e, 0xae, 0x24, 0x41, 0x21, 0x82, 0xaf,
+        0xf2, 0xc0, 0xcf, 0xd3, 0x76, 0x79, 0x82, 0xc7, 0x9c, 0xbb, 0x7a, 0xb6, 0x5b, 0xcf, 0x3e, 0xb1,
+        0x92, 0xfc, 0xfc, 0xd6, 0x24, 0xeb, 0xae, 0xe2, 0xf5, 0x62, 0x75, 0xff, 0xd5, 0x8d, 0xf5, 0xc0,
+        0xc0, 0xf1, 0x9a, 0x8b, 0x89, 0x98, 0x1c, 0xb7, 0x23, 0x10, 0x9a, 0x46, 0xff, 0x08, 0xba, 0xd6,
+      },
+      {
+        0x3f, 0x8f, 0x37, 0xfd, 0xc5, 0xd6, 0xf8, 0xef, 0xc3, 0x04, 0x63, 0xa4, 0x7e, 0x8d, 0xae, 0xb9,
+        0xd9, 0x83, 0xd2, 0x4e, 0x68, 0xb0, 0x3c, 0x62, 0xc7, 0x1a, 0x06, 0xe6, 0xc3, 0x06, 0x58, 0x2e,
+      },
+      {
+        0x77, 0x8c, 0xe7, 0x1f, 0xff, 0x73, 0x9e, 0xed, 0x53, 0xb9, 0xfa, 0x9b, 0x6b, 0xbb, 0x1d, 0x72,
+        0x63, 0x01, 0x16, 0x3c, 0x93, 0x54, 0x9b, 0xfc, 0x3e, 0x1d, 0x4f, 0xa2, 0x1f, 0x87, 0x60, 0xf4,
+        0x2a, 0x69, 0xf3, 0xa1, 0xe9, 0xce, 0x5e, 0xfe, 0xda, 0x98, 0xf1, 0x23, 0xb7, 0xf6, 0x6e, 0x25,
+        0x1e, 0xba, 0xa7, 0x1f, 0x82, 0x8c, 0x73, 0x56, 0xb7, 0xfe, 0xe9, 0x60, 0x30, 0xa0, 0x35, 0xaf,
+      } },
+    { "key 3 msg 1", 0,
+      {
+        0x84, 0xf9, 0x19, 0xf7, 0x3c, 0xbc, 0x91, 0x77, 0x89, 0xe3, 0x89, 0x2b, 0x87, 0xc1, 0x01, 0x9c,
+        0xe5, 0xe3, 0x78, 0xb5, 0x1e, 0x67, 0xcc, 0xfb, 0xeb, 0x89, 0x08, 0x37, 0x1b, 0x57, 0x18, 0x25,
+      },
+      {
+        0x56, 0xc0, 0x21, 0x5d, 0xbc, 0xb6, 0xda, 0x59, 0x8a, 0x3e, 0xae, 0x24, 0x41, 0x21, 0x82, 0xaf,
+        0xf2, 0xc0, 0xcf, 0xd3, 0x76, 0x79, 0x82, 0xc7, 0x9c, 0xbb, 0x7a, 0xb6, 0x5b, 0xcf, 0x3e, 0xb1,
+        0x92, 0xfc, 0xfc, 0xd6, 0x24, 0xeb, 0xae, 0xe2, 0xf5, 0x62, 0x75, 0xff, 0xd5, 0x8d, 0xf5, 0xc0,
+        0xc0, 0xf1, 0x9a, 0x8b, 0x89, 0x98, 0x1c, 0xb7, 0x23, 0x10, 0x9a, 0x46, 0xff, 0x08, 0xba, 0xd6,
+      },
+      {
+        0xd2, 0x34, 0xbe, 0x0b, 0x24, 0xd1, 0x05, 0x4a, 0x79, 0x16, 0x4c, 0xb5, 0x1e, 0x85, 0x93, 0x75,
+        0x06, 0x7a, 0xce, 0x4a, 0x57, 0x58, 0x18, 0x93, 0x58, 0x55, 0xe6, 0xd8, 0x32, 0xcd, 0x7a, 0x53,
+      },
+      {
+        0x94, 0x68, 0x86, 0x83, 0x99, 0x37, 0xd4, 0x0e, 0x7a, 0x5a, 0xd0, 0xa0, 0xee, 0xf3, 0x4b, 0x1b,
+        0x25, 0xfc, 0x45, 0x38, 0xf0, 0x91, 0xad, 0x3c, 0x33, 0x51, 0x97, 0x68, 0xd9, 0xee, 0x0a, 0xab,
+        0x0d, 0xdc, 0xe9, 0xbf, 0x2e, 0xc3, 0x15, 0x3d, 0x58, 0x6e, 0xcb, 0x91, 0xd4, 0x5b, 0xae, 0x82,
+        0x23, 0xd6, 0x81, 0x5b, 0xdc, 0xfc, 0x62, 0x28, 0xca, 0x46, 0x21, 0xbd, 0x2d, 0x2a, 0xc4, 0x50,
+      } },
+    { "key 3 msg 2", 0,
+      {
+        0x84, 0xf9, 0x19, 0xf7, 0x3c, 0xbc, 0x91, 0x77, 0x89, 0xe3, 0x89, 0x2b, 0x87, 0xc1, 0x01, 0x9c,
+        0xe5, 0xe3, 0x78, 0xb5, 0x1e, 0x67, 0xcc, 0xfb, 0xeb, 0x89, 0x08, 0x37, 0x1b, 0x57, 0x18, 0x25,
+      },
+      {
+        0x56, 0xc0, 0x21, 0x5d, 0xbc, 0xb6, 0xda, 0x59, 0x8a, 0x3e, 0xae, 0x24, 0x41, 0x21, 0x82, 0xaf,
+        0xf2, 0xc0, 0xcf, 0xd3, 0x76, 0x79, 0x82, 0xc7, 0x9c, 0xbb, 0x7a, 0xb6, 0x5b, 0xcf, 0x3e, 0xb1,
+        0x92, 0xfc, 0xfc, 0xd6, 0x24, 0xeb, 0xae, 0xe2, 0xf5, 0x62, 0x75, 0xff, 0xd5, 0x8d, 0xf5, 0xc0,
+        0xc0, 0xf1, 0x9a, 0x8b, 0x89, 0x98, 0x1c, 0xb7, 0x23, 0x10, 0x9a, 0x46, 0xff, 0x08, 0xba, 0xd6,
+      },
+      {
+        0x94, 0xe6, 0x4e, 0x1a, 0x19, 0xb5, 0xdc, 0x80, 0xd4, 0x3b, 0x4c, 0x9d, 0x36, 0xa7, 0xe6, 0xa1,
+        0x0e, 0x25, 0x52, 0x24, 0x7a, 0xd4, 0x76, 0x0e, 0xd5, 0xc8, 0x41, 0xd6, 0x53, 0xc2, 0xab, 0xfd,
+      },
+      {
+        0xab, 0xcf, 0xab, 0x19, 0x4b, 0x30, 0xfa, 0xb1, 0x40, 0x54, 0xdf, 0x12, 0x04, 0x12, 0x05, 0x74,
+        0x0b, 0x12, 0x7a, 0x40, 0xd9, 0x58, 0x51, 0x3a, 0x58, 0xb6, 0x30, 0x7b, 0x3c, 0x00, 0x64, 0xd3,
+        0x2c, 0x62, 0x00, 0x38, 0xb5, 0x8d, 0x2a, 0x35, 0x81, 0x8c, 0xc8, 0xf4, 0xc4, 0xc7, 0x20, 0x1a,
+        0x0a, 0xe3, 0x70, 0xbf, 0x37, 0xb3, 0x27, 0x8d, 0xb4, 0x19, 0x15, 0x4b, 0xed, 0xbc, 0x97, 0xf5,
+      } },
+    { "key 4 msg 0", 0,
+      {
+        0xef, 0x79, 0x19, 0x16, 0x56, 0x67, 0x77, 0x24, 0x31, 0x7e, 0xf7, 0x4d, 0xeb, 0x40, 0x45, 0xbf,
+        0xe1, 0xc4, 0x27, 0x43, 0x63, 0x5b, 0x44, 0x82, 0x03, 0x8d, 0x64, 0x06, 0xb0, 0x6f, 0x18, 0xac,
+      },
+      {
+        0x45, 0xcc, 0x68, 0x4d, 0xfd, 0x0a, 0x99, 0x74, 0x61, 0xce, 0x2c, 0x8b, 0x9c, 0x4a, 0x4a, 0x0f,
+        0x81, 0x3f, 0x9a, 0xf6, 0x33, 0x8c, 0x4d, 0x11, 0x5c, 0x7d, 0x78, 0xb0, 0xa1, 0xdd, 0x46, 0x90,
+        0x9a, 0x0b, 0xb2, 0x90, 0xc9, 0x63, 0xdb, 0xfa, 0xe2, 0x1f, 0xd6, 0x35, 0x11, 0x86, 0x39, 0x32,
+        0xb4, 0x03, 0x75, 0x43, 0xc1, 0x55, 0x62, 0x9e, 0x3c, 0xb2, 0x57, 0xdc, 0x9d, 0xc7, 0xf5, 0x7b,
+      },
+      {
+        0x6a, 0xd1, 0x58, 0x7d, 0x28, 0x07, 0xe7, 0x1a, 0x4c, 0xe8, 0xb2, 0x70, 0x85, 0xf8, 0x9c, 0xa1,
+        0x45, 0x08, 0xaf, 0x6a, 0x54, 0xfa, 0xc7, 0x8a, 0xcf, 0xf4, 0xcb, 0x30, 0x2f, 0xde, 0xed, 0x7c,
+      },
+      {
+        0x80, 0x61, 0xe8, 0x4d, 0x32, 0x82, 0x34, 0x98, 0x4a, 0x26, 0x06, 0xe7, 0x16, 0xa3, 0x02, 0x36,
+        0x53, 0xc6, 0xb5, 0x68, 0x61, 0x45, 0xe9, 0x49, 0xcc, 0x9e, 0x76, 0x6e, 0x64, 0xbc, 0xcc, 0xaa,
+        0x1b, 0x31, 0x83, 0x62, 0xbe, 0x7d, 0xf7, 0xbd, 0xbe, 0xfd, 0xda, 0x81, 0xcb, 0x98, 0x51, 0x70,
+        0xb2, 0x2b, 0xeb, 0x2a, 0xfe, 0xce, 0xa1, 0x97, 0x8f, 0x2d, 0x14, 0xeb, 0x9d, 0x59, 0xbc, 0x6d,
+      } },
+    { "key 4 msg 1", 0,
+      {
+        0xef, 0x79, 0x19, 0x16, 0x56, 0x67, 0x77, 0x24, 0x31, 0x7e, 0xf7, 0x4d, 0xeb, 0x40, 0x45, 0xbf,
+        0xe1, 0xc4, 0x27, 0x43, 0x63, 0x5b, 0x44, 0x82, 0x03, 0x8d, 0x64, 0x06, 0xb0, 0x6f, 0x18, 0xac,
+      },
+      {
+        0x45, 0xcc, 0x68, 0x4d, 0xfd, 0x0a, 0x99, 0x74, 0x61, 0xce, 0x2c, 0x8b, 0x9c, 0x4a, 0x4a, 0x0f,
+        0x81, 0x3f, 0x9a, 0xf6, 0x33, 0x8c, 0x4d, 0x11, 0x5c, 0x7d, 0x78, 0xb0, 0xa1, 0xdd, 0x46, 0x90,
+        0x9a, 0x0b, 0xb2, 0x90, 0xc9, 0x63, 0xdb, 0xfa, 0xe2, 0x1f, 0xd6, 0x35, 0x11, 0x86, 0x39, 0x32,
+        0xb4, 0x03, 0x75, 0x43, 0xc1, 0x55, 0x62, 0x9e, 0x3c, 0xb2, 0x57, 0xdc, 0x9d, 0xc7, 0xf5, 0x7b,
+      },
+      {
+        0xce, 0x59, 0x50, 0xdd, 0x23, 0x1b, 0x5d, 0xaf, 0x11, 0x20, 0x1e, 0x4e, 0xdf, 0xed, 0xb4, 0xdb,
+        0x8b, 0x90, 0x8c, 0x42, 0x14, 0xf1, 0x83, 0x6f, 0x2f, 0x9b, 0xcb, 0x8b, 0xe8, 0xd8, 0xaf, 0xca,
+      },
+      {
+        0xb3, 0x18, 0x66, 0xf0, 0x07, 0x89, 0x91, 0x4e, 0x45, 0x76, 0x29, 0xce, 0x97, 0x70, 0x76, 0xe7,
+        0x7a, 0x5a, 0x1a, 0x4e, 0x92, 0xe8, 0x42, 0x5c, 0xf5, 0x07, 0xae, 0x68, 0x5a, 0xfe, 0x6c, 0x32,
+        0x13, 0x45, 0x02, 0xb0, 0x47, 0xa0, 0x66, 0x6e, 0x9b, 0xac, 0x61, 0x61, 0xd8, 0x2e, 0x1f, 0xf8,
+        0xb1, 0x02, 0x06, 0x3a, 0xce, 0xa8, 0x9b, 0x92, 0xa5, 0x44, 0xb6, 0x59, 0x93, 0x1d, 0xe7, 0x46,
+      } },
+    { "key 4 msg 2", 1,
+      {
+        0xef, 0x79, 0x19, 0x16, 0x56, 0x67, 0x77, 0x24, 0x31, 0x7e, 0xf7, 0x4d, 0xeb, 0x40, 0x45, 0xbf,
+        0xe1, 0xc4, 0x27, 0x43, 0x63, 0x5b, 0x44, 0x82, 0x03, 0x8d, 0x64, 0x06, 0xb0, 0x6f, 0x18, 0xac,
+      },
+      {
+        0x45, 0xcc, 0x68, 0x4d, 0xfd, 0x0a, 0x99, 0x74, 0x61, 0xce, 0x2c, 0x8b, 0x9c, 0x4a, 0x4a, 0x0f,
+        0x81, 0x3f, 0x9a, 0xf6, 0x33, 0x8c, 0x4d, 0x11, 0x5c, 0x7d, 0x78, 0xb0, 0xa1, 0xdd, 0x46, 0x90,
+        0x9a, 0x0b, 0xb2, 0x90, 0xc9, 0x63, 0xdb, 0xfa, 0xe2, 0x1f, 0xd6, 0x35, 0x11, 0x86, 0x39, 0x32,
+        0xb4, 0x03, 0x75, 0x43, 0xc1, 0x55, 0x62, 0x9e, 0x3c, 0xb2, 0x57, 0xdc, 0x9d, 0xc7, 0xf5, 0x7b,
+      },
+      {
+        0x1d, 0x57, 0x59, 0xd5, 0xad, 0x1d, 0xfb, 0xe9, 0xfe, 0xbc, 0x1d, 0x4a, 0x61, 0x4b, 0x27, 0x77,
+        0x2b, 0x44, 0xdf, 0x44, 0x50, 0x72, 0x64, 0x58, 0x3c, 0xf8, 0xc9, 0x8b, 0x49, 0x31, 0xcf, 0xdb,
+      },
+      {
+        0xf8, 0xfc, 0xfb, 0xd7, 0x91, 0x2e, 0xac, 0xeb, 0xea, 0xc6, 0xdf, 0xdf, 0xcd, 0xbb, 0x33, 0x94,
+        0x4d, 0xfc, 0xd7, 0x95, 0xbf, 0xd7, 0x69, 0x95, 0x77, 0x3d, 0xae, 0x2e, 0x26, 0xdf, 0xd0, 0xa5,
+        0x07, 0xe6, 0x74, 0xa8, 0xce, 0xf3, 0x7c, 0xe3, 0xf6, 0x3c, 0x07, 0x0f, 0x2a, 0x0a, 0x4e, 0xeb,
+        0x33, 0xfd, 0xee, 0x31, 0x8b, 0xf7, 0x85, 0xe0, 0x7c, 0x1a, 0xf5, 0x9c, 0x24, 0xd0, 0x72, 0x0f,
+      } },
+    { "key 5 msg 0", 0,
+      {
+        0xe5, 0x98, 0x62, 0x41, 0x96, 0x4e, 0x60, 0x19, 0x72, 0x56, 0x3b, 0xbf, 0x64, 0xe6, 0x8c, 0x6d,
+        0x1f, 0xdc, 0xb7, 0x65, 0x9f, 0xcf, 0x74, 0xea, 0x76, 0x02, 0x67, 0x45, 0xf9, 0xac, 0x51, 0x4c,
+      },
+      {
+        0x29, 0x01, 0xe0, 0x54, 0x1b, 0xfe, 0x45, 0x84, 0x2e, 0xab, 0xb3, 0x6b, 0x9d, 0x3e, 0x33, 0x0a,
+        0x4b, 0x41, 0x30, 0x5e, 0x37, 0xac, 0x0c, 0x01, 0xb9, 0x6e, 0x10, 0xae, 0x50, 0x5e, 0x13, 0xc3,
+        0x17, 0xa4, 0x26, 0xa6, 0xf4, 0xf9, 0xe7, 0x31, 0xf5, 0xd9, 0x02, 0x17, 0xb8, 0x32, 0x4f, 0x8d,
+        0x8c, 0x4f, 0x41, 0x12, 0x9b, 0xab, 0xe4, 0xde, 0x98, 0xbd, 0x6f, 0x63, 0x69, 0x0d, 0xe6, 0x6e,
+      },
+      {
+        0x26, 0x7b, 0xfb, 0x72, 0x43, 0x91, 0x59, 0xd9, 0xd2, 0x3b, 0x6d, 0x9f, 0x33, 0x02, 0xfe, 0x4c,
+        0x6a, 0xa5, 0x6c, 0xab, 0xfd, 0x4a, 0x47, 0x82, 0x42, 0xfd, 0xb1, 0x7b, 0xff, 0xd6, 0xb2, 0x73,
+      },
+      {
+        0x26, 0x6d, 0x50, 0x37, 0xbd, 0xe6, 0x7e, 0x82, 0xfc, 0x1e, 0x90, 0x4b, 0x23, 0x25, 0x79, 0x26,
+        0x51, 0xd4, 0xfb, 0x4c, 0xd8, 0x56, 0x95, 0xa8, 0xe8, 0x00, 0x18, 0x55, 0xdc, 0x45, 0xfe, 0xe1,
+        0x56, 0x32, 0xda, 0x39, 0x79, 0xa1, 0x5b, 0x83, 0xc9, 0x68, 0x76, 0x68, 0x2c, 0xbf, 0x57, 0xfc,
+        0xd9, 0x42, 0xa0, 0x54, 0xa9, 0x01, 0xe2, 0xdf, 0x81, 0x0a, 0x5c, 0x89, 0x84, 0x1c, 0x44, 0x53,
+      } },
+    { "key 5 msg 1", 0,
+      {
+        0xe5, 0x98, 0x62, 0x41, 0x96, 0x4e, 0x60, 0x19, 0x72, 0x56, 0x3b, 0xbf, 0x64, 0xe6, 0x8c, 0x6d,
+        0x1f, 0xdc, 0xb7, 0x65, 0x9f, 0xcf, 0x74, 0xea, 0x76, 0x02, 0x67, 0x45, 0xf9, 0xac, 0x51, 0x4c,
+      },
+      {
+        0x29, 0x01, 0xe0, 0x54, 0x1b, 0xfe, 0x45, 0x84, 0x2e, 0xab, 0xb3, 0x6b, 0x9d, 0x3e, 0x33, 0x0a,
+        0x4b, 0x41, 0x30, 0x5e, 0x37, 0xac, 0x0c, 0x01, 0xb9, 0x6e, 0x10, 0xae, 0x50, 0x5e, 0x13, 0xc3,
+        0x17, 0xa4, 0x26, 0xa6, 0xf4, 0xf9, 0xe7, 0x31, 0xf5, 0xd9, 0x02, 0x17, 0xb8, 0x32, 0x4f, 0x8d,
+        0x8c, 0x4f, 0x41, 0x12, 0x9b, 0xab, 0xe4, 0xde, 0x98, 0xbd, 0x6f, 0x63, 0x69, 0x0d, 0xe6, 0x6e,
+      },
+      {
+        0xed, 0x65, 0xea, 0xe4, 0xeb, 0x40, 0xf2, 0x1e, 0xef, 0x51, 0x7e, 0xc6, 0xab, 0xe0, 0x22, 0x80,
+        0x8a, 0xdd, 0xf0, 0x44, 0x41, 0x3d, 0x42, 0xac, 0xde, 0xc8, 0x8b, 0x0b, 0x31, 0x15, 0x79, 0xfa,
+      },
+      {
+        0x81, 0xb0, 0x8b, 0x20, 0x91, 0x1b, 0x6d, 0x10, 0x23, 0x3e, 0x7c, 0x3e, 0x9c, 0x0d, 0x81, 0x94,
+        0xea, 0x86, 0x70, 0x83, 0x52, 0x57, 0xff, 0x4b, 0xa4, 0x62, 0xd4, 0xfb, 0x7b, 0x27, 0x2c, 0xdc,
+        0x12, 0xcb, 0x35, 0x1d, 0x7c, 0xb1, 0xf0, 0xbc, 0x49, 0xad, 0xab, 0x70, 0x28, 0xd3, 0xfa, 0x18,
+        0xab, 0x9b, 0xe6, 0x97, 0x94, 0x44, 0xd8, 0xac, 0xe3, 0x9b, 0x5e, 0xc9, 0x61, 0x4c, 0x8d, 0x33,
+      } },
+    { "key 5 msg 2", 0,
+      {
+        0xe5, 0x98, 0x62, 0x41, 0x96, 0x4e, 0x60, 0x19, 0x72, 0x56, 0x3b, 0xbf, 0x64, 0xe6, 0x8c, 0x6d,
+        0x1f, 0xdc, 0xb7, 0x65, 0x9f, 0xcf, 0x74, 0xea, 0x76, 0x02, 0x67, 0x45, 0xf9, 0xac, 0x51, 0x4c,
+      },
+      {
+        0x29, 0x01, 0xe0, 0x54, 0x1b, 0xfe, 0x45, 0x84, 0x2e, 0xab, 0xb3, 0x6b, 0x9d, 0x3e, 0x33, 0x0a,
+        0x4b, 0x41, 0x30, 0x5e, 0x37, 0xac, 0x0c, 0x01, 0xb9, 0x6e, 0x10, 0xae, 0x50, 0x5e, 0x13, 0xc3,
+        0x17, 0xa4, 0x26, 0xa6, 0xf4, 0xf9, 0xe7, 0x31, 0xf5, 0xd9, 0x02, 0x17, 0xb8, 0x32, 0x4f, 0x8d,
+        0x8c, 0x4f, 0x41, 0x12, 0x9b, 0xab, 0xe4, 0xde, 0x98, 0xbd, 0x6f, 0x63, 0x69, 0x0d, 0xe6, 0x6e,
+      },
+      {
+        0x85, 0x7d, 0xf7, 0x47, 0x47, 0x70, 0x5f, 0xae, 0x14, 0x7a, 0x72, 0x72, 0x8c, 0x71, 0x59, 0xa4,
+        0xde, 0xef, 0x55, 0x7f, 0x76, 0x17, 0xec, 0x41, 0x20, 0x8d, 0xcb, 0x8c, 0x5f, 0xfa, 0xe9, 0x3e,
+      },
+      {
+        0x87, 0xe2, 0xff, 0x74, 0xdd, 0x12, 0xde, 0xdc, 0x4d, 0x14, 0x8d, 0xb8, 0xf5, 0x8f, 0x02, 0x2c,
+        0x6d, 0xbc, 0xed, 0xa2, 0x5b, 0x0b, 0x29, 0x49, 0x26, 0x5e, 0xbd, 0xeb, 0x20, 0x42, 0x88, 0xe0,
+        0x56, 0x50, 0x84, 0x01, 0xbe, 0x67, 0x07, 0xde, 0xbc, 0xe3, 0x48, 0xdb, 0x3f, 0x66, 0xc7, 0x04,
+        0xbc, 0x7a, 0x6b, 0x54, 0xf7, 0x90, 0x9b, 0xc1, 0xb4, 0xe9, 0x53, 0x2f, 0xb5, 0x9f, 0xe9, 0x34,
+      } },
+    { "key 6 msg 0", 1,
+      {
+        0x7e, 0xe7, 0xe5, 0xdd, 0x92, 0x22, 0x78, 0x1d, 0xdc, 0xa3, 0x4d, 0x24, 0xc3, 0x97, 0xe9, 0x0c,
+        0x20, 0x63, 0x62, 0xae, 0xaa, 0x5a, 0x68, 0xa5, 0xad, 0x58, 0x68, 0xbe, 0xc1, 0xeb, 0xb5, 0x4f,
+      },
+      {
+        0x30, 0xb9, 0xa9, 0x15, 0x1e, 0xa2, 0xa0, 0xa3, 0xfa, 0x20, 0xd7, 0x3c, 0x41, 0x8a, 0xfb, 0x83,
+        0x40, 0x0d, 0x2c, 0xc5, 0xd5, 0x74, 0xc9, 0x7a, 0x1e, 0xf3, 0x71, 0x24, 0x31, 0x27, 0x86, 0x74,
+        0x42, 0x65, 0x06, 0xd6, 0x10, 0x33, 0x78, 0xa5, 0xf6, 0x36, 0x3c, 0x9c, 0xe8, 0x2d, 0x3b, 0x51,
+        0xb0, 0xd4, 0x96, 0x20, 0x97, 0x11, 0x8c, 0x1f, 0x09, 0x6c, 0x45, 0x4a, 0xa6, 0x57, 0x85, 0x92,
+      },
+      {
+        0x79, 0xf0, 0xf3, 0x57, 0xb4, 0x9b, 0x35, 0xdb, 0x26, 0x0f, 0x43, 0xd6, 0xbb, 0xca, 0x7b, 0x5a,
+        0xd9, 0x4d, 0xd8, 0x6e, 0x1c, 0xc1, 0xec, 0x2a, 0x17, 0x4d, 0xa6, 0x55, 0x2c, 0x63, 0xd6, 0x01,
+      },
+      {
+        0xa2, 0x0f, 0x56, 0x07, 0x68, 0xb6, 0x37, 0x89, 0xec, 0x40, 0x12, 0x5e, 0xc6, 0xfc, 0xca, 0x50,
+        0xe1, 0x3b, 0xa1, 0x71, 0x77, 0x94, 0xeb, 0xda, 0x68, 0xe7, 0x71, 0x54, 0xb2, 0x64, 0x2b, 0xdd,
+        0x5f, 0xe1, 0xb8, 0xdf, 0x35, 0x1b, 0x23, 0x8b, 0x77, 0x65, 0x7a, 0x54, 0x7d, 0xca, 0x50, 0x57,
+        0x21, 0xa1, 0x01, 0xe1, 0xf1, 0xb1, 0xf2, 0x2e, 0xf3, 0xb2, 0x76, 0xf3, 0x4a, 0x0f, 0x78, 0x2b,
+      } },
+    { "key 6 msg 1", 1,
+      {
+        0x7e, 0xe7, 0xe5, 0xdd, 0x92, 0x22, 0x78, 0x1d, 0xdc, 0xa3, 0x4d, 0x24, 0xc3, 0x97, 0xe9, 0x0c,
+        0x20, 0x63, 0x62, 0xae, 0xaa, 0x5a, 0x68, 0xa5, 0xad, 0x58, 0x68, 0xbe, 0xc1, 0xeb, 0xb5, 0x4f,
+      },
+      {
+        0x30, 0xb9, 0xa9, 0x15, 0x1e, 0xa2, 0xa0, 0xa3, 0xfa, 0x20, 0xd7, 0x3c, 0x41, 0x8a, 0xfb, 0x83,
+        0x40, 0x0d, 0x2c, 0xc5, 0xd5, 0x74, 0xc9, 0x7a, 0x1e, 0xf3, 0x71, 0x24, 0x31, 0x27, 0x86, 0x74,
+        0x42, 0x65, 0x06, 0xd6, 0x10, 0x33, 0x78, 0xa5, 0xf6, 0x36, 0x3c, 0x9c, 0xe8, 0x2d, 0x3b, 0x51,
+        0xb0, 0xd4, 0x96, 0x20, 0x97, 0x11, 0x8c, 0x1f, 0x09, 0x6c, 0x45, 0x4a, 0xa6, 0x57, 0x85, 0x92,
+      },
+      {
+        0xee, 0x35, 0x0a, 0xe1, 0x91, 0x59, 0x87, 0x18, 0xa2, 0x6c, 0x59, 0x68, 0xc2, 0x8d, 0x2b, 0x0c,
+        0xc4, 0x57, 0x36, 0x1d, 0x95, 0x93, 0x9e, 0x33, 0xba, 0xee, 0x74, 0x9f, 0xce, 0x5c, 0xdf, 0xf2,
+      },
+      {
+        0xd5, 0xdc, 0xaf, 0xa5, 0x83, 0xf5, 0x5a, 0x00, 0x9a, 0x89, 0xd8, 0x23, 0x01, 0x7b, 0x7c, 0x8e,
+        0x19, 0xc3, 0x27, 0xa6, 0x6e, 0x02, 0x76, 0xa5, 0x38, 0x1c, 0x65, 0xb9, 0x78, 0x0b, 0x49, 0xfb,
+        0x1b, 0x0b, 0xec, 0x55, 0xf7, 0x57, 0x78, 0xca, 0xea, 0x85, 0x58, 0xa6, 0xa9, 0xe4, 0xd4, 0x95,
+        0x5b, 0x32, 0xc3, 0x88, 0xdb, 0x98, 0xf1, 0xfb, 0x03, 0x26, 0xd9, 0x2e, 0x9b, 0x65, 0x91, 0xa5,
+      } },
+    { "key 6 msg 2", 0,
+      {
+        0x7e, 0xe7, 0xe5, 0xdd, 0x92, 0x22, 0x78, 0x1d, 0xdc, 0xa3, 0x4d, 0x24, 0xc3, 0x97, 0xe9, 0x0c,
+        0x20, 0x63, 0x62, 0xae, 0xaa, 0x5a, 0x68, 0xa5, 0xad, 0x58, 0x68, 0xbe, 0xc1, 0xeb, 0xb5, 0x4f,
+      },
+      {
+        0x30, 0xb9, 0xa9, 0x15, 0x1e, 0xa2, 0xa0, 0xa3, 0xfa, 0x20, 0xd7, 0x3c, 0x41, 0x8a, 0xfb, 0x83,
+        0x40, 0x0d, 0x2c, 0xc5, 0xd5, 0x74, 0xc9, 0x7a, 0x1e, 0xf3, 0x71, 0x24, 0x31, 0x27, 0x86, 0x74,
+        0x42, 0x65, 0x06, 0xd6, 0x10, 0x33, 0x78, 0xa5, 0xf6, 0x36, 0x3c, 0x9c, 0xe8, 0x2d, 0x3b, 0x51,
+        0xb0, 0xd4, 0x96, 0x20, 0x97, 0x11, 0x8c, 0x1f, 0x09, 0x6c, 0x45, 0x4a, 0xa6, 0x57, 0x85, 0x92,
+      },
+      {
+        0x3f, 0xcd, 0xff, 0x94, 0xb0, 0x29, 0x7e, 0xb4, 0x8f, 0xcc, 0xfc, 0x6d, 0x05, 0x34, 0x47, 0x2d,
+        0x28, 0x22, 0xfa, 0xea, 0xfb, 0x6b, 0x86, 0x5a, 0xdf, 0x32, 0x1b, 0x5e, 0x6e, 0x0b, 0x88, 0xb8,
+      },
+      {
+        0x2c, 0xbf, 0xca, 0xec, 0x36, 0xf5, 0x67, 0xca, 0x1c, 0x80, 0xcc, 0x15, 0x86, 0xbf, 0x1f, 0x4c,
+        0x58, 0x79, 0xfb, 0x00, 0xf2, 0x34, 0x08, 0x22, 0xe7, 0x3e, 0x57, 0x9b, 0x86, 0x6f, 0xe8, 0xd7,
+        0x07, 0x79, 0xe9, 0xf0, 0xee, 0x19, 0x3a, 0xbd, 0x50, 0x81, 0xc6, 0xd8, 0x76, 0x7d, 0xee, 0x7e,
+        0xb5, 0x47, 0xfe, 0xb9, 0xa3, 0x00, 0x4c, 0xbf, 0xa1, 0xf1, 0x6f, 0x08, 0x4d, 0xd8, 0xde, 0xbf,
+      } },
+    { "key 7 msg 0", 1,
+      {
+        0xe5, 0x8f, 0x77, 0x03, 0x92, 0xa9, 0x77, 0x4a, 0x8c, 0x64, 0x33, 0x5e, 0x72, 0xb2, 0xc4, 0xef,
+        0x86, 0x2b, 0x3b, 0x5f, 0xb9, 0xa8, 0x86, 0xb9, 0xed, 0x11, 0x23, 0xc8, 0x38, 0xdf, 0x15, 0x78,
+      },
+      {
+        0xc1, 0x82, 0x05, 0x3a, 0x69, 0x49, 0xd2, 0x22, 0x9b, 0x90, 0xf1, 0x91, 0xcc, 0xa0, 0xe0, 0x39,
+        0xf5, 0x02, 0x4e, 0x4d, 0xc4, 0xb8, 0x2f, 0x6d, 0x3c, 0x90, 0xb1, 0x4d, 0x05, 0xc2, 0xc8, 0x11,
+        0x82, 0x72, 0xb2, 0xc5, 0xdb, 0xee, 0x23, 0x58, 0xbe, 0x70, 0xe3, 0x9f, 0x02, 0x41, 0xba, 0xa3,
+        0x4d, 0x32, 0x7a, 0x1f, 0x13, 0x64, 0x27, 0x24, 0x09, 0xaf, 0xe9, 0xd5, 0xab, 0x94, 0xc3, 0x92,
+      },
+      {
+        0x95, 0xce, 0x5c, 0x74, 0xc3, 0x70, 0x6d, 0xa5, 0xa1, 0x5a, 0xc2, 0x6f, 0xe6, 0x57, 0xbb, 0x50,
+        0x4a, 0xa0, 0xe5, 0x3e, 0xeb, 0x8f, 0x63, 0x25, 0xcc, 0xc5, 0x7e, 0xfc, 0x73, 0x60, 0xbe, 0x7c,
+      },
+      {
+        0x86, 0x87, 0xae, 0xd0, 0x85, 0xf4, 0x24, 0x0c, 0x21, 0x4d, 0xa5, 0x65, 0xbf, 0x57, 0x52, 0x69,
+        0xd5, 0x55, 0x5e, 0x10, 0x5e, 0xa9, 0x14, 0x32, 0x46, 0x91, 0xdd, 0xb7, 0x8b, 0x90, 0xd5, 0xc2,
+        0x6e, 0x12, 0xf2, 0xf8, 0x05, 0xf5, 0xc4, 0x61, 0x98, 0x67, 0xf2, 0x50, 0x9a, 0x84, 0x9e, 0xe4,
+        0x99, 0xc7, 0x6e, 0x60, 0x2c, 0xdf, 0x1c, 0x7b, 0x23, 0xa2, 0xd0, 0xc7, 0x77, 0x50, 0x2e, 0x6f,
+      } },
+    { "key 7 msg 1", 1,
+      {
+        0xe5, 0x8f, 0x77, 0x03, 0x92, 0xa9, 0x77, 0x4a, 0x8c, 0x64, 0x33, 0x5e, 0x72, 0xb2, 0xc4, 0xef,
+        0x86, 0x2b, 0x3b, 0x5f, 0xb9, 0xa8, 0x86, 0xb9, 0xed, 0x11, 0x23, 0xc8, 0x38, 0xdf, 0x15, 0x78,
+      },
+      {
+        0xc1, 0x82, 0x05, 0x3a, 0x69, 0x49, 0xd2, 0x22, 0x9b, 0x90, 0xf1, 0x91, 0xcc, 0xa0, 0xe0, 0x39,
+        0xf5, 0x02, 0x4e, 0x4d, 0xc4, 0xb8, 0x2f, 0x6d, 0x3c, 0x90, 0xb1, 0x4d, 0x05, 0xc2, 0xc8, 0x11,
+        0x82, 0x72, 0xb2, 0xc5, 0xdb, 0xee, 0x23, 0x58, 0xbe, 0x70, 0xe3, 0x9f, 0x02, 0x41, 0xba, 0xa3,
+        0x4d, 0x32, 0x7a, 0x1f, 0x13, 0x64, 0x27, 0x24, 0x09, 0xaf, 0xe9, 0xd5, 0xab, 0x94, 0xc3, 0x92,
+      },
+      {
+        0x24, 0x50, 0x4c, 0x12, 0x05, 0x3d, 0x93, 0x63, 0x89, 0x51, 0x0d, 0xf3, 0x73, 0x3a, 0xda, 0xb8,
+        0x90, 0xce, 0xf7, 0xcc, 0xcc, 0x2c, 0x22, 0xfc, 0x3d, 0x1e, 0x3e, 0x8c, 0xb3, 0x2d, 0xe7, 0xe5,
+      },
+      {
+        0x82, 0xf5, 0x2e, 0x00, 0x38, 0x11, 0x5f, 0x93, 0x6f, 0x26, 0x15, 0x7c, 0x2c, 0x92, 0xca, 0xf5,
+        0x76, 0x6c, 0x85, 0x72, 0xcc, 0x85, 0x83, 0xc9, 0x93, 0x65, 0x2d, 0x9e, 0x5c, 0xca, 0x81, 0x77,
+        0x63, 0x99, 0xb6, 0x0f, 0x45, 0x89, 0x79, 0xa5, 0xd2, 0xaf, 0xa8, 0x8f, 0x00, 0x6f, 0xb6, 0x15,
+        0xc3, 0x50, 0xfd, 0xa6, 0x05, 0x4c, 0x00, 0x8a, 0x11, 0x36, 0x22, 0x01, 0x26, 0x47, 0xf1, 0x2a,
+      } },
+    { "key 7 msg 2", 0,
+      {
+        0xe5, 0x8f, 0x77, 0x03, 0x92, 0xa9, 0x77, 0x4a, 0x8c, 0x64, 0x33, 0x5e, 0x72, 0xb2, 0xc4, 0xef,
+        0x86, 0x2b, 0x3b, 0x5f, 0xb9, 0xa8, 0x86, 0xb9, 0xed, 0x11, 0x23, 0xc8, 0x38, 0xdf, 0x15, 0x78,
+      },
+      {
+        0xc1, 0x82, 0x05, 0x3a, 0x69, 0x49, 0xd2, 0x22, 0x9b, 0x90, 0xf1, 0x91, 0xcc, 0xa0, 0xe0, 0x39,
+        0xf5, 0x02, 0x4e, 0x4d, 0xc4, 0xb8, 0x2f, 0x6d, 0x3c, 0x90, 0xb1, 0x4d, 0x05, 0xc2, 0xc8, 0x11,
+        0x82, 0x72, 0xb2, 0xc5, 0xdb, 0xee, 0x23, 0x58, 0xbe, 0x70, 0xe3, 0x9f, 0x02, 0x41, 0xba, 0xa3,
+        0x4d, 0x32, 0x7a, 0x1f, 0x13, 0x64, 0x27, 0x24, 0x09, 0xaf, 0xe9, 0xd5, 0xab, 0x94, 0xc3, 0x92,
+      },
+      {
+        0x6d, 0x31, 0xba, 0x61, 0x9b, 0x71, 0xbc, 0x5d, 0x7c, 0x35, 0x1c, 0x4b, 0x69, 0x44, 0x39, 0x8d,
+        0xce, 0x6d, 0x14, 0x03, 0x1c, 0x08, 0x63, 0x23, 0x17, 0x84, 0x6e, 0xcf, 0x2a, 0xcc, 0x07, 0x47,
+      },
+      {
+        0x88, 0xe1, 0x6d, 0xff, 0xcc, 0x5e, 0x1d, 0xd9, 0xa1, 0x0d, 0xae, 0xb7, 0x61, 0x2b, 0x75, 0x0f,
+        0x24, 0xbf, 0x4b, 0xc2, 0x3b, 0xd3, 0x11, 0x1b, 0x76, 0x80, 0xaa, 0x99, 0x71, 0x9f, 0xd4, 0x77,
+        0x20, 0x61, 0xbf, 0x2a, 0x4d, 0x56, 0xee, 0x0d, 0x84, 0x76, 0x86, 0x3f, 0x02, 0x96, 0x66, 0x32,
+        0xed, 0xdf, 0x83, 0x02, 0xc7, 0x4d, 0xb0, 0xf8, 0xfc, 0xb2, 0xe6, 0x2d, 0x94, 0x70, 0xf0, 0x12,
+      } },
+};
+
+#endif
@@ -0,0 +1,58 @@
+#define _GNU_SOURCE
+// unix side of the i2c tracer (see ../i2c-trace.h): collect the
+// binary dump and print per-phase latency histograms.
+//
+//   i2c-trace <file>     decode a capture (e.g. from the fake build).
+//   i2c-trace [<tty>]    pull the dump from a pi running a traced
+//                        program (tests/8-i2c-trace.c).  pi-install
+//                        strips non-printable bytes, so quit it once
+//                        the pi says it is waiting and run this.
+#include <stdio.h>
+#include <string.h>
+#include <termios.h>
+
+#include "libunix.h"
+
+// pi zero: 700MHz.
+#define CYC_PER_USEC 700
+#define MAXBYTES (1024 * 1024)
+
+// read until "DONE!!!" or the tty goes quiet for a second.
+static unsigned read_dump(int fd, uint8_t *buf, unsigned max) {
+    unsigned n = 0;
+    while(n < max && can_read_timeout(fd, 1000 * 1000)) {
+        int r = read(fd, buf + n, max - n);
+        if(r <= 0)
+            break;
+        n += r;
+        if(memmem(buf, n, "DONE!!!", 7))
+            break;
+    }
+    return n;
+}
+
+int main(int argc, char *argv[]) {
+    uint8_t *buf;
+    unsigned n;
+
+    if(argc > 2)
+        die("usage: %s [<capture file> | <tty>]\n", argv[0]);
+
+    if(argc == 2 && !prefix_cmp(argv[1], "/dev/")) {
+        buf = read_file(&n, argv[1]);
+    } else {
+        const char *dev = argc == 2 ? argv[1] : find_ttyusb_last();
+        int fd = set_tty_to_8n1(open_tty(dev), B115200, 1);
+        output("reading i2c trace from <%s>\n", dev);
+
+        // any byte tells the pi to send.
+        put_uint8(fd, 'T');
+        buf = calloc(1, MAXBYTES);
+        n = read_dump(fd, buf, MAXBYTES);
+        close(fd);
+    }
+
+    if(i2c_trace_decode(buf, n, CYC_PER_USEC) < 0)
+        die("no i2c trace in %d bytes of input\n", n);
+    return 0;
+}
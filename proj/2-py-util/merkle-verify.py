@@ -0,0 +1,148 @@
+"""Check a Merkle batch receipt from the ATECC608A on a host.
+
+The Pi signs only the root of a SHA-256 tree over a batch of digests
+(proj/1-i2c/atecc-merkle.h); each digest comes back with a receipt:
+
+    index (4 bytes BE) || n (4 bytes BE) || root signature (64) || path
+
+This recomputes the root from the digest and the path, the same way
+atecc_merkle_root does, and checks the chip's P-256 signature over it.
+
+    python3 merkle-verify.py PUBKEY DIGEST RECEIPT     (all hex)
+    python3 merkle-verify.py --self-test
+"""
+import hashlib
+import importlib.util
+import os
+import sys
+
+MAX_LEAVES = 256
+
+
+def _p256():
+    """the plain-Python curve math from p256-vectors.py."""
+    path = os.path.join(os.path.dirname(os.path.abspath(__file__)), "p256-vectors.py")
+    spec = importlib.util.spec_from_file_location("p256_vectors", path)
+    mod = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(mod)
+    return mod
+
+
+def sha256(*parts):
+    return hashlib.sha256(b"".join(parts)).digest()
+
+
+def leaf(digest):
+    return sha256(b"\x00", digest)
+
+
+def node(left, right):
+    return sha256(b"\x01", left, right)
+
+
+def root_of(top, n):
+    return sha256(b"\x02", n.to_bytes(4, "big"), top)
+
+
+def path_len(index, n):
+    length = 0
+    while n > 1:
+        if (index ^ 1) < n:
+            length += 1
+        index >>= 1
+        n = (n + 1) // 2
+    return length
+
+
+def parse(receipt):
+    """(index, n, sig, path) or ValueError."""
+    if len(receipt) < 72:
+        raise ValueError("receipt too short")
+    index = int.from_bytes(receipt[0:4], "big")
+    n = int.from_bytes(receipt[4:8], "big")
+    if not 0 < n <= MAX_LEAVES or index >= n:
+        raise ValueError("index %d of %d" % (index, n))
+    k = path_len(index, n)
+    if len(receipt) < 72 + 32 * k:
+        raise ValueError("receipt path too short")
+    path = [receipt[72 + 32 * i:104 + 32 * i] for i in range(k)]
+    return index, n, receipt[8:72], path
+
+
+def verify(pubkey, digest, receipt):
+    """True if <receipt> shows <digest> was in a batch the key signed."""
+    try:
+        index, n, sig, path = parse(receipt)
+    except ValueError:
+        return False
+    root = compute_root(digest, index, n, path)
+    p256 = _p256()
+    q = (int.from_bytes(pubkey[:32], "big"), int.from_bytes(pubkey[32:], "big"))
+    r, s = int.from_bytes(sig[:32], "big"), int.from_bytes(sig[32:], "big")
+    return p256.verify(q, root, r, s)
+
+
+def compute_root(digest, index, n, path):
+    h = leaf(digest)
+    i, cnt = index, n
+    path = iter(path)
+    while cnt > 1:
+        if (i ^ 1) < cnt:
+            h = node(next(path), h) if i & 1 else node(h, next(path))
+        i >>= 1
+        cnt = (cnt + 1) // 2
+    return root_of(h, n)
+
+
+def build(digests):
+    """all receipts' (root, paths) for a batch, the way atecc-merkle.c does."""
+    levels = [[leaf(d) for d in digests]]
+    while len(levels[-1]) > 1:
+        lo = levels[-1]
+        up = [node(lo[i], lo[i + 1]) for i in range(0, len(lo) - 1, 2)]
+        if len(lo) & 1:
+            up.append(lo[-1])
+        levels.append(up)
+    paths = []
+    for index in range(len(digests)):
+        path, i = [], index
+        for lo in levels[:-1]:
+            if (i ^ 1) < len(lo):
+                path.append(lo[i ^ 1])
+            i >>= 1
+        paths.append(path)
+    return root_of(levels[-1][0], len(digests)), paths
+
+
+def self_test():
+    p256 = _p256()
+    d = 0x1234567
+    q = p256.mul(d, p256.G)
+    pub = q[0].to_bytes(32, "big") + q[1].to_bytes(32, "big")
+    for n in (1, 2, 3, 5, 8, 13):
+        digests = [sha256(b"tx", bytes([i])) for i in range(n)]
+        root, paths = build(digests)
+        r, s = p256.sign(d, root)
+        sig = r.to_bytes(32, "big") + s.to_bytes(32, "big")
+        for i in range(n):
+            receipt = i.to_bytes(4, "big") + n.to_bytes(4, "big") + sig + b"".join(paths[i])
+            assert verify(pub, digests[i], receipt), (n, i)
+            if n > 1:
+                assert not verify(pub, digests[(i + 1) % n], receipt), (n, i)
+    print("self-test ok")
+
+
+def main(argv):
+    if argv[1:] == ["--self-test"]:
+        self_test()
+        return 0
+    if len(argv) != 4:
+        sys.exit(__doc__)
+    pub, digest, receipt = (bytes.fromhex(a) for a in argv[1:])
+    ok = verify(pub, digest, receipt)
+    print("receipt is valid" if ok else "receipt is NOT valid")
+    return 0 if ok else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,185 @@
+"""Generate fixed P-256 ECDSA test vectors for the C verifier.
+
+Writes ../1-i2c/tests/p256-vectors.h: good signatures over SHA-256
+message digests plus corrupted ones (flipped bits, r or s out of range,
+a public key off the curve).  The curve math here is plain Python, and
+every vector with r and s in range is cross-checked with
+verify_signature from p256.py (pycryptodome): without pycryptodome the
+script refuses to write the header unless given --unchecked.
+"""
+import contextlib
+import hashlib
+import io
+import hmac
+import random
+import sys
+
+P = 0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff
+N = 0xffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc632551
+B = 0x5ac635d8aa3a93e7b3ebbd55769886bc651d06b0cc53b0f63bce3c3e27d2604b
+G = (0x6b17d1f2e12c4247f8bce6e563a440f277037d812deb33a0f4a13945d898c296,
+     0x4fe342e2fe1a7f9b8ee7eb4a7c0f9e162bce33576b315ececbb6406837bf51f5)
+
+
+def add(p1, p2):
+    if p1 is None:
+        return p2
+    if p2 is None:
+        return p1
+    (x1, y1), (x2, y2) = p1, p2
+    if x1 == x2 and (y1 + y2) % P == 0:
+        return None
+    if p1 == p2:
+        l = (3 * x1 * x1 - 3) * pow(2 * y1, -1, P) % P
+    else:
+        l = (y2 - y1) * pow(x2 - x1, -1, P) % P
+    x3 = (l * l - x1 - x2) % P
+    return (x3, (l * (x1 - x3) - y1) % P)
+
+
+def mul(k, pt):
+    r = None
+    while k:
+        if k & 1:
+            r = add(r, pt)
+        pt = add(pt, pt)
+        k >>= 1
+    return r
+
+
+def rfc6979_k(d, h):
+    """Deterministic nonce (RFC 6979, SHA-256), same as DSS 'deterministic-rfc6979'."""
+    x = d.to_bytes(32, 'big')
+    h1 = (int.from_bytes(h, 'big') % N).to_bytes(32, 'big')
+    v, k = b'\x01' * 32, b'\x00' * 32
+    k = hmac.new(k, v + b'\x00' + x + h1, hashlib.sha256).digest()
+    v = hmac.new(k, v, hashlib.sha256).digest()
+    k = hmac.new(k, v + b'\x01' + x + h1, hashlib.sha256).digest()
+    v = hmac.new(k, v, hashlib.sha256).digest()
+    while True:
+        v = hmac.new(k, v, hashlib.sha256).digest()
+        t = int.from_bytes(v, 'big')
+        if 0 < t < N:
+            return t
+        k = hmac.new(k, v + b'\x00', hashlib.sha256).digest()
+        v = hmac.new(k, v, hashlib.sha256).digest()
+
+
+def sign(d, digest):
+    e = int.from_bytes(digest, 'big') % N
+    k = rfc6979_k(d, digest)
+    r = mul(k, G)[0] % N
+    s = pow(k, -1, N) * (e + r * d) % N
+    return r, s
+
+
+def verify(q, digest, r, s):
+    if not (0 < r < N and 0 < s < N):
+        return False
+    if q is None or (q[1] ** 2 - q[0] ** 3 + 3 * q[0] - B) % P != 0:
+        return False
+    e = int.from_bytes(digest, 'big') % N
+    w = pow(s, -1, N)
+    pt = add(mul(e * w % N, G), mul(r * w % N, q))
+    return pt is not None and pt[0] % N == r
+
+
+def pycryptodome_verify(q, msg, r, s):
+    """verify_signature from p256.py, or None without pycryptodome."""
+    try:
+        from Crypto.PublicKey import ECC
+        import p256
+    except ImportError:
+        return None
+    try:
+        key = ECC.construct(curve='P-256', point_x=q[0], point_y=q[1])
+    except ValueError:
+        return False
+    sig = r.to_bytes(32, 'big') + s.to_bytes(32, 'big')
+    # it prints why a signature fails: expected for the bad vectors.
+    with contextlib.redirect_stdout(io.StringIO()):
+        return p256.verify_signature(key, msg, sig)
+
+
+def vectors(nkeys=8, nmsgs=4):
+    rng = random.Random(140)
+    out = []
+    for i in range(nkeys):
+        d = rng.randrange(1, N)
+        q = mul(d, G)
+        for j in range(nmsgs):
+            msg = bytes(rng.randrange(256) for _ in range(rng.randrange(1, 80)))
+            digest = hashlib.sha256(msg).digest()
+            r, s = sign(d, digest)
+            out.append(("key %d msg %d" % (i, j), q, msg, r, s))
+            if j == 0:
+                out.append(("key %d, r bit flip" % i, q, msg, r ^ (1 << rng.randrange(256)), s))
+                out.append(("key %d, s bit flip" % i, q, msg, r, s ^ (1 << rng.randrange(256))))
+                bad = bytearray(msg)
+                bad[0] ^= 1
+                out.append(("key %d, message bit flip" % i, q, bytes(bad), r, s))
+                out.append(("key %d, wrong key" % i, mul(d + 1, G), msg, r, s))
+            if i == 0 and j == 0:
+                out.append(("r = 0", q, msg, 0, s))
+                out.append(("s = n", q, msg, r, N))
+                out.append(("r = r + n", q, msg, r + N, s))
+                out.append(("key off the curve", (q[0], (q[1] + 1) % P), msg, r, s))
+    # Shamir's table edge cases: G + Q is infinity (Q = -G) or a
+    # doubling (Q = G).
+    d = N - 1
+    msg = b"q is -g"
+    digest = hashlib.sha256(msg).digest()
+    r, s = sign(d, digest)
+    out.append(("q = -g", mul(d, G), msg, r, s))
+    d = 1
+    r, s = sign(d, digest)
+    out.append(("q = g", G, msg, r, s))
+    return out
+
+
+def c_bytes(b, indent="        "):
+    lines = []
+    for i in range(0, len(b), 16):
+        lines.append(indent + ", ".join("0x%02x" % x for x in b[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def main(path, unchecked=False):
+    if pycryptodome_verify(mul(1, G), b"", 1, 1) is None and not unchecked:
+        sys.exit("pycryptodome is not installed: nothing to cross-check the vectors "
+                 "against (pip install pycryptodome, or pass --unchecked)")
+    vecs = vectors()
+    nchecked = 0
+    with open(path, "w") as f:
+        f.write("// generated by proj/2-py-util/p256-vectors.py: do not edit.\n")
+        f.write("//\n// P-256 ECDSA over SHA-256 digests; ok says whether the signature\n")
+        f.write("// verifies.  r and s are taken mod 2^256 (\"r = r + n\" wraps).\n")
+        f.write("#ifndef __P256_VECTORS_H__\n#define __P256_VECTORS_H__\n\n")
+        f.write("typedef struct {\n    const char *name;\n    int ok;\n")
+        f.write("    uint8_t pubkey[64];\n    uint8_t digest[32];\n    uint8_t sig[64];\n")
+        f.write("} p256_vector_t;\n\n")
+        f.write("static const p256_vector_t p256_vectors[] = {\n")
+        for name, q, msg, r, s in vecs:
+            digest = hashlib.sha256(msg).digest()
+            ok = verify(q, digest, r, s)
+            if 0 < r < N and 0 < s < N:
+                ref = pycryptodome_verify(q, msg, r, s)
+                if ref is not None:
+                    nchecked += 1
+                    if ref != ok:
+                        sys.exit("%s: p256.py says %s" % (name, ref))
+            pub = q[0].to_bytes(32, 'big') + q[1].to_bytes(32, 'big')
+            sig = (r % 2**256).to_bytes(32, 'big') + (s % 2**256).to_bytes(32, 'big')
+            f.write("    { \"%s\", %d,\n" % (name, ok))
+            f.write("      {\n%s\n      },\n" % c_bytes(pub))
+            f.write("      {\n%s\n      },\n" % c_bytes(digest))
+            f.write("      {\n%s\n      } },\n" % c_bytes(sig))
+        f.write("};\n\n#endif\n")
+    print("%d vectors (%d valid), %d cross-checked against p256.py" %
+          (len(vecs), sum(verify(q, hashlib.sha256(m).digest(), r, s) for _, q, m, r, s in vecs),
+           nchecked))
+
+
+if __name__ == "__main__":
+    args = [a for a in sys.argv[1:] if a != "--unchecked"]
+    main(args[0] if args else "../1-i2c/tests/p256-vectors.h", "--unchecked" in sys.argv[1:])
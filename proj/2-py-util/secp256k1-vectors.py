@@ -0,0 +1,142 @@
+"""Generate fixed secp256k1 ECDSA test vectors for the C signer.
+
+Writes ../1-i2c/tests/secp256k1-vectors.h: a private key, the public
+key it gives, and the RFC 6979 low-S signature and recovery id of a
+SHA-256 digest.  The C side must reproduce every signature byte for
+byte.  Keys include the edges 1, 2, 3 and n - 1; the first vector is
+the widely published key = 1, "Satoshi Nakamoto" signature, which is
+asserted here so the generator itself is checked against the outside.
+"""
+import hashlib
+import hmac
+import random
+import sys
+
+P = 2**256 - 2**32 - 977
+N = 0xfffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141
+G = (0x79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798,
+     0x483ada7726a3c4655da4fbfc0e1108a8fd17b448a68554199c47d08ffb10d4b8)
+
+
+def add(p1, p2):
+    if p1 is None:
+        return p2
+    if p2 is None:
+        return p1
+    (x1, y1), (x2, y2) = p1, p2
+    if x1 == x2 and (y1 + y2) % P == 0:
+        return None
+    if p1 == p2:
+        l = 3 * x1 * x1 * pow(2 * y1, -1, P) % P
+    else:
+        l = (y2 - y1) * pow(x2 - x1, -1, P) % P
+    x3 = (l * l - x1 - x2) % P
+    return (x3, (l * (x1 - x3) - y1) % P)
+
+
+def mul(k, pt):
+    r = None
+    while k:
+        if k & 1:
+            r = add(r, pt)
+        pt = add(pt, pt)
+        k >>= 1
+    return r
+
+
+def rfc6979_k(d, h):
+    """Deterministic nonce (RFC 6979, SHA-256)."""
+    x = d.to_bytes(32, 'big')
+    h1 = (int.from_bytes(h, 'big') % N).to_bytes(32, 'big')
+    v, k = b'\x01' * 32, b'\x00' * 32
+    k = hmac.new(k, v + b'\x00' + x + h1, hashlib.sha256).digest()
+    v = hmac.new(k, v, hashlib.sha256).digest()
+    k = hmac.new(k, v + b'\x01' + x + h1, hashlib.sha256).digest()
+    v = hmac.new(k, v, hashlib.sha256).digest()
+    while True:
+        v = hmac.new(k, v, hashlib.sha256).digest()
+        t = int.from_bytes(v, 'big')
+        if 0 < t < N:
+            return t
+        k = hmac.new(k, v + b'\x00', hashlib.sha256).digest()
+        v = hmac.new(k, v, hashlib.sha256).digest()
+
+
+def sign(d, digest):
+    """(r, s, recid) with s <= n/2."""
+    e = int.from_bytes(digest, 'big') % N
+    k = rfc6979_k(d, digest)
+    R = mul(k, G)
+    r = R[0] % N
+    s = pow(k, -1, N) * (e + r * d) % N
+    recid = (R[1] & 1) | (2 if R[0] >= N else 0)
+    if s > N // 2:
+        s, recid = N - s, recid ^ 1
+    return r, s, recid
+
+
+def verify(q, digest, r, s):
+    if not (0 < r < N and 0 < s < N):
+        return False
+    e = int.from_bytes(digest, 'big') % N
+    w = pow(s, -1, N)
+    pt = add(mul(e * w % N, G), mul(r * w % N, q))
+    return pt is not None and pt[0] % N == r
+
+
+def vectors(nkeys=8, nmsgs=3):
+    rng = random.Random(256)
+    out = [("key 1, Satoshi Nakamoto", 1, b"Satoshi Nakamoto")]
+    for name, d in (("key 2", 2), ("key 3", 3), ("key n - 1", N - 1)):
+        out.append((name, d, b"edge key"))
+    for i in range(nkeys):
+        d = rng.randrange(1, N)
+        for j in range(nmsgs):
+            msg = bytes(rng.randrange(256) for _ in range(rng.randrange(1, 80)))
+            out.append(("key %d msg %d" % (i, j), d, msg))
+    return out
+
+
+def c_bytes(b, indent="        "):
+    lines = []
+    for i in range(0, len(b), 16):
+        lines.append(indent + ", ".join("0x%02x" % x for x in b[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def main(path):
+    vecs = vectors()
+    r, s, _ = sign(1, hashlib.sha256(b"Satoshi Nakamoto").digest())
+    if (r, s) != (0x934b1ea10a4b3c1757e2b0c017d0b6143ce3c9a7e6a4a49860d7a6ab210ee3d8,
+                  0x2442ce9d2b916064108014783e923ec36b49743e2ffa1c4496f01a512aafd9e5):
+        sys.exit("key = 1 \"Satoshi Nakamoto\" signature does not match")
+
+    with open(path, "w") as f:
+        f.write("// generated by proj/2-py-util/secp256k1-vectors.py: do not edit.\n")
+        f.write("//\n// secp256k1 ECDSA over SHA-256 digests: RFC 6979 nonces, low S,\n")
+        f.write("// recid as secp256k1_sign returns it.\n")
+        f.write("#ifndef __SECP256K1_VECTORS_H__\n#define __SECP256K1_VECTORS_H__\n\n")
+        f.write("typedef struct {\n    const char *name;\n    int recid;\n")
+        f.write("    uint8_t priv[32];\n    uint8_t pubkey[64];\n")
+        f.write("    uint8_t digest[32];\n    uint8_t sig[64];\n")
+        f.write("} secp256k1_vector_t;\n\n")
+        f.write("static const secp256k1_vector_t secp256k1_vectors[] = {\n")
+        for name, d, msg in vecs:
+            digest = hashlib.sha256(msg).digest()
+            q = mul(d, G)
+            r, s, recid = sign(d, digest)
+            if not verify(q, digest, r, s):
+                sys.exit("signature by %x does not verify" % d)
+            pub = q[0].to_bytes(32, 'big') + q[1].to_bytes(32, 'big')
+            sig = r.to_bytes(32, 'big') + s.to_bytes(32, 'big')
+            f.write("    { \"%s\", %d,\n" % (name, recid))
+            f.write("      {\n%s\n      },\n" % c_bytes(d.to_bytes(32, 'big')))
+            f.write("      {\n%s\n      },\n" % c_bytes(pub))
+            f.write("      {\n%s\n      },\n" % c_bytes(digest))
+            f.write("      {\n%s\n      } },\n" % c_bytes(sig))
+        f.write("};\n\n#endif\n")
+    print("%d vectors" % len(vecs))
+
+
+if __name__ == "__main__":
+    main(sys.argv[1] if len(sys.argv) > 1 else "../1-i2c/tests/secp256k1-vectors.h")